@@ -0,0 +1,144 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script evaluates branch predictors on a branch trace, recorded with
+# the BranchTrace probe of the O3 CPU or extracted from an Exec trace with
+# util/extract_branch_trace.py. Every predictor is driven by its own
+# BranchTraceReplayer, without a CPU model, and with --parallel each
+# replayer runs on its own event queue (and host thread). The trace is read
+# once and shared by all replayers. The results of each predictor end up
+# under replayer<N> in the stats file.
+#
+# Example:
+#   gem5.opt configs/example/bpred_trace_eval.py --trace branches.trc.gz \
+#       --bp-types TournamentBP LTAGE TAGE_SC_L_64KB --parallel
+
+import argparse
+
+import m5
+from m5.objects import *
+from m5.util import addToPath
+
+addToPath("../")
+from common import ObjectList
+
+parser = argparse.ArgumentParser(
+    description="Evaluate branch predictors on a branch trace"
+)
+parser.add_argument(
+    "--trace", required=True, help="Branch trace to replay (protobuf)"
+)
+parser.add_argument(
+    "--bp-types",
+    nargs="+",
+    default=["TournamentBP"],
+    choices=ObjectList.bp_list.get_names(),
+    help="Branch predictors to evaluate",
+)
+parser.add_argument(
+    "--indirect-bp-type",
+    default=None,
+    choices=ObjectList.indirect_bp_list.get_names(),
+    help="Indirect predictor of all the branch predictors",
+)
+parser.add_argument(
+    "--update-delay",
+    type=int,
+    default=16,
+    help="Number of younger branches predicted before a branch updates "
+    "the predictor",
+)
+parser.add_argument(
+    "--max-branches",
+    type=int,
+    default=0,
+    help="Number of trace branches to replay, 0 for the whole trace",
+)
+parser.add_argument(
+    "--profile-host-time",
+    action="store_true",
+    help="Report the host time spent in each part of the predictors",
+)
+parser.add_argument(
+    "--parallel",
+    action="store_true",
+    help="Evaluate each predictor on its own event queue",
+)
+parser.add_argument(
+    "--random-seed",
+    type=int,
+    default=1,
+    help="Seed of the random number generator of each predictor, 0 to "
+    "share the global one, which is not thread safe",
+)
+parser.add_argument(
+    "--sim-quantum",
+    default="1us",
+    help="Synchronisation quantum of the event queues with --parallel",
+)
+
+args = parser.parse_args()
+
+replayers = []
+for idx, bp_type in enumerate(args.bp_types):
+    # Each predictor draws from its own random number generator, so that
+    # predictors on different event queues do not share the global one, and
+    # so that the results do not depend on the other predictors
+    bpred = ObjectList.bp_list.get(bp_type)(
+        profileHostTime=args.profile_host_time, randomSeed=args.random_seed
+    )
+    if args.indirect_bp_type:
+        bpred.indirectBranchPred = ObjectList.indirect_bp_list.get(
+            args.indirect_bp_type
+        )()
+
+    replayer = BranchTraceReplayer(
+        bpred=bpred,
+        trace_file=args.trace,
+        update_delay=args.update_delay,
+        max_branches=args.max_branches,
+        clk_domain=SrcClockDomain(
+            clock="1GHz", voltage_domain=VoltageDomain()
+        ),
+    )
+
+    # the predictor inherits the event queue of its replayer
+    if args.parallel:
+        replayer.eventq_index = idx
+
+    print(f"replayer{idx}: {bp_type}")
+    replayers.append(replayer)
+
+root = Root(full_system=False, replayer=replayers)
+if args.parallel and len(replayers) > 1:
+    root.sim_quantum = m5.ticks.fromSeconds(
+        m5.util.convert.anyToLatency(args.sim_quantum)
+    )
+
+m5.instantiate()
+
+exit_event = m5.simulate()
+print(f"Exiting @ tick {m5.curTick()} because {exit_event.getCause()}")
@@ -36,11 +36,14 @@
 # Basic elastic traces replay script that configures a Trace CPU
 
 import argparse
+import copy
 
+import m5
 from m5.util import addToPath, fatal
 
 addToPath("../")
 
+from common import ObjectList
 from common import Options
 from common import Simulation
 from common import CacheConfig
@@ -49,6 +52,20 @@ from common.Caches import *
 
 parser = argparse.ArgumentParser()
 Options.addCommonOptions(parser)
+parser.add_argument(
+    "--mem-variants",
+    nargs="+",
+    default=[],
+    choices=ObjectList.mem_list.get_names(),
+    help="Replay the traces against one memory system per memory type, "
+    "concurrently on separate event queues, with a single decoded copy "
+    "of the data trace shared by all of them",
+)
+parser.add_argument(
+    "--variants-quantum",
+    default="1us",
+    help="Synchronisation quantum of the event queues with --mem-variants",
+)
 
 if "--ruby" in sys.argv:
     print(
@@ -75,51 +92,92 @@ if args.num_cpus > 1:
 (CPUClass, test_mem_mode, FutureClass) = Simulation.setCPUClass(args)
 CPUClass.numThreads = numThreads
 
-system = System(
-    cpu=CPUClass(cpu_id=0),
-    mem_mode=test_mem_mode,
-    mem_ranges=[AddrRange(args.mem_size)],
-    cache_line_size=args.cacheline_size,
-)
 
-# Create a top-level voltage domain
-system.voltage_domain = VoltageDomain(voltage=args.sys_voltage)
+def build_system(args):
+    system = System(
+        cpu=CPUClass(cpu_id=0),
+        mem_mode=test_mem_mode,
+        mem_ranges=[AddrRange(args.mem_size)],
+        cache_line_size=args.cacheline_size,
+    )
 
-# Create a source clock for the system. This is used as the clock period for
-# xbar and memory
-system.clk_domain = SrcClockDomain(
-    clock=args.sys_clock, voltage_domain=system.voltage_domain
-)
+    # Create a top-level voltage domain
+    system.voltage_domain = VoltageDomain(voltage=args.sys_voltage)
 
-# Create a CPU voltage domain
-system.cpu_voltage_domain = VoltageDomain()
+    # Create a source clock for the system. This is used as the clock period
+    # for xbar and memory
+    system.clk_domain = SrcClockDomain(
+        clock=args.sys_clock, voltage_domain=system.voltage_domain
+    )
 
-# Create a separate clock domain for the CPUs. In case of Trace CPUs this clock
-# is actually used only by the caches connected to the CPU.
-system.cpu_clk_domain = SrcClockDomain(
-    clock=args.cpu_clock, voltage_domain=system.cpu_voltage_domain
-)
+    # Create a CPU voltage domain
+    system.cpu_voltage_domain = VoltageDomain()
 
-# All cpus belong to a common cpu_clk_domain, therefore running at a common
-# frequency.
-for cpu in system.cpu:
-    cpu.clk_domain = system.cpu_clk_domain
-
-# BaseCPU no longer has default values for the BaseCPU.isa
-# createThreads() is needed to fill in the cpu.isa
-for cpu in system.cpu:
-    cpu.createThreads()
-
-# Assign input trace files to the Trace CPU
-system.cpu.instTraceFile = args.inst_trace_file
-system.cpu.dataTraceFile = args.data_trace_file
-
-# Configure the classic memory system args
-MemClass = Simulation.setMemClass(args)
-system.membus = SystemXBar()
-system.system_port = system.membus.cpu_side_ports
-CacheConfig.config_cache(args, system)
-MemConfig.config_mem(args, system)
-
-root = Root(full_system=False, system=system)
-Simulation.run(args, root, system, FutureClass)
+    # Create a separate clock domain for the CPUs. In case of Trace CPUs this
+    # clock is actually used only by the caches connected to the CPU.
+    system.cpu_clk_domain = SrcClockDomain(
+        clock=args.cpu_clock, voltage_domain=system.cpu_voltage_domain
+    )
+
+    # All cpus belong to a common cpu_clk_domain, therefore running at a common
+    # frequency.
+    for cpu in system.cpu:
+        cpu.clk_domain = system.cpu_clk_domain
+
+    # BaseCPU no longer has default values for the BaseCPU.isa
+    # createThreads() is needed to fill in the cpu.isa
+    for cpu in system.cpu:
+        cpu.createThreads()
+
+    # Assign input trace files to the Trace CPU
+    system.cpu.instTraceFile = args.inst_trace_file
+    system.cpu.dataTraceFile = args.data_trace_file
+
+    # Configure the classic memory system args
+    MemClass = Simulation.setMemClass(args)
+    system.membus = SystemXBar()
+    system.system_port = system.membus.cpu_side_ports
+    CacheConfig.config_cache(args, system)
+    MemConfig.config_mem(args, system)
+
+    return system
+
+
+if not args.mem_variants:
+    system = build_system(args)
+    root = Root(full_system=False, system=system)
+    Simulation.run(args, root, system, FutureClass)
+else:
+    systems = []
+    for idx, mem_type in enumerate(args.mem_variants):
+        variant_args = copy.copy(args)
+        variant_args.mem_type = mem_type
+        system = build_system(variant_args)
+        # All the Trace CPUs replay the same data trace, decode it once
+        system.cpu.sharedDataTrace = True
+        # All children inherit the event queue of their system
+        system.eventq_index = idx
+        systems.append(system)
+
+    root = Root(full_system=False, system=systems)
+    if len(systems) > 1:
+        root.sim_quantum = m5.ticks.fromSeconds(
+            m5.util.convert.anyToLatency(args.variants_quantum)
+        )
+
+    m5.instantiate()
+
+    # Honour the same simulation limits as Simulation.run
+    maxtick = min(
+        [
+            args.abs_max_tick or m5.MaxTick,
+            args.rel_max_tick or m5.MaxTick,
+            (
+                m5.ticks.fromSeconds(args.maxtime)
+                if args.maxtime
+                else m5.MaxTick
+            ),
+        ]
+    )
+    exit_event = m5.simulate(maxtick - m5.curTick())
+    print(f"Exiting @ tick {m5.curTick()} because {exit_event.getCause()}")
@@ -0,0 +1,174 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+This configuration script shows how to run a SMARTS-style sampled simulation
+with the gem5 stdlib. The workload runs on an atomic core with caches
+(functional warming). Periodically it switches to an O3 core, which runs a
+short detailed warm-up and then a measurement window. The simulation stops
+once the CPI estimate reaches the requested confidence, or when the workload
+ends.
+
+Usage
+-----
+
+```
+scons build/X86/gem5.opt
+./build/X86/gem5.opt configs/example/gem5_library/x86-smarts-sampling.py \
+    --sampling-period 1000000 --measurement 1000 --warmup 2000
+```
+"""
+
+import argparse
+
+from gem5.simulate.exit_event import ExitEvent
+from gem5.simulate.simulator import Simulator
+from gem5.simulate.sampling import SmartsSampler
+from gem5.utils.requires import requires
+from gem5.components.boards.simple_board import SimpleBoard
+from gem5.components.cachehierarchies.classic.private_l1_private_l2_cache_hierarchy import (
+    PrivateL1PrivateL2CacheHierarchy,
+)
+from gem5.components.memory.single_channel import SingleChannelDDR3_1600
+from gem5.components.processors.simple_switchable_processor import (
+    SimpleSwitchableProcessor,
+)
+from gem5.components.processors.cpu_types import CPUTypes
+from gem5.isas import ISA
+from gem5.resources.resource import obtain_resource
+
+requires(isa_required=ISA.X86)
+
+parser = argparse.ArgumentParser(
+    description="Run a SMARTS-style sampled simulation."
+)
+
+parser.add_argument(
+    "--sampling-period",
+    type=int,
+    default=1000000,
+    help="The number of instructions in each sampling period.",
+)
+
+parser.add_argument(
+    "--warmup",
+    type=int,
+    default=2000,
+    help="The number of detailed warm-up instructions per sample.",
+)
+
+parser.add_argument(
+    "--measurement",
+    type=int,
+    default=1000,
+    help="The number of measured instructions per sample.",
+)
+
+parser.add_argument(
+    "--target-error",
+    type=float,
+    default=0.03,
+    help="Stop once the CPI confidence interval is within this relative "
+    "error.",
+)
+
+parser.add_argument(
+    "--confidence",
+    type=float,
+    default=0.997,
+    help="The confidence level of the CPI confidence interval.",
+)
+
+parser.add_argument(
+    "--dump-stats",
+    action="store_true",
+    help="Dump the stats after every measurement window.",
+)
+
+args = parser.parse_args()
+
+cache_hierarchy = PrivateL1PrivateL2CacheHierarchy(
+    l1d_size="32kB", l1i_size="32kB", l2_size="256kB"
+)
+
+memory = SingleChannelDDR3_1600(size="2GB")
+
+# The processor starts on the atomic cores, which do the functional warming.
+# The sampler switches to the O3 cores for each detailed window.
+processor = SimpleSwitchableProcessor(
+    starting_core_type=CPUTypes.ATOMIC,
+    switch_core_type=CPUTypes.O3,
+    isa=ISA.X86,
+    num_cores=1,
+)
+
+board = SimpleBoard(
+    clk_freq="3GHz",
+    processor=processor,
+    memory=memory,
+    cache_hierarchy=cache_hierarchy,
+)
+
+board.set_se_binary_workload(
+    binary=obtain_resource("x86-print-this"),
+    arguments=["print this", 15000],
+)
+
+# The default metric is ticks per instruction. Dividing by the clock period
+# gives the CPI.
+clock_period = 1e12 / 3e9
+
+sampler = SmartsSampler(
+    processor=processor,
+    sampling_period=args.sampling_period,
+    detailed_warmup_insts=args.warmup,
+    measurement_insts=args.measurement,
+    metric=lambda insts, ticks: ticks / insts / clock_period,
+    confidence=args.confidence,
+    target_error=args.target_error,
+    dump_stats=args.dump_stats,
+)
+
+simulator = Simulator(
+    board=board,
+    on_exit_event={ExitEvent.MAX_INSTS: sampler.get_exit_event_generator()},
+)
+simulator.run()
+
+stats = sampler.get_statistics()
+print(
+    "Exiting @ tick {} because {}.".format(
+        simulator.get_current_tick(), simulator.get_last_exit_event_cause()
+    )
+)
+print(f"CPI: {stats}")
+if not sampler.is_converged() and stats.get_num_samples() > 1:
+    required = stats.get_required_samples(args.target_error)
+    if required is not None:
+        print(
+            "The target error was not met. About {} samples would be "
+            "needed.".format(required)
+        )
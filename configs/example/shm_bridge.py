@@ -0,0 +1,137 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Split a simulation across gem5 processes connected by shared memory
+bridges. One process simulates the memory system, and each of the other
+processes simulates a CPU cluster running a RISC-V SE workload. The
+processes must run on the same host, e.g.:
+
+    gem5.opt -d m5out/mem configs/example/shm_bridge.py memory \\
+        --num-clusters 2 &
+    gem5.opt -d m5out/cpu0 configs/example/shm_bridge.py cpu --cluster 0 \\
+        --cmd tests/test-progs/hello/bin/riscv/linux/hello &
+    gem5.opt -d m5out/cpu1 configs/example/shm_bridge.py cpu --cluster 1 \\
+        --cmd tests/test-progs/hello/bin/riscv/linux/hello &
+
+As each process allocates the physical pages of its SE workload on its
+own, each cluster is given its own share of the memory.
+"""
+
+import argparse
+
+import m5
+from m5.objects import *
+
+parser = argparse.ArgumentParser(
+    formatter_class=argparse.ArgumentDefaultsHelpFormatter
+)
+parser.add_argument("role", choices=["memory", "cpu"])
+parser.add_argument(
+    "--num-clusters", type=int, default=1, help="Number of CPU processes"
+)
+parser.add_argument(
+    "--cluster", type=int, default=0, help="Index of this CPU process"
+)
+parser.add_argument(
+    "--channel",
+    default="gem5_shm_bridge",
+    help="Prefix of the shared memory channel names",
+)
+parser.add_argument(
+    "--socket",
+    default="@gem5_shm_bridge",
+    help="Socket of the SharedMemoryServer",
+)
+parser.add_argument("--mem-size", default="512MiB", help="Size of memory")
+parser.add_argument("--quantum", default="1us", help="Synchronisation quantum")
+parser.add_argument("--cmd", help="Binary to run on a CPU cluster")
+
+args = parser.parse_args()
+
+system = System()
+system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=VoltageDomain()
+)
+system.mem_mode = "timing"
+system.membus = SystemXBar()
+system.system_port = system.membus.cpu_side_ports
+
+if args.role == "memory":
+    system.mem_ranges = [AddrRange(args.mem_size)]
+    system.mem_ctrl = MemCtrl(dram=DDR3_1600_8x8(range=system.mem_ranges[0]))
+    system.mem_ctrl.port = system.membus.mem_side_ports
+
+    # The clients access the memory directly for functional and atomic
+    # accesses, e.g. to load their workloads.
+    system.shared_backstore = args.channel + "_mem"
+    system.shm_server = SharedMemoryServer(server_path=args.socket)
+
+    system.bridges = [
+        ShmBridgeServer(
+            channel=f"{args.channel}_{i}",
+            quantum=args.quantum,
+            latency=args.quantum,
+        )
+        for i in range(args.num_clusters)
+    ]
+    for bridge in system.bridges:
+        bridge.mem_side = system.membus.cpu_side_ports
+else:
+    if not args.cmd:
+        parser.error("--cmd is required for a CPU cluster")
+
+    share = int(MemorySize(args.mem_size)) // args.num_clusters
+    system.bridge = ShmBridgeClient(
+        channel=f"{args.channel}_{args.cluster}",
+        range=AddrRange(args.cluster * share, size=share),
+        shm_server_path=args.socket,
+        quantum=args.quantum,
+        latency=args.quantum,
+    )
+    system.bridge.port = system.membus.mem_side_ports
+
+    system.cpu = RiscvTimingSimpleCPU()
+    system.cpu.icache_port = system.membus.cpu_side_ports
+    system.cpu.dcache_port = system.membus.cpu_side_ports
+    system.cpu.createInterruptController()
+
+    system.workload = SEWorkload.init_compatible(args.cmd)
+    process = Process(cmd=[args.cmd])
+    system.cpu.workload = process
+    system.cpu.createThreads()
+
+root = Root(full_system=False, system=system)
+m5.instantiate()
+
+if args.role == "memory":
+    # Each bridge ends the simulation loop when its client exits.
+    for _ in range(args.num_clusters):
+        exit_event = m5.simulate()
+        print(f"{exit_event.getCause()} @ {m5.curTick()}")
+else:
+    exit_event = m5.simulate()
+    print(f"Exiting @ tick {m5.curTick()} because {exit_event.getCause()}")
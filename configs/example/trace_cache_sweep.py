@@ -0,0 +1,163 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script replays a packet trace, e.g. one recorded with a
+# CommMonitor, through a single level of cache for every combination of
+# the requested cache sizes, associativities, replacement policies and
+# prefetchers. There is no CPU model involved, so the NULL build of gem5
+# is sufficient. Every configuration is a separate system, and with
+# --parallel each system is simulated on its own event queue (and host
+# thread). The stats of each configuration end up under system<N> in the
+# stats file, and the configurations are listed in config.ini.
+#
+# Example:
+#   gem5.opt configs/example/trace_cache_sweep.py --trace mem.trc.gz \
+#       --sizes 16kB 32kB 64kB --assocs 4 8 --rp LRURP BRRIPRP --parallel
+
+import argparse
+import itertools
+
+import m5
+from m5.objects import *
+from m5.util import addToPath
+
+addToPath("../")
+from common import ObjectList
+
+parser = argparse.ArgumentParser(
+    description="Evaluate cache configurations on a packet trace"
+)
+parser.add_argument(
+    "--trace", required=True, help="Packet trace to replay (protobuf)"
+)
+parser.add_argument(
+    "--sizes", nargs="+", default=["32kB"], help="Cache sizes to evaluate"
+)
+parser.add_argument(
+    "--assocs",
+    nargs="+",
+    type=int,
+    default=[8],
+    help="Cache associativities to evaluate",
+)
+parser.add_argument(
+    "--rp",
+    nargs="+",
+    default=["LRURP"],
+    choices=ObjectList.rp_list.get_names(),
+    help="Replacement policies to evaluate",
+)
+parser.add_argument(
+    "--hwp",
+    nargs="+",
+    default=[],
+    choices=ObjectList.hwp_list.get_names() + ["None"],
+    help="Prefetchers to evaluate, None for no prefetcher. Prefetchers "
+    "are only active in timing mode, which is used as soon as any is "
+    "requested",
+)
+parser.add_argument(
+    "--cache-line-size", type=int, default=64, help="Cache line size"
+)
+parser.add_argument(
+    "--max-accesses",
+    type=int,
+    default=0,
+    help="Number of trace accesses to replay, 0 for the whole trace",
+)
+parser.add_argument(
+    "--parallel",
+    action="store_true",
+    help="Simulate each configuration on its own event queue",
+)
+parser.add_argument(
+    "--sim-quantum",
+    default="1us",
+    help="Synchronisation quantum of the event queues with --parallel",
+)
+
+args = parser.parse_args()
+
+prefetchers = [None if p == "None" else p for p in args.hwp] or [None]
+mem_mode = "timing" if any(prefetchers) else "atomic"
+
+configs = list(
+    itertools.product(args.sizes, args.assocs, args.rp, prefetchers)
+)
+
+systems = []
+for idx, (size, assoc, rp, hwp) in enumerate(configs):
+    system = System(
+        mem_mode=mem_mode,
+        cache_line_size=args.cache_line_size,
+        mem_ranges=[AddrRange("4GB")],
+    )
+    system.clk_domain = SrcClockDomain(
+        clock="2GHz", voltage_domain=VoltageDomain()
+    )
+
+    system.replayer = TraceReplayer(
+        trace_file=args.trace, max_accesses=args.max_accesses
+    )
+
+    system.cache = Cache(
+        size=size,
+        assoc=assoc,
+        tag_latency=2,
+        data_latency=2,
+        response_latency=2,
+        mshrs=16,
+        tgts_per_mshr=8,
+        replacement_policy=ObjectList.rp_list.get(rp)(),
+    )
+    if hwp:
+        system.cache.prefetcher = ObjectList.hwp_list.get(hwp)()
+
+    system.membus = SystemXBar()
+    system.mem = SimpleMemory(range=system.mem_ranges[0])
+
+    system.replayer.port = system.cache.cpu_side
+    system.cache.mem_side = system.membus.cpu_side_ports
+    system.mem.port = system.membus.mem_side_ports
+    system.system_port = system.membus.cpu_side_ports
+
+    # all children inherit the event queue of their system
+    if args.parallel:
+        system.eventq_index = idx
+
+    print(f"system{idx}: size={size} assoc={assoc} rp={rp} hwp={hwp}")
+    systems.append(system)
+
+root = Root(full_system=False, system=systems)
+if args.parallel and len(systems) > 1:
+    root.sim_quantum = m5.ticks.fromSeconds(
+        m5.util.convert.anyToLatency(args.sim_quantum)
+    )
+
+m5.instantiate()
+
+exit_event = m5.simulate()
+print(f"Exiting @ tick {m5.curTick()} because {exit_event.getCause()}")
@@ -43,6 +43,7 @@
 #include <cstdint>
 #include <iterator>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace gem5
@@ -73,7 +74,7 @@ class CircularQueue
 
     using reference = typename std::vector<T>::reference;
     using const_reference = typename std::vector<T>::const_reference;
-    const size_t _capacity;
+    size_t _capacity;
     size_t _size = 0;
     size_t _head = 1;
 
@@ -460,6 +461,28 @@ class CircularQueue
      */
     size_t capacity() const { return _capacity; }
 
+    /**
+     * Increases the capacity of the queue. The elements keep their
+     * indices, so iterators to them remain valid.
+     *
+     * @param new_capacity The new capacity; ignored if it is not larger
+     * than the current one.
+     *
+     * @ingroup api_base_utils
+     */
+    void
+    reserve(size_t new_capacity)
+    {
+        if (new_capacity <= _capacity)
+            return;
+
+        std::vector<T> new_data(new_capacity);
+        for (size_t idx = _head; idx < _head + _size; ++idx)
+            new_data[idx % new_capacity] = std::move(data[idx % _capacity]);
+        data = std::move(new_data);
+        _capacity = new_capacity;
+    }
+
     /**
      * @ingroup api_base_utils
      */
@@ -265,3 +265,43 @@ TEST(CircularQueueTest, MultipleRound)
 
     ASSERT_EQ(ending_it - starting_it, cq_size);
 }
+
+/**
+ * Testing that growing the queue keeps its elements, their indices and
+ * iterators to them, even when the elements wrap around the storage.
+ */
+TEST(CircularQueueTest, Reserve)
+{
+    const auto cq_size = 4;
+    CircularQueue<uint32_t> cq(cq_size);
+
+    // Make the queue wrap around before growing it
+    for (auto idx = 0; idx < cq_size + 2; idx++) {
+        cq.push_back(idx);
+    }
+
+    auto head_idx = cq.head();
+    auto it = cq.begin() + 1;
+
+    cq.reserve(cq_size * 2);
+
+    ASSERT_EQ(cq.capacity(), cq_size * 2);
+    ASSERT_EQ(cq.size(), cq_size);
+    ASSERT_EQ(cq.head(), head_idx);
+    ASSERT_EQ(*it, 3);
+    for (auto idx = 0; idx < cq_size; idx++) {
+        ASSERT_EQ(cq[head_idx + idx], idx + 2);
+    }
+
+    // The queue can now hold more elements without overwriting the head
+    for (auto idx = 0; idx < cq_size; idx++) {
+        cq.push_back(cq_size + 2 + idx);
+    }
+    ASSERT_TRUE(cq.full());
+    ASSERT_EQ(cq.front(), 2);
+    ASSERT_EQ(cq.back(), cq_size * 2 + 1);
+
+    // Shrinking is not supported
+    cq.reserve(cq_size);
+    ASSERT_EQ(cq.capacity(), cq_size * 2);
+}
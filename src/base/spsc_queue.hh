@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_SPSC_QUEUE_HH__
+#define __BASE_SPSC_QUEUE_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+/**
+ * A bounded, lock-free queue connecting exactly one producer thread
+ * with exactly one consumer thread.
+ *
+ * The producer only ever writes the tail index and the consumer only
+ * ever writes the head index, so neither side needs a lock or an
+ * atomic read-modify-write operation. Each side keeps a cached copy of
+ * the other side's index, and only reloads it when the queue appears
+ * to be full (producer) or empty (consumer), which keeps the shared
+ * cache lines from bouncing between the two threads on every access.
+ *
+ * The capacity is rounded up to the next power of two. Elements are
+ * constructed in place when pushed and destroyed when popped, so T
+ * need not be default constructible.
+ */
+template <typename T>
+class SPSCQueue
+{
+  private:
+    /** Assumed host cache line size, used to avoid false sharing. */
+    static constexpr std::size_t CacheLineSize = 64;
+
+    /** Mask used to map the free-running indices to buffer slots. */
+    const std::size_t mask;
+
+    /** Storage for one element, which only holds one while queued. */
+    struct Slot
+    {
+        alignas(T) unsigned char bytes[sizeof(T)];
+
+        T &get() { return *std::launder(reinterpret_cast<T *>(bytes)); }
+    };
+
+    std::unique_ptr<Slot[]> buffer;
+
+    /** Index of the next element to pop, written by the consumer. */
+    alignas(CacheLineSize) std::atomic<std::size_t> head;
+
+    /** The consumer's view of the tail index. */
+    std::size_t cachedTail;
+
+    /** Index of the next slot to push to, written by the producer. */
+    alignas(CacheLineSize) std::atomic<std::size_t> tail;
+
+    /** The producer's view of the head index. */
+    std::size_t cachedHead;
+
+  public:
+    /**
+     * @param capacity Minimum number of elements the queue can hold
+     */
+    explicit SPSCQueue(std::size_t capacity)
+        : mask((std::size_t(1) << ceilLog2(capacity < 2 ? 2 : capacity)) - 1),
+          buffer(new Slot[mask + 1]), head(0), cachedTail(0), tail(0),
+          cachedHead(0)
+    {
+    }
+
+    ~SPSCQueue()
+    {
+        const std::size_t t = tail.load(std::memory_order_acquire);
+        for (std::size_t h = head.load(std::memory_order_acquire); h != t;
+                ++h) {
+            buffer[h & mask].get().~T();
+        }
+    }
+
+    SPSCQueue(const SPSCQueue &) = delete;
+    SPSCQueue &operator=(const SPSCQueue &) = delete;
+
+    /** Maximum number of elements in the queue. */
+    std::size_t capacity() const { return mask + 1; }
+
+    /**
+     * Number of elements in the queue. This is only a snapshot if
+     * called while the other side is active.
+     */
+    std::size_t
+    size() const
+    {
+        return tail.load(std::memory_order_acquire) -
+            head.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+
+    /**
+     * Append an element to the queue. Must only be called by the
+     * producer.
+     *
+     * @param val Element to append
+     * @return False if the queue was full
+     */
+    bool
+    tryPush(const T &val)
+    {
+        const std::size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cachedHead == capacity()) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t - cachedHead == capacity())
+                return false;
+        }
+        new (buffer[t & mask].bytes) T(val);
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Remove the element at the head of the queue. Must only be called
+     * by the consumer.
+     *
+     * @param val Destination of the element
+     * @return False if the queue was empty
+     */
+    bool
+    tryPop(T &val)
+    {
+        const std::size_t h = head.load(std::memory_order_relaxed);
+        if (h == cachedTail) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h == cachedTail)
+                return false;
+        }
+        T &elem = buffer[h & mask].get();
+        val = std::move(elem);
+        elem.~T();
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Pass all elements currently in the queue, up to a limit, to a
+     * function and remove them. The slots are only released to the
+     * producer once the whole batch has been processed. Must only be
+     * called by the consumer.
+     *
+     * @param func Function called with a reference to each element
+     * @param limit Maximum number of elements to process
+     * @return Number of elements processed
+     */
+    template <typename F>
+    std::size_t
+    consume(F &&func, std::size_t limit = ~std::size_t(0))
+    {
+        const std::size_t h = head.load(std::memory_order_relaxed);
+        cachedTail = tail.load(std::memory_order_acquire);
+        std::size_t n = cachedTail - h;
+        if (n > limit)
+            n = limit;
+        for (std::size_t i = 0; i < n; ++i) {
+            T &elem = buffer[(h + i) & mask].get();
+            func(elem);
+            elem.~T();
+        }
+        if (n)
+            head.store(h + n, std::memory_order_release);
+        return n;
+    }
+};
+
+} // namespace gem5
+
+#endif // __BASE_SPSC_QUEUE_HH__
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "base/spsc_queue.hh"
+
+using namespace gem5;
+
+/** The capacity is rounded up to a power of two */
+TEST(SPSCQueueTest, Capacity)
+{
+    SPSCQueue<int> q(5);
+    ASSERT_EQ(q.capacity(), 8);
+    ASSERT_TRUE(q.empty());
+}
+
+/** Elements come out in order, and a full queue rejects pushes */
+TEST(SPSCQueueTest, PushPop)
+{
+    SPSCQueue<int> q(4);
+    for (int i = 0; i < 4; ++i)
+        ASSERT_TRUE(q.tryPush(i));
+    ASSERT_FALSE(q.tryPush(4));
+    ASSERT_EQ(q.size(), 4);
+
+    int val;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(q.tryPop(val));
+        ASSERT_EQ(val, i);
+    }
+    ASSERT_FALSE(q.tryPop(val));
+    ASSERT_TRUE(q.empty());
+}
+
+/** Consuming a batch respects the limit and frees the slots */
+TEST(SPSCQueueTest, Consume)
+{
+    SPSCQueue<int> q(8);
+    for (int i = 0; i < 6; ++i)
+        ASSERT_TRUE(q.tryPush(i));
+
+    int sum = 0;
+    ASSERT_EQ(q.consume([&sum](int v) { sum += v; }, 4), 4);
+    ASSERT_EQ(sum, 0 + 1 + 2 + 3);
+    ASSERT_EQ(q.size(), 2);
+
+    ASSERT_EQ(q.consume([&sum](int v) { sum += v; }), 2);
+    ASSERT_EQ(sum, 15);
+    ASSERT_EQ(q.consume([&sum](int v) { sum += v; }), 0);
+}
+
+namespace
+{
+
+/** An element that cannot be default constructed, and counts its copies */
+class Counted
+{
+  public:
+    explicit Counted(int _val) : val(_val) { ++live; }
+    Counted(const Counted &other) : val(other.val) { ++live; }
+    Counted &operator=(const Counted &other) = default;
+    ~Counted() { --live; }
+
+    int val;
+    static int live;
+};
+
+int Counted::live = 0;
+
+} // anonymous namespace
+
+/** Elements only exist while they are queued */
+TEST(SPSCQueueTest, NotDefaultConstructible)
+{
+    {
+        SPSCQueue<Counted> q(4);
+        ASSERT_EQ(Counted::live, 0);
+
+        for (int i = 0; i < 3; ++i)
+            ASSERT_TRUE(q.tryPush(Counted(i)));
+        ASSERT_EQ(Counted::live, 3);
+
+        Counted val(-1);
+        ASSERT_TRUE(q.tryPop(val));
+        ASSERT_EQ(val.val, 0);
+        ASSERT_EQ(Counted::live, 3);
+
+        ASSERT_EQ(q.consume([](const Counted &c) { EXPECT_EQ(c.val, 1); },
+                            1), 1);
+        ASSERT_EQ(Counted::live, 2);
+
+        // The remaining element is destroyed with the queue
+        ASSERT_TRUE(q.tryPush(Counted(3)));
+        ASSERT_EQ(Counted::live, 3);
+    }
+    ASSERT_EQ(Counted::live, 0);
+}
+
+/** A producer and a consumer thread exchange a long sequence */
+TEST(SPSCQueueTest, Threaded)
+{
+    const uint64_t count = 100000;
+    SPSCQueue<uint64_t> q(64);
+
+    std::thread producer([&q, count]() {
+        for (uint64_t i = 0; i < count; ++i) {
+            while (!q.tryPush(i))
+                std::this_thread::yield();
+        }
+    });
+
+    uint64_t expected = 0;
+    bool in_order = true;
+    while (expected < count) {
+        auto n = q.consume([&](uint64_t v) {
+            in_order = in_order && v == expected;
+            ++expected;
+        });
+        if (!n)
+            std::this_thread::yield();
+    }
+    producer.join();
+
+    ASSERT_TRUE(in_order);
+    ASSERT_TRUE(q.empty());
+}
@@ -112,6 +112,7 @@ class InfoProxy : public Base
         visitor.visit(*static_cast<Base *>(this));
     }
     bool zero() const { return s.zero(); }
+    std::size_t memoryUsage() const { return sizeof(*this) + s.memoryUsage(); }
 };
 
 template <class Stat>
@@ -159,6 +160,14 @@ class DistInfoProxy : public InfoProxy<Stat, DistInfo>
 {
   public:
     DistInfoProxy(Stat &stat) : InfoProxy<Stat, DistInfo>(stat) {}
+
+    std::size_t
+    memoryUsage() const
+    {
+        // Include the copy of the buckets that is prepared for dumping
+        return InfoProxy<Stat, DistInfo>::memoryUsage() +
+            this->data.cvec.capacity() * sizeof(Counter);
+    }
 };
 
 template <class Stat>
@@ -168,6 +177,16 @@ class VectorDistInfoProxy : public InfoProxy<Stat, VectorDistInfo>
     VectorDistInfoProxy(Stat &stat) : InfoProxy<Stat, VectorDistInfo>(stat) {}
 
     size_type size() const { return this->s.size(); }
+
+    std::size_t
+    memoryUsage() const
+    {
+        // Include the copies of the buckets that are prepared for dumping
+        std::size_t usage = InfoProxy<Stat, VectorDistInfo>::memoryUsage();
+        for (const auto &d : this->data)
+            usage += sizeof(d) + d.cvec.capacity() * sizeof(Counter);
+        return usage;
+    }
 };
 
 template <class Stat>
@@ -251,6 +270,12 @@ class DataWrap : public InfoAccess
     DataWrap(const DataWrap &) = delete;
     DataWrap &operator=(const DataWrap &) = delete;
 
+    /**
+     * Return the bytes of host memory used by the stat. Stats that
+     * allocate their storage separately add it to this.
+     */
+    std::size_t memoryUsage() const { return sizeof(Derived); }
+
     DataWrap(Group *parent, const char *name, const units::Base *unit,
              const char *desc)
     {
@@ -1030,6 +1055,16 @@ class VectorBase : public DataWrapVec<Derived, VectorInfoProxy>
         }
     }
 
+    std::size_t
+    memoryUsage() const
+    {
+        std::size_t usage = sizeof(Derived) +
+            storage.capacity() * sizeof(Storage *);
+        for (auto *stor : storage)
+            usage += stor->memoryUsage();
+        return usage;
+    }
+
     /**
      * Set this vector to have the given size.
      * @param size The new size.
@@ -1169,6 +1204,16 @@ class Vector2dBase : public DataWrapVec2d<Derived, Vector2dInfoProxy>
         }
     }
 
+    std::size_t
+    memoryUsage() const
+    {
+        std::size_t usage = sizeof(Derived) +
+            storage.capacity() * sizeof(Storage *);
+        for (auto *stor : storage)
+            usage += stor->memoryUsage();
+        return usage;
+    }
+
     Derived &
     init(size_type _x, size_type _y)
     {
@@ -1357,6 +1402,15 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
      *  Add the argument distribution to the this distribution.
      */
     void add(DistBase &d) { data()->add(d.data()); }
+
+    std::size_t
+    memoryUsage() const
+    {
+        std::size_t usage = sizeof(Derived);
+        if (this->info()->flags.isSet(init))
+            usage += data()->memoryUsage() - sizeof(Storage);
+        return usage;
+    }
 };
 
 template <class Stat>
@@ -1417,6 +1471,16 @@ class VectorDistBase : public DataWrapVec<Derived, VectorDistInfoProxy>
         }
     }
 
+    std::size_t
+    memoryUsage() const
+    {
+        std::size_t usage = sizeof(Derived) +
+            storage.capacity() * sizeof(Storage *);
+        for (auto *stor : storage)
+            usage += stor->memoryUsage();
+        return usage;
+    }
+
     Proxy operator[](off_type index)
     {
         assert(index < size());
@@ -2489,6 +2553,15 @@ class SparseHistBase : public DataWrap<Derived, SparseHistInfoProxy>
     {
         data()->reset(this->info()->getStorageParams());
     }
+
+    std::size_t
+    memoryUsage() const
+    {
+        std::size_t usage = sizeof(Derived);
+        if (this->info()->flags.isSet(init))
+            usage += data()->memoryUsage() - sizeof(Storage);
+        return usage;
+    }
 };
 
 class SparseHistogram : public SparseHistBase<SparseHistogram, SparseHistStor>
@@ -84,15 +84,43 @@ Group::regStats()
 
 void
 Group::resetStats()
+{
+    preResetStats();
+    resetAllStats();
+    postResetStats();
+}
+
+void
+Group::resetAllStats()
 {
     for (auto &s : stats)
         s->reset();
 
     for (auto &g : mergedStatGroups)
-        g->resetStats();
+        g->resetAllStats();
+
+    for (auto &g : statGroups)
+        g.second->resetAllStats();
+}
+
+void
+Group::preResetStats()
+{
+    for (auto &g : mergedStatGroups)
+        g->preResetStats();
+
+    for (auto &g : statGroups)
+        g.second->preResetStats();
+}
+
+void
+Group::postResetStats()
+{
+    for (auto &g : mergedStatGroups)
+        g->postResetStats();
 
     for (auto &g : statGroups)
-        g.second->resetStats();
+        g.second->postResetStats();
 }
 
 void
@@ -141,9 +141,31 @@ class Group
     /**
      * Callback to reset stats.
      *
+     * Resets the stats of this group and its sub-groups, with calls to
+     * preResetStats() before and postResetStats() after. Objects that
+     * keep state along with their stats should override those instead,
+     * as statistics::resetParallel() resets the stats without calling
+     * this.
+     *
+     * @ingroup api_stats
+     */
+    void resetStats();
+
+    /**
+     * Callback before stats are reset. This can be overridden by
+     * objects that need to bring their stats up to date first.
+     *
      * @ingroup api_stats
      */
-    virtual void resetStats();
+    virtual void preResetStats();
+
+    /**
+     * Callback after stats are reset. This can be overridden by objects
+     * that need to reset state kept along with their stats.
+     *
+     * @ingroup api_stats
+     */
+    virtual void postResetStats();
 
     /**
      * Callback before stats are dumped. This can be overridden by
@@ -212,6 +234,9 @@ class Group
     void mergeStatGroup(Group *block);
 
   private:
+    /** Reset the stats of this group and its sub-groups. */
+    void resetAllStats();
+
     /** Parent pointer if merged into parent */
     Group *mergedParent;
 
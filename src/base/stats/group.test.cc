@@ -522,6 +522,57 @@ TEST(StatsGroupTest, PreDumpStats)
     ASSERT_EQ(node1_2.value, 5);
 }
 
+/**
+ * Test that resetting the stats calls preResetStats and postResetStats of
+ * all sub-groups and merged groups, before and after resetting the stats.
+ */
+TEST(StatsGroupTest, ResetStatsCallbacks)
+{
+    class TestGroup : public statistics::Group
+    {
+      public:
+        TestGroup(statistics::Group *parent, const char *name = nullptr)
+          : statistics::Group(parent, name)
+        {
+            info.setName(std::string("InfoResetCallbacks") +
+                         (name ? name : "Merged"));
+            info.value = 1;
+            addStat(&info);
+        }
+
+        DummyInfo info;
+        int valueBefore = -1;
+        int valueAfter = -1;
+
+        void
+        preResetStats() override
+        {
+            valueBefore = info.value;
+            statistics::Group::preResetStats();
+        }
+
+        void
+        postResetStats() override
+        {
+            valueAfter = info.value;
+            statistics::Group::postResetStats();
+        }
+    };
+
+    TestGroup root(nullptr, "Root");
+    TestGroup node1(&root, "Node1");
+    TestGroup node1_1(&node1, "Node1_1");
+    TestGroup node1_2(&node1_1);
+
+    node1.resetStats();
+    ASSERT_EQ(root.valueBefore, -1);
+    ASSERT_EQ(root.valueAfter, -1);
+    for (auto *group : {&node1, &node1_1, &node1_2}) {
+        ASSERT_EQ(group->valueBefore, 1);
+        ASSERT_EQ(group->valueAfter, 0);
+    }
+}
+
 /** Test that resolving a non-existent stat returns a nullptr. */
 TEST(StatsGroupTest, ResolveStatNone)
 {
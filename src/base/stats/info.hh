@@ -29,6 +29,7 @@
 #ifndef __BASE_STATS_INFO_HH__
 #define __BASE_STATS_INFO_HH__
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -161,6 +162,12 @@ class Info
      */
     virtual void visit(Output &visitor) = 0;
 
+    /**
+     * Return the bytes of host memory used by the stat, including its
+     * storage, or 0 if the stat does not keep track of it.
+     */
+    virtual std::size_t memoryUsage() const { return 0; }
+
     /**
      * Checks if the first stat's name is alphabetically less than the second.
      * This function breaks names up at periods and considers each subname
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/parallel.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+#include "base/stats/group.hh"
+#include "base/stats/info.hh"
+#include "base/stats/text.hh"
+#include "sim/cur_tick.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+unsigned threadCount = 0;
+
+/**
+ * Call a function for each index in [0, count), spreading the calls
+ * over the stats threads. The indices are handed out one at a time so
+ * that partitions of uneven cost are balanced across the threads. The
+ * threads share the current tick and event queue of the caller, which
+ * stats such as averages and functors use while being processed.
+ */
+template <typename F>
+void
+parallelFor(std::size_t count, F &&func)
+{
+    const std::size_t threads = std::min<std::size_t>(
+        parallelThreads(), count);
+    if (threads <= 1) {
+        for (std::size_t i = 0; i < count; ++i)
+            func(i);
+        return;
+    }
+
+    Tick *const tick = Gem5Internal::_curTickPtr;
+    EventQueue *const queue = curEventQueue();
+
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < count; i = next++)
+            func(i);
+    };
+
+    std::vector<std::thread> pool;
+    for (std::size_t i = 1; i < threads; ++i) {
+        pool.emplace_back([&]() {
+            Gem5Internal::_curTickPtr = tick;
+            _curEventQueue = queue;
+            worker();
+        });
+    }
+    worker();
+    for (auto &thread : pool)
+        thread.join();
+}
+
+/** Number of stats in a partition, used as its cost. */
+std::size_t
+weight(Group &group, bool recursive, std::map<Group *, std::size_t> &memo)
+{
+    if (!recursive)
+        return group.getStats().size();
+
+    auto it = memo.find(&group);
+    if (it != memo.end())
+        return it->second;
+
+    std::size_t total = group.getStats().size();
+    for (auto &g : group.getStatGroups())
+        total += weight(*g.second, true, memo);
+    memo[&group] = total;
+    return total;
+}
+
+/** Call a function for each stat of the partitions. */
+template <typename F>
+void
+forEachStat(Group &root, F &&func)
+{
+    const auto partitions = partitionGroups(root, parallelThreads() * 8);
+    parallelFor(partitions.size(), [&](std::size_t i) {
+        std::vector<Group *> groups = {partitions[i].group};
+        while (!groups.empty()) {
+            Group *group = groups.back();
+            groups.pop_back();
+            for (auto *info : group->getStats())
+                func(*info);
+            if (partitions[i].recursive) {
+                for (auto &g : group->getStatGroups())
+                    groups.push_back(g.second);
+            }
+        }
+    });
+}
+
+/** The values of a formula, evaluated before a parallel dump. */
+struct FormulaResult
+{
+    VResult result;
+    Result total;
+    bool zero;
+};
+
+typedef std::unordered_map<const Info *, FormulaResult> FormulaResults;
+
+/**
+ * Evaluate a formula, unless it already was. Formulas cache their
+ * intermediate results in their nodes, which may be shared with other
+ * formulas, and read the result caches of the stats they refer to, so
+ * they must not be evaluated concurrently with the other stats.
+ */
+void
+evaluateFormula(const Info *info, FormulaResults &results)
+{
+    auto *formula = dynamic_cast<const FormulaInfo *>(info);
+    if (!formula || results.count(formula))
+        return;
+
+    FormulaResult &result = results[formula];
+    result.result = formula->result();
+    result.total = formula->total();
+    result.zero = formula->zero();
+}
+
+/** Evaluate the formulas of a tree, and those used as prerequisites. */
+void
+evaluateFormulas(Group &group, FormulaResults &results)
+{
+    for (auto *info : group.getStats()) {
+        evaluateFormula(info, results);
+        evaluateFormula(info->prereq, results);
+    }
+
+    for (auto &g : group.getStatGroups())
+        evaluateFormulas(*g.second, results);
+}
+
+/**
+ * A text output for a partition of a parallel dump, which renders
+ * formulas, and checks prerequisites that are formulas, using values
+ * evaluated beforehand.
+ */
+class PartitionText : public Text
+{
+  private:
+    const FormulaResults &formulas;
+
+  protected:
+    bool
+    noOutput(const Info &info) override
+    {
+        auto it = info.prereq ? formulas.find(info.prereq) : formulas.end();
+        if (it == formulas.end())
+            return Text::noOutput(info);
+        return !info.flags.isSet(display) || it->second.zero;
+    }
+
+  public:
+    PartitionText(std::ostream &stream, const Text &settings,
+                  const FormulaResults &formulas_)
+      : Text(stream), formulas(formulas_)
+    {
+        descriptions = settings.descriptions;
+        enableUnits = settings.enableUnits;
+        spaces = settings.spaces;
+    }
+
+    void
+    visit(const FormulaInfo &info) override
+    {
+        if (noOutput(info))
+            return;
+
+        const FormulaResult &result = formulas.at(&info);
+        printVector(info, result.result, result.total);
+    }
+};
+
+} // anonymous namespace
+
+unsigned
+parallelThreads()
+{
+    if (threadCount)
+        return threadCount;
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void
+setParallelThreads(unsigned threads)
+{
+    threadCount = threads;
+}
+
+std::vector<Partition>
+partitionGroups(Group &root, std::size_t count)
+{
+    std::map<Group *, std::size_t> memo;
+    std::vector<Partition> partitions = {{{}, &root, true}};
+
+    while (partitions.size() < count) {
+        // Split the largest subtree that has subgroups.
+        auto largest = partitions.end();
+        std::size_t largest_weight = 0;
+        for (auto it = partitions.begin(); it != partitions.end(); ++it) {
+            if (!it->recursive || it->group->getStatGroups().empty())
+                continue;
+            const std::size_t w = weight(*it->group, true, memo);
+            if (largest == partitions.end() || w > largest_weight) {
+                largest = it;
+                largest_weight = w;
+            }
+        }
+        if (largest == partitions.end())
+            break;
+
+        largest->recursive = false;
+        std::vector<Partition> children;
+        for (auto &g : largest->group->getStatGroups()) {
+            children.push_back({largest->path, g.second, true});
+            children.back().path.push_back(g.first);
+        }
+        partitions.insert(largest + 1, children.begin(), children.end());
+    }
+
+    return partitions;
+}
+
+void
+visitGroup(Output &output, Group &group, bool recursive)
+{
+    for (auto *info : group.getStats())
+        info->visit(output);
+
+    if (!recursive)
+        return;
+
+    for (auto &g : group.getStatGroups()) {
+        output.beginGroup(g.first.c_str());
+        visitGroup(output, *g.second, true);
+        output.endGroup();
+    }
+}
+
+void
+prepareParallel(Group &root)
+{
+    forEachStat(root, [](Info &info) { info.prepare(); });
+}
+
+void
+resetParallel(Group &root)
+{
+    root.preResetStats();
+    forEachStat(root, [](Info &info) { info.reset(); });
+    root.postResetStats();
+}
+
+bool
+dumpParallel(Output &output, Group &root,
+             const std::vector<std::string> &path)
+{
+    auto *text = dynamic_cast<Text *>(&output);
+    if (!text)
+        return false;
+
+    FormulaResults formulas;
+    evaluateFormulas(root, formulas);
+
+    const auto partitions = partitionGroups(root, parallelThreads() * 8);
+    std::vector<std::string> buffers(partitions.size());
+    parallelFor(partitions.size(), [&](std::size_t i) {
+        std::ostringstream stream;
+        PartitionText part(stream, *text, formulas);
+
+        for (const auto &name : path)
+            part.beginGroup(name.c_str());
+        for (const auto &name : partitions[i].path)
+            part.beginGroup(name.c_str());
+        visitGroup(part, *partitions[i].group, partitions[i].recursive);
+
+        buffers[i] = stream.str();
+    });
+
+    for (const auto &buffer : buffers)
+        text->write(buffer);
+    return true;
+}
+
+} // namespace statistics
+} // namespace gem5
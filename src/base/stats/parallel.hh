@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_PARALLEL_HH__
+#define __BASE_STATS_PARALLEL_HH__
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+class Group;
+class Output;
+
+/**
+ * A part of a stats tree that can be processed independently of the
+ * others. Dumping the partitions of a tree one after the other, in
+ * order, gives the same output as dumping the whole tree.
+ */
+struct Partition
+{
+    /** Names of the groups leading from the root to the group. */
+    std::vector<std::string> path;
+    Group *group;
+    /** Whether the partition includes the subgroups of the group. */
+    bool recursive;
+};
+
+/**
+ * Number of host threads used to process the stats, which defaults to
+ * the number of host cores.
+ */
+unsigned parallelThreads();
+
+/**
+ * Set the number of host threads used to process the stats.
+ *
+ * @param threads Number of threads, 0 for the number of host cores
+ */
+void setParallelThreads(unsigned threads);
+
+/**
+ * Split a stats tree into partitions of similar size, by repeatedly
+ * splitting the largest subtree into the group itself and each of its
+ * subgroups.
+ *
+ * @param root Root of the tree
+ * @param count Number of partitions to aim for
+ */
+std::vector<Partition> partitionGroups(Group &root, std::size_t count);
+
+/** Visit the stats of a group, and those of its subgroups if recursive. */
+void visitGroup(Output &output, Group &group, bool recursive);
+
+/** Prepare the stats of a tree for dumping, in parallel. */
+void prepareParallel(Group &root);
+
+/**
+ * Reset the stats of a tree in parallel. The preResetStats() and
+ * postResetStats() callbacks of the groups are called before and after,
+ * but resetStats() is not called.
+ */
+void resetParallel(Group &root);
+
+/**
+ * Dump a stats tree, rendering the partitions of the tree in parallel
+ * into buffers that are then written out in order. Evaluating formulas
+ * is not thread safe, so they are evaluated on the calling thread
+ * first, and rendered in parallel from the evaluated values. Only
+ * supported by text outputs.
+ *
+ * @param output Output to dump to
+ * @param root Root of the tree
+ * @param path Names of the groups leading to the root
+ * @return false if the output does not support parallel dumps
+ */
+bool dumpParallel(Output &output, Group &root,
+                  const std::vector<std::string> &path);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_PARALLEL_HH__
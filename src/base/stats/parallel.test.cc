@@ -0,0 +1,501 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/stats/group.hh"
+#include "base/stats/info.hh"
+#include "base/stats/output.hh"
+#include "base/stats/parallel.hh"
+#include "base/stats/storage.hh"
+#include "base/stats/text.hh"
+#include "sim/cur_tick.hh"
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+class TestScalar : public statistics::ScalarInfo
+{
+  public:
+    statistics::Counter count = 0;
+
+    TestScalar(statistics::Group *parent, const std::string &name)
+    {
+        setName(name, false);
+        flags.set(statistics::init | statistics::display);
+        parent->addStat(this);
+    }
+
+    statistics::Counter value() const override { return count; }
+    statistics::Result result() const override { return count; }
+    statistics::Result total() const override { return count; }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override { count = 0; }
+    bool zero() const override { return count == 0; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+};
+
+class TestVector : public statistics::VectorInfo
+{
+  public:
+    statistics::VCounter counts;
+    mutable statistics::VResult results;
+
+    TestVector(statistics::Group *parent, const std::string &name,
+               statistics::size_type size)
+      : counts(size, 0)
+    {
+        setName(name, false);
+        flags.set(statistics::init | statistics::display |
+                  statistics::total);
+        parent->addStat(this);
+    }
+
+    statistics::size_type size() const override { return counts.size(); }
+    const statistics::VCounter &value() const override { return counts; }
+
+    const statistics::VResult &
+    result() const override
+    {
+        results.assign(counts.begin(), counts.end());
+        return results;
+    }
+
+    statistics::Result
+    total() const override
+    {
+        statistics::Result sum = 0;
+        for (auto count : counts)
+            sum += count;
+        return sum;
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override { counts.assign(counts.size(), 0); }
+    bool zero() const override { return total() == 0; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+};
+
+/**
+ * A formula evaluated by the nodes of statistics::Formula, which cache
+ * their results and may be shared with other formulas.
+ */
+class TestFormula : public statistics::FormulaInfo
+{
+  public:
+    statistics::NodePtr root;
+    statistics::VCounter counts;
+    mutable statistics::VResult results;
+
+    TestFormula(statistics::Group *parent, const std::string &name,
+                statistics::NodePtr node)
+      : root(node)
+    {
+        setName(name, false);
+        flags.set(statistics::init | statistics::display);
+        parent->addStat(this);
+    }
+
+    statistics::size_type size() const override { return root->size(); }
+    const statistics::VCounter &value() const override { return counts; }
+
+    const statistics::VResult &
+    result() const override
+    {
+        results = root->result();
+        return results;
+    }
+
+    statistics::Result total() const override { return root->total(); }
+    std::string str() const override { return root->str(); }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override {}
+    bool zero() const override { return total() == 0; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+};
+
+/** An average over time, stored like that of statistics::Average. */
+class TestAverage : public statistics::ScalarInfo
+{
+  public:
+    statistics::AvgStor data;
+
+    TestAverage(statistics::Group *parent, const std::string &name)
+      : data(nullptr)
+    {
+        setName(name, false);
+        flags.set(statistics::init | statistics::display);
+        parent->addStat(this);
+    }
+
+    statistics::Counter value() const override { return data.value(); }
+    statistics::Result result() const override { return data.result(); }
+    statistics::Result total() const override { return data.result(); }
+
+    bool check() const override { return true; }
+    void prepare() override { data.prepare(nullptr); }
+    void reset() override { data.reset(nullptr); }
+    bool zero() const override { return data.zero(); }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+};
+
+/** A stat whose value is computed by a function when it is rendered. */
+class TestFunctor
+    : public statistics::FunctorProxy<std::function<statistics::Result()>>
+{
+  public:
+    TestFunctor(statistics::Group *parent, const std::string &name,
+                const std::function<statistics::Result()> &func)
+      : statistics::FunctorProxy<std::function<statistics::Result()>>(func)
+    {
+        setName(name, false);
+        flags.set(statistics::init | statistics::display);
+        parent->addStat(this);
+    }
+};
+
+/** A group with the kinds of stats typically found in a core. */
+struct CoreStats : public statistics::Group
+{
+    TestScalar insts;
+    TestScalar cycles;
+    TestVector opClass;
+
+    CoreStats(statistics::Group *parent, const std::string &name)
+      : statistics::Group(parent, name.c_str()),
+        insts(this, "insts"), cycles(this, "cycles"),
+        opClass(this, "opClass", 8)
+    {
+    }
+
+    void
+    sample(unsigned seed)
+    {
+        insts.count += seed * 3 + 1;
+        cycles.count += seed * 5 + 2;
+        for (unsigned i = 0; i < 8; ++i)
+            opClass.counts[i] += (seed + i) % 7;
+    }
+};
+
+/** A synthetic system of clusters of cores, each with a few caches. */
+struct SyntheticTree
+{
+    statistics::Group root;
+    std::vector<std::unique_ptr<statistics::Group>> clusters;
+    std::vector<std::unique_ptr<CoreStats>> cores;
+
+    SyntheticTree(unsigned num_clusters, unsigned cores_per_cluster)
+      : root(nullptr)
+    {
+        unsigned seed = 0;
+        for (unsigned c = 0; c < num_clusters; ++c) {
+            clusters.emplace_back(new statistics::Group(
+                &root, ("cluster" + std::to_string(c)).c_str()));
+            for (unsigned i = 0; i < cores_per_cluster; ++i) {
+                const std::string name = "cpu" + std::to_string(i);
+                cores.emplace_back(new CoreStats(clusters.back().get(),
+                                                 name));
+                CoreStats *core = cores.back().get();
+                core->sample(seed++);
+                for (const char *cache : {"icache", "dcache"}) {
+                    cores.emplace_back(new CoreStats(core, cache));
+                    cores.back()->sample(seed++);
+                }
+            }
+        }
+    }
+};
+
+/**
+ * A group with stats that depend on the current tick and event queue
+ * when they are prepared or rendered.
+ */
+struct TickStats : public statistics::Group
+{
+    TestAverage occupancy;
+    TestFunctor now;
+
+    TickStats(statistics::Group *parent, const std::string &name,
+              EventQueue *queue)
+      : statistics::Group(parent, name.c_str()),
+        occupancy(this, "occupancy"),
+        now(this, "now", [queue]() -> statistics::Result {
+            return curEventQueue() == queue ? curTick() : 0;
+        })
+    {
+    }
+};
+
+std::string
+dumpSequential(statistics::Group &root)
+{
+    std::ostringstream stream;
+    statistics::Text text(stream);
+    statistics::visitGroup(text, root, true);
+    return stream.str();
+}
+
+std::string
+dumpParallel(statistics::Group &root)
+{
+    std::ostringstream stream;
+    statistics::Text text(stream);
+    EXPECT_TRUE(statistics::dumpParallel(text, root, {}));
+    return stream.str();
+}
+
+} // anonymous namespace
+
+/** Test that partitioning visits each group exactly once, in order. */
+TEST(StatsParallelTest, PartitionCoversTree)
+{
+    SyntheticTree tree(4, 4);
+
+    for (std::size_t count : {1, 2, 7, 64, 1000}) {
+        const auto partitions = statistics::partitionGroups(tree.root,
+                                                            count);
+        ASSERT_FALSE(partitions.empty());
+        EXPECT_EQ(partitions.front().group, &tree.root);
+        if (count > 1) {
+            EXPECT_GT(partitions.size(), 1);
+        }
+
+        std::size_t stats = 0;
+        for (const auto &p : partitions) {
+            std::vector<statistics::Group *> groups = {p.group};
+            while (!groups.empty()) {
+                auto *group = groups.back();
+                groups.pop_back();
+                stats += group->getStats().size();
+                if (p.recursive) {
+                    for (auto &g : group->getStatGroups())
+                        groups.push_back(g.second);
+                }
+            }
+        }
+        EXPECT_EQ(stats, tree.cores.size() * 3);
+    }
+}
+
+/** Test that a parallel dump matches a sequential one. */
+TEST(StatsParallelTest, DumpMatchesSequential)
+{
+    SyntheticTree tree(3, 5);
+    statistics::prepareParallel(tree.root);
+
+    const std::string expected = dumpSequential(tree.root);
+    ASSERT_NE(expected.find("cluster2.cpu4.dcache.opClass"),
+              std::string::npos);
+
+    for (unsigned threads : {1, 2, 4}) {
+        statistics::setParallelThreads(threads);
+        EXPECT_EQ(dumpParallel(tree.root), expected);
+    }
+    statistics::setParallelThreads(0);
+}
+
+/**
+ * Test that a parallel dump matches a sequential one when formulas in
+ * different partitions share nodes and refer to stats in other
+ * partitions.
+ */
+TEST(StatsParallelTest, DumpSharedFormula)
+{
+    SyntheticTree tree(4, 4);
+
+    // The total number of instructions, shared by the formulas.
+    statistics::NodePtr total =
+        std::make_shared<statistics::ConstNode<int>>(0);
+    for (const auto &core : tree.cores) {
+        statistics::NodePtr insts =
+            std::make_shared<statistics::ScalarStatNode>(&core->insts);
+        total = std::make_shared<statistics::BinaryNode<std::plus<
+            statistics::Result>>>(total, insts);
+    }
+
+    std::vector<std::unique_ptr<TestFormula>> formulas;
+    for (const auto &core : tree.cores) {
+        statistics::NodePtr insts =
+            std::make_shared<statistics::ScalarStatNode>(&core->insts);
+        statistics::NodePtr share = std::make_shared<statistics::BinaryNode<
+            std::divides<statistics::Result>>>(insts, total);
+        formulas.emplace_back(new TestFormula(core.get(), "instShare",
+                                              share));
+        // Stats shown only when a formula is non-zero.
+        core->cycles.prereq = formulas.back().get();
+    }
+    // Hide the cycles of some of the cores.
+    for (std::size_t i = 0; i < tree.cores.size(); i += 3)
+        tree.cores[i]->insts.count = 0;
+
+    const std::string expected = dumpSequential(tree.root);
+    ASSERT_NE(expected.find("cluster3.cpu3.dcache.instShare"),
+              std::string::npos);
+    ASSERT_EQ(expected.find("cluster0.cpu0.cycles"), std::string::npos);
+    ASSERT_NE(expected.find("cluster0.cpu0.icache.cycles"),
+              std::string::npos);
+
+    for (unsigned threads : {2, 4, 8}) {
+        statistics::setParallelThreads(threads);
+        for (int i = 0; i < 10; ++i)
+            EXPECT_EQ(dumpParallel(tree.root), expected);
+    }
+    statistics::setParallelThreads(0);
+}
+
+/** Test that the path leading to the root prefixes the stat names. */
+TEST(StatsParallelTest, DumpWithPath)
+{
+    SyntheticTree tree(1, 1);
+
+    std::ostringstream stream;
+    statistics::Text text(stream);
+    ASSERT_TRUE(statistics::dumpParallel(text, tree.root, {"system"}));
+    EXPECT_NE(stream.str().find("system.cluster0.cpu0.insts"),
+              std::string::npos);
+}
+
+/** Test that a parallel reset zeroes all the stats. */
+TEST(StatsParallelTest, Reset)
+{
+    SyntheticTree tree(2, 3);
+    statistics::setParallelThreads(4);
+    statistics::resetParallel(tree.root);
+    statistics::setParallelThreads(0);
+
+    for (const auto &core : tree.cores) {
+        EXPECT_TRUE(core->insts.zero());
+        EXPECT_TRUE(core->cycles.zero());
+        EXPECT_TRUE(core->opClass.zero());
+    }
+}
+
+/**
+ * Test that a parallel reset calls the reset callbacks of the groups
+ * before and after resetting the stats.
+ */
+TEST(StatsParallelTest, ResetCallbacks)
+{
+    struct ResetCore : public CoreStats
+    {
+        using CoreStats::CoreStats;
+
+        statistics::Counter instsBefore = -1;
+        statistics::Counter instsAfter = -1;
+
+        void
+        preResetStats() override
+        {
+            instsBefore = insts.count;
+            CoreStats::preResetStats();
+        }
+
+        void
+        postResetStats() override
+        {
+            instsAfter = insts.count;
+            CoreStats::postResetStats();
+        }
+    };
+
+    statistics::Group root(nullptr);
+    statistics::Group cluster(&root, "cluster");
+    std::vector<std::unique_ptr<ResetCore>> cores;
+    for (unsigned i = 0; i < 16; ++i) {
+        cores.emplace_back(new ResetCore(&cluster,
+                                         "cpu" + std::to_string(i)));
+        cores.back()->sample(i);
+    }
+
+    statistics::setParallelThreads(4);
+    statistics::resetParallel(root);
+    statistics::setParallelThreads(0);
+
+    for (unsigned i = 0; i < cores.size(); ++i) {
+        EXPECT_EQ(cores[i]->instsBefore, i * 3 + 1);
+        EXPECT_EQ(cores[i]->instsAfter, 0);
+    }
+}
+
+/**
+ * Test that the stats threads see the tick and event queue of the
+ * thread that processes the stats, as averages and functors use them.
+ */
+TEST(StatsParallelTest, TickDependentStats)
+{
+    EventQueue *const old_queue = curEventQueue();
+    Tick *const old_tick = Gem5Internal::_curTickPtr;
+    EventQueue queue("parallel.test");
+    curEventQueue(&queue);
+
+    statistics::Group sequential(nullptr);
+    statistics::Group parallel(nullptr);
+    std::vector<std::unique_ptr<TickStats>> groups;
+    for (unsigned i = 0; i < 32; ++i) {
+        const std::string name = "queue" + std::to_string(i);
+        groups.emplace_back(new TickStats(&sequential, name, &queue));
+        groups.emplace_back(new TickStats(&parallel, name, &queue));
+    }
+
+    for (Tick tick = 0; tick < 100; tick += 10) {
+        queue.setCurTick(tick);
+        for (unsigned i = 0; i < groups.size(); ++i)
+            groups[i]->occupancy.data.set(i / 2 + tick);
+    }
+    queue.setCurTick(1000);
+
+    statistics::setParallelThreads(1);
+    statistics::prepareParallel(sequential);
+    const std::string expected = dumpSequential(sequential);
+    ASSERT_NE(expected.find("queue31.now"), std::string::npos);
+    ASSERT_NE(expected.find("1000"), std::string::npos);
+
+    statistics::setParallelThreads(4);
+    statistics::prepareParallel(parallel);
+    EXPECT_EQ(dumpParallel(parallel), expected);
+    statistics::setParallelThreads(0);
+
+    _curEventQueue = old_queue;
+    Gem5Internal::_curTickPtr = old_tick;
+}
@@ -42,6 +42,10 @@
 #include "base/stats/storage.hh"
 
 #include <cmath>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace gem5
 {
@@ -49,6 +53,91 @@ namespace gem5
 namespace statistics
 {
 
+namespace
+{
+
+/**
+ * The blocks the buckets of the distributions are allocated from. The
+ * buckets may be allocated by the event queue threads, so all accesses
+ * are serialised; this only happens once per stat.
+ */
+struct BucketBlocks
+{
+    /** Number of counters in a block. */
+    static constexpr size_type blockSize = 64 * 1024;
+
+    std::mutex lock;
+    std::vector<std::unique_ptr<Counter[]>> blocks;
+    /** Number of counters used in the last block. */
+    size_type used = blockSize;
+    /** Released buckets, by number of counters. */
+    std::unordered_map<size_type, std::vector<Counter *>> released;
+    /** Bytes allocated for all the blocks. */
+    std::size_t reserved = 0;
+};
+
+BucketBlocks &
+bucketBlocks()
+{
+    // Never destroyed, as stats may release their buckets after it would
+    // have been at exit.
+    static BucketBlocks *blocks = new BucketBlocks;
+    return *blocks;
+}
+
+} // anonymous namespace
+
+Counter *
+LazyBuckets::allocate(size_type count)
+{
+    auto &b = bucketBlocks();
+    std::lock_guard<std::mutex> guard(b.lock);
+
+    auto it = b.released.find(count);
+    if (it != b.released.end() && !it->second.empty()) {
+        Counter *buckets = it->second.back();
+        it->second.pop_back();
+        std::fill(buckets, buckets + count, Counter());
+        return buckets;
+    }
+
+    // Large distributions get a block of their own, leaving the current
+    // block to the smaller ones.
+    if (count > BucketBlocks::blockSize / 8) {
+        b.blocks.emplace(b.blocks.begin(), new Counter[count]());
+        b.reserved += count * sizeof(Counter);
+        return b.blocks.front().get();
+    }
+
+    if (b.used + count > BucketBlocks::blockSize) {
+        b.blocks.emplace_back(new Counter[BucketBlocks::blockSize]());
+        b.reserved += BucketBlocks::blockSize * sizeof(Counter);
+        b.used = 0;
+    }
+    Counter *buckets = b.blocks.back().get() + b.used;
+    b.used += count;
+    return buckets;
+}
+
+void
+LazyBuckets::release(Counter *buckets, size_type count)
+{
+    if (!buckets)
+        return;
+
+    auto &b = bucketBlocks();
+    std::lock_guard<std::mutex> guard(b.lock);
+    b.released[count].push_back(buckets);
+}
+
+std::size_t
+LazyBuckets::reservedMemory()
+{
+    auto &b = bucketBlocks();
+    std::lock_guard<std::mutex> guard(b.lock);
+    return b.reserved;
+}
+
 void
 DistStor::sample(Counter val, int number)
 {
@@ -153,6 +242,13 @@ HistStor::growDown()
 void
 HistStor::growUp()
 {
+    // Buckets that were never written to stay zero, only the range grows
+    if (!cvec.allocated()) {
+        max_bucket *= 2;
+        bucket_size *= 2;
+        return;
+    }
+
     int size = cvec.size();
     int half = (size + 1) / 2; // round up!
 
@@ -222,8 +318,11 @@ HistStor::add(HistStor *hs)
     while (bucket_size < hs->bucket_size)
         growUp();
 
-    for (uint32_t i = 0; i < b_size; i++)
-        cvec[i] += hs->cvec[i];
+    // Buckets that were never written to are all zero
+    if (hs->cvec.allocated()) {
+        for (uint32_t i = 0; i < b_size; i++)
+            cvec[i] += hs->cvec[i];
+    }
 }
 
 } // namespace statistics
@@ -30,8 +30,10 @@
 #ifndef __BASE_STATS_STORAGE_HH__
 #define __BASE_STATS_STORAGE_HH__
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 
 #include "base/cast.hh"
 #include "base/compiler.hh"
@@ -114,6 +116,9 @@ class StatStor
      * @return true if zero value
      */
     bool zero() const { return data == Counter(); }
+
+    /** Bytes of host memory used by this storage. */
+    std::size_t memoryUsage() const { return sizeof(*this); }
 };
 
 /**
@@ -192,6 +197,9 @@ class AvgStor
      */
     bool zero() const { return total == 0.0; }
 
+    /** Bytes of host memory used by this storage. */
+    std::size_t memoryUsage() const { return sizeof(*this); }
+
     /**
      * Prepare stat data for dumping or serialization
      */
@@ -222,6 +230,93 @@ struct DistParams : public StorageParams
     DistParams(DistType t) : type(t) {}
 };
 
+/**
+ * The buckets of a distribution, which are only allocated when they are
+ * first written to. Until then all the buckets read as zero, so stats
+ * that are never sampled only cost the size of this object.
+ *
+ * The buckets are carved out of large blocks shared by all the
+ * distributions, which avoids the overhead of a heap allocation per
+ * stat. Buckets that are released are reused by the next distribution
+ * with the same number of buckets.
+ */
+class LazyBuckets
+{
+  private:
+    /** The buckets, or nullptr if they have not been allocated yet. */
+    Counter *buckets;
+    /** The number of buckets. */
+    size_type count;
+
+    /** Allocate zeroed buckets from the shared blocks. */
+    static Counter *allocate(size_type count);
+    /** Return buckets to the shared blocks for reuse. */
+    static void release(Counter *buckets, size_type count);
+
+  public:
+    LazyBuckets(size_type count) : buckets(nullptr), count(count) {}
+    LazyBuckets(const LazyBuckets &) = delete;
+    LazyBuckets &operator=(const LazyBuckets &) = delete;
+    ~LazyBuckets() { release(buckets, count); }
+
+    /** Return the number of buckets. */
+    size_type size() const { return count; }
+
+    /** Return true if the buckets have been allocated. */
+    bool allocated() const { return buckets != nullptr; }
+
+    /** Read a bucket, which is zero if the buckets are not allocated. */
+    Counter
+    operator[](off_type index) const
+    {
+        assert(index < count);
+        return buckets ? buckets[index] : Counter();
+    }
+
+    /** Access a bucket for writing, allocating the buckets if needed. */
+    Counter &
+    operator[](off_type index)
+    {
+        assert(index < count);
+        if (!buckets)
+            buckets = allocate(count);
+        return buckets[index];
+    }
+
+    /**
+     * Copy the buckets into a vector, resizing it to fit, or leave it
+     * empty if the buckets are not allocated, as they are all zero.
+     */
+    void
+    copy(VCounter &vec) const
+    {
+        if (!buckets) {
+            vec.clear();
+            return;
+        }
+        vec.resize(count);
+        std::copy(buckets, buckets + count, vec.begin());
+    }
+
+    /** Set all the buckets to zero, keeping them allocated. */
+    void
+    clear()
+    {
+        if (buckets)
+            std::fill(buckets, buckets + count, Counter());
+    }
+
+    /** Bytes of host memory used by the buckets. */
+    std::size_t
+    memoryUsage() const
+    {
+        return buckets ? count * sizeof(Counter) : 0;
+    }
+
+    /** Bytes allocated for buckets, including those released for reuse. */
+    static std::size_t reservedMemory();
+};
+
 /**
  * Templatized storage and interface for a distribution stat. A distribution
  * uses buckets to keep track of values within a given range. All other
@@ -254,7 +349,7 @@ class DistStor
     /** The number of samples. */
     Counter samples;
     /** Counter for each bucket. */
-    VCounter cvec;
+    LazyBuckets cvec;
 
   public:
     /** The parameters for a distribution stat. */
@@ -313,6 +408,13 @@ class DistStor
         return samples == Counter();
     }
 
+    /** Bytes of host memory used by this storage. */
+    std::size_t
+    memoryUsage() const
+    {
+        return sizeof(*this) + cvec.memoryUsage();
+    }
+
     void
     prepare(const StorageParams* const storage_params, DistData &data)
     {
@@ -329,9 +431,8 @@ class DistStor
         data.underflow = underflow;
         data.overflow = overflow;
 
-        data.cvec.resize(params->buckets);
-        for (off_type i = 0; i < params->buckets; ++i)
-            data.cvec[i] = cvec[i];
+        data.buckets = cvec.size();
+        cvec.copy(data.cvec);
 
         data.sum = sum;
         data.squares = squares;
@@ -354,9 +455,7 @@ class DistStor
         underflow = Counter();
         overflow = Counter();
 
-        size_type size = cvec.size();
-        for (off_type i = 0; i < size; ++i)
-            cvec[i] = Counter();
+        cvec.clear();
 
         sum = Counter();
         squares = Counter();
@@ -414,7 +513,7 @@ class HistStor
     /** The number of samples. */
     Counter samples;
     /** Counter for each bucket. */
-    VCounter cvec;
+    LazyBuckets cvec;
 
     /**
      * Given a bucket size B, and a range of values [0, N], this function
@@ -505,6 +604,13 @@ class HistStor
         return samples == Counter();
     }
 
+    /** Bytes of host memory used by this storage. */
+    std::size_t
+    memoryUsage() const
+    {
+        return sizeof(*this) + cvec.memoryUsage();
+    }
+
     void
     prepare(const StorageParams* const storage_params, DistData &data)
     {
@@ -519,10 +625,8 @@ class HistStor
         data.min_val = min_bucket;
         data.max_val = max_bucket;
 
-        int buckets = params->buckets;
-        data.cvec.resize(buckets);
-        for (off_type i = 0; i < buckets; ++i)
-            data.cvec[i] = cvec[i];
+        data.buckets = cvec.size();
+        cvec.copy(data.cvec);
 
         data.sum = sum;
         data.logs = logs;
@@ -541,9 +645,7 @@ class HistStor
         max_bucket = params->buckets - 1;
         bucket_size = 1;
 
-        size_type size = cvec.size();
-        for (off_type i = 0; i < size; ++i)
-            cvec[i] = Counter();
+        cvec.clear();
 
         sum = Counter();
         squares = Counter();
@@ -606,6 +708,9 @@ class SampleStor
      */
     bool zero() const { return samples == Counter(); }
 
+    /** Bytes of host memory used by this storage. */
+    std::size_t memoryUsage() const { return sizeof(*this); }
+
     void
     prepare(const StorageParams* const storage_params, DistData &data)
     {
@@ -680,6 +785,9 @@ class AvgSampleStor
      */
     bool zero() const { return sum == Counter(); }
 
+    /** Bytes of host memory used by this storage. */
+    std::size_t memoryUsage() const { return sizeof(*this); }
+
     void
     prepare(const StorageParams* const storage_params, DistData &data)
     {
@@ -758,6 +866,17 @@ class SparseHistStor
         return samples == Counter();
     }
 
+    /**
+     * Bytes of host memory used by this storage, estimating the size of
+     * a map node as that of its value and three pointers.
+     */
+    std::size_t
+    memoryUsage() const
+    {
+        return sizeof(*this) +
+            cmap.size() * (sizeof(MCounter::value_type) + 3 * sizeof(void *));
+    }
+
     void
     prepare(const StorageParams* const storage_params, SparseHistData &data)
     {
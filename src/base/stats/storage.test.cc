@@ -327,9 +327,9 @@ checkExpectedDistData(const statistics::DistData& data,
         ASSERT_EQ(data.logs, expected_data.logs);
     }
     ASSERT_EQ(data.samples, expected_data.samples);
-    ASSERT_EQ(data.cvec.size(), expected_data.cvec.size());
+    ASSERT_EQ(data.buckets, expected_data.cvec.size());
     for (int i = 0; i < expected_data.cvec.size(); i++) {
-        ASSERT_EQ(data.cvec[i], expected_data.cvec[i]);
+        ASSERT_EQ(data.bucket(i), expected_data.cvec[i]);
     }
 }
 
@@ -471,6 +471,61 @@ TEST(StatsDistStorTest, Reset)
     checkExpectedDistData(data, expected_data, true);
 }
 
+/** Test that the buckets are only allocated when a bucket is sampled. */
+TEST(StatsDistStorTest, LazyBuckets)
+{
+    statistics::DistStor::Params params(0, 99, 5);
+    statistics::DistStor stor(&params);
+    const std::size_t empty_usage = stor.memoryUsage();
+    ASSERT_EQ(empty_usage, sizeof(statistics::DistStor));
+
+    // Unsampled buckets are not copied, and read as zero
+    statistics::DistData data;
+    stor.prepare(&params, data);
+    ASSERT_TRUE(data.cvec.empty());
+    ASSERT_EQ(data.buckets, params.buckets);
+    ASSERT_EQ(data.bucket(params.buckets - 1), 0);
+    ASSERT_EQ(stor.memoryUsage(), empty_usage);
+
+    // Samples out of the tracked range do not need the buckets
+    stor.sample(-1, 3);
+    stor.sample(100, 2);
+    ASSERT_EQ(stor.memoryUsage(), empty_usage);
+
+    stor.sample(12, 4);
+    ASSERT_EQ(stor.memoryUsage(),
+        empty_usage + params.buckets * sizeof(statistics::Counter));
+    stor.prepare(&params, data);
+    ASSERT_EQ(data.cvec.size(), params.buckets);
+    ASSERT_EQ(data.cvec[2], 4);
+
+    // Resetting keeps the buckets, but clears them
+    stor.reset(&params);
+    ASSERT_NE(stor.memoryUsage(), empty_usage);
+    stor.prepare(&params, data);
+    ASSERT_EQ(data.cvec, statistics::VCounter(params.buckets, 0));
+}
+
+/** Test that released buckets are reused, and cleared before. */
+TEST(StatsLazyBucketsTest, Reuse)
+{
+    statistics::DistStor::Params params(0, 999, 1);
+    {
+        statistics::DistStor stor(&params);
+        stor.sample(500, 1);
+    }
+    const std::size_t reserved = statistics::LazyBuckets::reservedMemory();
+
+    statistics::DistStor stor(&params);
+    stor.sample(10, 1);
+    ASSERT_EQ(statistics::LazyBuckets::reservedMemory(), reserved);
+
+    statistics::DistData data;
+    stor.prepare(&params, data);
+    ASSERT_EQ(data.cvec[10], 1);
+    ASSERT_EQ(data.cvec[500], 0);
+}
+
 #if TRACING_ON
 /** Test that an assertion is thrown when not enough buckets are provided. */
 TEST(StatsHistStorDeathTest, NotEnoughBuckets0)
@@ -970,6 +1025,39 @@ TEST(StatsHistStorTest, Add)
     checkExpectedDistData(merge_data, expected_data, false);
 }
 
+/** Test merging a histogram that was never sampled. */
+TEST(StatsHistStorTest, AddUnsampled)
+{
+    statistics::HistStor::Params params(4);
+
+    statistics::HistStor stor(&params);
+    stor.sample(20, 3);
+    statistics::DistData data;
+    stor.prepare(&params, data);
+
+    statistics::HistStor stor2(&params);
+    stor.add(&stor2);
+    ASSERT_EQ(stor2.memoryUsage(), sizeof(statistics::HistStor));
+
+    statistics::DistData merge_data;
+    stor.prepare(&params, merge_data);
+    checkExpectedDistData(merge_data, data, false);
+}
+
+/** Test that the buckets of an unsampled histogram are not copied. */
+TEST(StatsHistStorTest, PrepareUnsampled)
+{
+    statistics::HistStor::Params params(4);
+    statistics::HistStor stor(&params);
+
+    statistics::DistData data;
+    data.cvec.assign(params.buckets, 1);
+    stor.prepare(&params, data);
+    ASSERT_TRUE(data.cvec.empty());
+    ASSERT_EQ(data.buckets, params.buckets);
+    ASSERT_EQ(data.bucket(0), 0);
+}
+
 /**
  * Test whether zero is correctly set as the reset value. The test order is
  * to check if it is initially zero on creation, then it is made non zero,
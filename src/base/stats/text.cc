@@ -73,7 +73,8 @@ namespace statistics
 std::list<Info *> &statsList();
 
 Text::Text()
-    : mystream(false), stream(NULL), descriptions(false), spaces(false)
+    : mystream(false), stream(NULL), enableUnits(false), descriptions(false),
+      spaces(false)
 {
 }
 
@@ -148,6 +149,12 @@ Text::statName(const std::string &name) const
         return csprintf("%s.%s", path.top(), name);
 }
 
+void
+Text::write(const std::string &text)
+{
+    *stream << text;
+}
+
 void
 Text::beginGroup(const char *name)
 {
@@ -508,13 +515,13 @@ DistPrint::operator()(std::ostream &stream) const
     if (data.type == Deviation)
         return;
 
-    size_t size = data.cvec.size();
+    size_t size = data.buckets;
 
     Result total = 0.0;
     if (data.type == Dist && data.underflow != Nan)
         total += data.underflow;
     for (off_type i = 0; i < size; ++i)
-        total += data.cvec[i];
+        total += data.bucket(i);
     if (data.type == Dist && data.overflow != Nan)
         total += data.overflow;
 
@@ -544,7 +551,7 @@ DistPrint::operator()(std::ostream &stream) const
             namestr << "-" << high;
 
         print.name = namestr.str();
-        print.update(data.cvec[i], total);
+        print.update(data.bucket(i), total);
         print(stream, flags.isSet(oneline));
     }
 
@@ -605,13 +612,19 @@ Text::visit(const VectorInfo &info)
     if (noOutput(info))
         return;
 
+    printVector(info, info.result(), info.total());
+}
+
+void
+Text::printVector(const VectorInfo &info, const VResult &vec, Result total)
+{
     size_type size = info.size();
     VectorPrint print(spaces);
     print.setup(statName(info.name), info.flags, info.precision, descriptions,
         info.desc, enableUnits, info.unit->getUnitString(), spaces);
     print.separatorString = info.separatorString;
-    print.vec = info.result();
-    print.total = info.total();
+    print.vec = vec;
+    print.total = total;
     print.forceSubnames = false;
 
     if (!info.subnames.empty()) {
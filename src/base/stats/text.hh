@@ -66,7 +66,11 @@ class Text : public Output
     std::stack<std::string> path;
 
   protected:
-    bool noOutput(const Info &info);
+    virtual bool noOutput(const Info &info);
+
+    /** Print a vector or formula stat with the given values. */
+    void printVector(const VectorInfo &info, const VResult &vec,
+                     Result total);
 
   public:
     bool enableUnits;
@@ -83,6 +87,9 @@ class Text : public Output
     void open(const std::string &file);
     std::string statName(const std::string &name) const;
 
+    /** Write stats that were rendered by another text output. */
+    void write(const std::string &text);
+
     // Implement Visit
     void visit(const ScalarInfo &info) override;
     void visit(const VectorInfo &info) override;
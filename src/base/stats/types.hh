@@ -73,11 +73,21 @@ struct DistData
     Counter max_val;
     Counter underflow;
     Counter overflow;
+    /** The number of buckets. */
+    size_type buckets = 0;
+    /** The buckets, or empty if they are all zero. */
     VCounter cvec;
     Counter sum;
     Counter squares;
     Counter logs;
     Counter samples;
+
+    /** Read a bucket, which is zero if cvec is empty. */
+    Counter
+    bucket(off_type index) const
+    {
+        return cvec.empty() ? Counter() : cvec[index];
+    }
 };
 
 /** Data structure of sparse histogram */
@@ -32,6 +32,7 @@
 #ifndef __BASE_TRACE_HH__
 #define __BASE_TRACE_HH__
 
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <sstream>
@@ -138,6 +139,12 @@ class OstreamLogger : public Logger
   protected:
     std::ostream &stream;
 
+    /**
+     * Serialises the messages of threads other than the simulation
+     * thread, e.g., probe ring buffer consumers, with its own.
+     */
+    std::mutex mutex;
+
   public:
     OstreamLogger(std::ostream &stream_) : stream(stream_)
     { }
@@ -121,6 +121,27 @@ ActivityRecorder::deactivateStage(const int idx)
     assert(activityCount >= 0);
 }
 
+bool
+ActivityRecorder::anyStageActive() const
+{
+    for (int i = 0; i < numStages; ++i) {
+        if (stageActive[i])
+            return true;
+    }
+
+    return false;
+}
+
+int
+ActivityRecorder::cyclesSinceActivity() const
+{
+    int i = 0;
+    while (i <= longestLatency && !activityBuffer[-i])
+        ++i;
+
+    return i;
+}
+
 void
 ActivityRecorder::reset()
 {
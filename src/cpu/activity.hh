@@ -90,6 +90,23 @@ class ActivityRecorder
     /** Returns if the CPU should be active. */
     bool active() { return activityCount; }
 
+    /** Returns if any of the stages is active. */
+    bool anyStageActive() const;
+
+    /**
+     * Returns how many times advance() has been called since the most
+     * recent activity was recorded, or longestLatency + 1 if there is no
+     * activity left in the buffer.
+     */
+    int cyclesSinceActivity() const;
+
+    /**
+     * Returns how many more calls to advance() it takes until all of the
+     * recorded activity has left the buffer.
+     */
+    int cyclesUntilIdle() const
+    { return longestLatency + 1 - cyclesSinceActivity(); }
+
     /** Clears the time buffer and the activity count. */
     void reset();
 
@@ -433,6 +433,14 @@ class BaseMinorCPU(BaseCPU):
     enableIdling = Param.Bool(
         True, "Enable cycle skipping when the processor is idle\n"
     )
+    skipIdleStages = Param.Bool(
+        False,
+        "Skip evaluating Fetch1, Fetch2 and Decode in cycles when they "
+        "have no work to do without changing timing.  The pipeline "
+        "still ticks every cycle; sleeping is left to enableIdling.  "
+        "Ignored with the Random thread policy and while MinorTrace is "
+        "enabled",
+    )
 
     branchPred = Param.BranchPredictor(
         TournamentBP(numThreads=Parent.numThreads), "Branch Predictor"
@@ -337,6 +337,20 @@ Decode::isDrained()
     return (*inp.outputWire).isBubble();
 }
 
+bool
+Decode::isIdle()
+{
+    if (!(*inp.outputWire).isBubble())
+        return false;
+
+    for (ThreadID tid = 0; tid < cpu.numThreads; tid++) {
+        if (getInput(tid) && nextStageReserve[tid].canReserve())
+            return false;
+    }
+
+    return true;
+}
+
 void
 Decode::minorTrace() const
 {
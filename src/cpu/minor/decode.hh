@@ -156,6 +156,11 @@ class Decode : public Named
      *  into Decode and on to Execute which is responsible for
      *  actually killing instructions */
     bool isDrained();
+
+    /** Would evaluate do nothing this cycle?  True when no new input
+     *  arrives and no thread has both input to decode and space in
+     *  Execute's input buffer to pass it on to */
+    bool isIdle();
 };
 
 } // namespace minor
@@ -745,6 +745,34 @@ Fetch1::isDrained()
     return drained;
 }
 
+bool
+Fetch1::isIdle()
+{
+    if (!(*inp.outputWire).isBubble() || !(*prediction.outputWire).isBubble())
+        return false;
+
+    if (numInFlightFetches() != 0)
+        return false;
+
+    for (ThreadID tid = 0; tid < cpu.numThreads; tid++) {
+        const Fetch1ThreadInfo &thread = fetchInfo[tid];
+
+        /* evaluate clears wakeupGuard so it must run at least once after
+         *  a wakeup */
+        if (thread.wakeupGuard)
+            return false;
+
+        if (thread.state == FetchRunning &&
+            cpu.getContext(tid)->status() == ThreadContext::Active &&
+            nextStageReserve[tid].canReserve())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void
 Fetch1::FetchRequest::reportData(std::ostream &os) const
 {
@@ -406,6 +406,11 @@ class Fetch1 : public Named
     /** Is this stage drained?  For Fetch1, draining is initiated by
      *  Execute signalling a branch with the reason HaltFetch */
     bool isDrained();
+
+    /** Would evaluate do nothing this cycle?  True when no branch arrives,
+     *  no fetches are in flight and no thread is able to start a new
+     *  fetch */
+    bool isIdle();
 };
 
 } // namespace minor
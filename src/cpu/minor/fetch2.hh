@@ -218,6 +218,11 @@ class Fetch2 : public Named
      *  Execute halting Fetch1 causing Fetch2 to naturally drain.
      *  Branch predictions are ignored by Fetch1 during halt */
     bool isDrained();
+
+    /** Would evaluate do nothing this cycle?  True when no line or branch
+     *  arrives and every buffered line is both current and stuck behind
+     *  a full Decode input buffer */
+    bool isIdle();
 };
 
 } // namespace minor
@@ -136,6 +136,16 @@ BranchData::isBranch(const BranchData::Reason reason)
     return ret;
 }
 
+void
+BranchData::reset()
+{
+    reason = NoBranch;
+    threadId = InvalidThreadID;
+    newStreamSeqNum = 0;
+    newPredictionSeqNum = 0;
+    inst = MinorDynInst::bubble();
+}
+
 void
 BranchData::reportData(std::ostream &os) const
 {
@@ -213,6 +223,19 @@ ForwardLineData::freeLine()
     }
 }
 
+void
+ForwardLineData::reset()
+{
+    bubbleFlag = true;
+    lineBaseAddr = 0;
+    fetchAddr = 0;
+    lineWidth = 0;
+    fault = NoFault;
+    id = InstId();
+    line = NULL;
+    packet = NULL;
+}
+
 void
 ForwardLineData::reportData(std::ostream &os) const
 {
@@ -268,6 +291,15 @@ ForwardInstData::resize(unsigned int width)
     bubbleFill();
 }
 
+void
+ForwardInstData::reset()
+{
+    for (auto &inst : insts)
+        inst = NULL;
+    numInsts = 0;
+    threadId = InvalidThreadID;
+}
+
 void
 ForwardInstData::reportData(std::ostream &os) const
 {
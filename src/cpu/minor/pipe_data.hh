@@ -162,6 +162,10 @@ class BranchData /* : public ReportIF, public BubbleIF */
     static BranchData bubble() { return BranchData(); }
     bool isBubble() const { return reason == NoBranch; }
 
+    /** Make this a bubble again for reuse by a TimeBuffer, keeping the
+     *  target storage which is only read for stream changes */
+    void reset();
+
     /** As static isStreamChange but on this branch data */
     bool isStreamChange() const { return isStreamChange(reason); }
 
@@ -270,6 +274,10 @@ class ForwardLineData /* : public ReportIF, public BubbleIF */
     static ForwardLineData bubble() { return ForwardLineData(); }
     bool isBubble() const { return bubbleFlag; }
 
+    /** Make this a bubble again for reuse by a TimeBuffer, keeping the
+     *  pc storage.  As with destruction, the line is not freed */
+    void reset();
+
     /** ReportIF interface */
     void reportData(std::ostream &os) const;
 };
@@ -314,6 +322,9 @@ class ForwardInstData /* : public ReportIF, public BubbleIF */
     /** BubbleIF interface */
     bool isBubble() const;
 
+    /** Empty this for reuse by a TimeBuffer */
+    void reset();
+
     /** ReportIF interface */
     void reportData(std::ostream &os) const;
 };
@@ -58,6 +58,7 @@ Pipeline::Pipeline(MinorCPU &cpu_, const BaseMinorCPUParams &params) :
     Ticked(cpu_, &(cpu_.BaseCPU::baseStats.numCycles)),
     cpu(cpu_),
     allow_idling(params.enableIdling),
+    skipIdleStages(params.skipIdleStages),
     f1ToF2(cpu.name() + ".f1ToF2", "lines",
         params.fetch1ToFetch2ForwardDelay),
     f2ToF1(cpu.name() + ".f2ToF1", "prediction",
@@ -104,6 +105,17 @@ Pipeline::Pipeline(MinorCPU &cpu_, const BaseMinorCPUParams &params) :
         fatal("%s: executeBranchDelay must be >= 1\n",
             cpu.name(), params.executeBranchDelay);
     }
+
+    /* Each stage's thread selection shuffles with the global random
+     *  generator whether or not it finds work so skipping stages would
+     *  change the random stream */
+    if (skipIdleStages && cpu.threadPolicy == enums::Random &&
+        cpu.numThreads > 1)
+    {
+        warn("%s: skipIdleStages is ignored with the Random thread policy\n",
+            cpu.name());
+        skipIdleStages = false;
+    }
 }
 
 void
@@ -131,9 +143,30 @@ Pipeline::evaluate()
      *  'immediate', 0-time-offset TimeBuffer activity to be visible from
      *  later stages to earlier ones in the same cycle */
     execute.evaluate();
-    decode.evaluate();
-    fetch2.evaluate();
-    fetch1.evaluate();
+
+    /* Stages with no input and no work in flight are skipped.  This relies
+     *  on each stage's isIdle being exactly the condition under which its
+     *  evaluate would change no state.  Execute polls interrupts and steps
+     *  the LSQ every cycle so it is always evaluated.  MinorTrace reports
+     *  the blocked flags evaluate computes so it needs every stage to be
+     *  evaluated.  The pipeline itself still ticks every cycle, only the
+     *  activity recorder below stops it once no stage is active */
+    bool skip_idle = skipIdleStages && !debug::MinorTrace;
+
+    if (skip_idle && decode.isIdle())
+        cpu.stats.idleDecodeSkips++;
+    else
+        decode.evaluate();
+
+    if (skip_idle && fetch2.isIdle())
+        cpu.stats.idleFetch2Skips++;
+    else
+        fetch2.evaluate();
+
+    if (skip_idle && fetch1.isIdle())
+        cpu.stats.idleFetch1Skips++;
+    else
+        fetch1.evaluate();
 
     if (debug::MinorTrace)
         minorTrace();
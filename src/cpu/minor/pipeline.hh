@@ -77,6 +77,11 @@ class Pipeline : public Ticked
     /** Allow cycles to be skipped when the pipeline is idle */
     bool allow_idling;
 
+    /** Skip evaluating individual stages which have no work to do.  Only
+     *  valid when thread selection doesn't consume random numbers every
+     *  cycle */
+    bool skipIdleStages;
+
     Latch<ForwardLineData> f1ToF2;
     Latch<BranchData> f2ToF1;
     Latch<ForwardInstData> f2ToD;
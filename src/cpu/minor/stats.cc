@@ -47,9 +47,21 @@ MinorStats::MinorStats(BaseCPU *base_cpu)
     : statistics::Group(base_cpu),
     ADD_STAT(quiesceCycles, statistics::units::Cycle::get(),
              "Total number of cycles that CPU has spent quiesced or waiting "
-             "for an interrupt")
+             "for an interrupt"),
+    ADD_STAT(idleFetch1Skips, statistics::units::Cycle::get(),
+             "Number of cycles Fetch1 was not evaluated as it had no work "
+             "to do"),
+    ADD_STAT(idleFetch2Skips, statistics::units::Cycle::get(),
+             "Number of cycles Fetch2 was not evaluated as it had no work "
+             "to do"),
+    ADD_STAT(idleDecodeSkips, statistics::units::Cycle::get(),
+             "Number of cycles Decode was not evaluated as it had no work "
+             "to do")
 {
     quiesceCycles.prereq(quiesceCycles);
+    idleFetch1Skips.prereq(idleFetch1Skips);
+    idleFetch2Skips.prereq(idleFetch2Skips);
+    idleDecodeSkips.prereq(idleDecodeSkips);
 }
 
 } // namespace minor
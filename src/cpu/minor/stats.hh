@@ -62,6 +62,11 @@ struct MinorStats : public statistics::Group
     /** Number of cycles in quiescent state */
     statistics::Scalar quiesceCycles;
 
+    /** Number of cycles each stage that can be skipped was idle */
+    statistics::Scalar idleFetch1Skips;
+    statistics::Scalar idleFetch2Skips;
+    statistics::Scalar idleDecodeSkips;
+
 };
 
 } // namespace minor
@@ -77,6 +77,12 @@ class BaseO3CPU(BaseCPU):
         return True
 
     activity = Param.Unsigned(0, "Initial count")
+    skipIdleCycles = Param.Bool(
+        False,
+        "Stop ticking while the pipeline is waiting on memory and nothing "
+        "can change until a response arrives, accounting the skipped "
+        "cycles in the stats as if the CPU had ticked through them",
+    )
 
     cacheStorePorts = Param.Unsigned(
         200, "Cache Ports. Constrains stores only."
@@ -173,6 +179,11 @@ class BaseO3CPU(BaseCPU):
     numPhysCCRegs = Param.Unsigned(0, "Number of physical cc registers")
     numIQEntries = Param.Unsigned(64, "Number of instruction queue entries")
     numROBEntries = Param.Unsigned(192, "Number of reorder buffer entries")
+    poisonRecycledInsts = Param.Bool(
+        False,
+        "Poison the storage of freed instructions and check it is untouched "
+        "when recycled, to catch uses after free",
+    )
 
     smtNumFetchingThreads = Param.Unsigned(1, "SMT Number of Fetching Threads")
     smtFetchPolicy = Param.SMTFetchPolicy("RoundRobin", "SMT Fetch policy")
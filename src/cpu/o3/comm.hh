@@ -57,6 +57,13 @@ namespace gem5
 namespace o3
 {
 
+/**
+ * The structures below are communicated through TimeBuffers. Their reset()
+ * members clear them for reuse in place of zeroing them, which keeps any
+ * PC state storage allocated. Consumers only read a PC state when the flag
+ * that goes with it, e.g. squash, is set.
+ */
+
 /** Struct that defines the information passed from fetch to decode. */
 struct FetchStruct
 {
@@ -66,6 +73,18 @@ struct FetchStruct
     Fault fetchFault;
     InstSeqNum fetchFaultSN;
     bool clearFetchFault;
+
+    /** Clear for reuse by the TimeBuffer. */
+    void
+    reset()
+    {
+        size = 0;
+        for (auto &inst : insts)
+            inst = nullptr;
+        fetchFault = NoFault;
+        fetchFaultSN = 0;
+        clearFetchFault = false;
+    }
 };
 
 /** Struct that defines the information passed from decode to rename. */
@@ -74,6 +93,15 @@ struct DecodeStruct
     int size;
 
     DynInstPtr insts[MaxWidth];
+
+    /** Clear for reuse by the TimeBuffer. */
+    void
+    reset()
+    {
+        size = 0;
+        for (auto &inst : insts)
+            inst = nullptr;
+    }
 };
 
 /** Struct that defines the information passed from rename to IEW. */
@@ -82,6 +110,15 @@ struct RenameStruct
     int size;
 
     DynInstPtr insts[MaxWidth];
+
+    /** Clear for reuse by the TimeBuffer. */
+    void
+    reset()
+    {
+        size = 0;
+        for (auto &inst : insts)
+            inst = nullptr;
+    }
 };
 
 /** Struct that defines the information passed from IEW to commit. */
@@ -99,6 +136,24 @@ struct IEWStruct
     bool branchMispredict[MaxThreads];
     bool branchTaken[MaxThreads];
     bool includeSquashInst[MaxThreads];
+
+    /** Clear for reuse by the TimeBuffer, keeping the PC states. */
+    void
+    reset()
+    {
+        size = 0;
+        for (auto &inst : insts)
+            inst = nullptr;
+        for (ThreadID tid = 0; tid < MaxThreads; tid++) {
+            mispredictInst[tid] = nullptr;
+            mispredPC[tid] = 0;
+            squashedSeqNum[tid] = 0;
+            squash[tid] = false;
+            branchMispredict[tid] = false;
+            branchTaken[tid] = false;
+            includeSquashInst[tid] = false;
+        }
+    }
 };
 
 struct IssueStruct
@@ -106,6 +161,15 @@ struct IssueStruct
     int size;
 
     DynInstPtr insts[MaxWidth];
+
+    /** Clear for reuse by the TimeBuffer. */
+    void
+    reset()
+    {
+        size = 0;
+        for (auto &inst : insts)
+            inst = nullptr;
+    }
 };
 
 /** Struct that defines all backwards communication. */
@@ -124,6 +188,22 @@ struct TimeStruct
         bool predIncorrect;
         bool branchMispredict;
         bool branchTaken;
+
+        /** Clear for reuse, keeping the PC state. */
+        void
+        reset()
+        {
+            mispredictInst = nullptr;
+            squashInst = nullptr;
+            doneSeqNum = 0;
+            mispredPC = 0;
+            branchAddr = 0;
+            branchCount = 0;
+            squash = false;
+            predIncorrect = false;
+            branchMispredict = false;
+            branchTaken = false;
+        }
     };
 
     DecodeComm decodeInfo[MaxThreads];
@@ -213,6 +293,25 @@ struct TimeStruct
         /// the IEW stage.
         bool strictlyOrdered; // *I
 
+        /// Clear for reuse, keeping the PC state.
+        void
+        reset()
+        {
+            mispredictInst = nullptr;
+            squashInst = nullptr;
+            strictlyOrderedLoad = nullptr;
+            nonSpecSeqNum = 0;
+            doneSeqNum = 0;
+            freeROBEntries = 0;
+            squash = false;
+            robSquashing = false;
+            usedROB = false;
+            emptyROB = false;
+            branchTaken = false;
+            interruptPending = false;
+            clearInterrupt = false;
+            strictlyOrdered = false;
+        }
     };
 
     CommitComm commitInfo[MaxThreads];
@@ -223,6 +322,23 @@ struct TimeStruct
     bool renameUnblock[MaxThreads];
     bool iewBlock[MaxThreads];
     bool iewUnblock[MaxThreads];
+
+    /** Clear for reuse by the TimeBuffer, keeping the PC states. */
+    void
+    reset()
+    {
+        for (ThreadID tid = 0; tid < MaxThreads; tid++) {
+            decodeInfo[tid].reset();
+            iewInfo[tid] = IewComm();
+            commitInfo[tid].reset();
+            decodeBlock[tid] = false;
+            decodeUnblock[tid] = false;
+            renameBlock[tid] = false;
+            renameUnblock[tid] = false;
+            iewBlock[tid] = false;
+            iewUnblock[tid] = false;
+        }
+    }
 };
 
 } // namespace o3
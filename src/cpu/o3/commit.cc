@@ -655,6 +655,15 @@ Commit::tick()
     updateStatus();
 }
 
+void
+Commit::notifyCommitStalls()
+{
+    for (ThreadID tid : *activeThreads) {
+        if (!rob->isEmpty(tid) && !rob->readHeadInst(tid)->readyToCommit())
+            ppCommitStall->notify(rob->readHeadInst(tid));
+    }
+}
+
 void
 Commit::handleInterrupt()
 {
@@ -670,7 +679,7 @@ Commit::handleInterrupt()
 
     // Wait until all in flight instructions are finished before enterring
     // the interrupt.
-    if (canHandleInterrupts && cpu->instList.empty()) {
+    if (canHandleInterrupts && cpu->instListEmpty()) {
         // Squash or record that I need to squash this cycle if
         // an interrupt needed to be handled.
         DPRINTF(Commit, "Interrupt detected.\n");
@@ -704,7 +713,7 @@ Commit::handleInterrupt()
         DPRINTF(Commit, "Interrupt pending: instruction is %sin "
                 "flight, ROB is %sempty\n",
                 canHandleInterrupts ? "not " : "",
-                cpu->instList.empty() ? "" : "not " );
+                cpu->instListEmpty() ? "" : "not " );
     }
 }
 
@@ -1087,7 +1096,7 @@ Commit::commitInsts()
     }
 
     DPRINTF(CommitRate, "%i\n", num_committed);
-    stats.numCommittedDist.sample(num_committed);
+    cpu->sampleCycle(stats.numCommittedDist, num_committed);
 
     if (num_committed == commitWidth) {
         stats.commitEligibleSamples++;
@@ -205,6 +205,12 @@ class Commit
     /** Ticks the commit stage, which tries to commit instructions. */
     void tick();
 
+    /**
+     * Notifies the commit stall probe of the ROB heads that are not ready
+     * to commit, as a tick that cannot commit anything does.
+     */
+    void notifyCommitStalls();
+
     /** Handles any squashes that are sent from IEW, and adds instructions
      * to the ROB and tries to commit instructions.
      */
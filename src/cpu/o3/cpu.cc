@@ -76,6 +76,13 @@ CPU::CPU(const BaseO3CPUParams &params)
                 false, Event::CPU_Tick_Pri),
       threadExitEvent([this]{ exitThreads(); }, "O3CPU exit threads",
                 false, Event::CPU_Exit_Pri),
+      // Keep enough freed DynInsts for all the instructions that can be in
+      // flight, that is in the ROB, in the store queue after commit, or in
+      // the front end
+      dynInstPool(this,
+                  params.numROBEntries + params.SQEntries +
+                  params.numThreads * params.fetchQueueSize,
+                  params.poisonRecycledInsts),
 #ifndef NDEBUG
       instcount(0),
 #endif
@@ -114,6 +121,23 @@ CPU::CPU(const BaseO3CPUParams &params)
       globalSeqNum(1),
       system(params.system),
       lastRunningCycle(curCycle()),
+      skipIdleCycles(params.skipIdleCycles),
+      maxCommDelay(std::max({params.decodeToFetchDelay,
+                             params.renameToFetchDelay,
+                             params.iewToFetchDelay,
+                             params.commitToFetchDelay,
+                             params.renameToDecodeDelay,
+                             params.iewToDecodeDelay,
+                             params.commitToDecodeDelay,
+                             params.fetchToDecodeDelay,
+                             params.iewToRenameDelay,
+                             params.commitToRenameDelay,
+                             params.decodeToRenameDelay,
+                             params.commitToIEWDelay,
+                             params.renameToIEWDelay,
+                             params.issueToExecuteDelay,
+                             params.iewToCommitDelay,
+                             params.renameToROBDelay})),
       cpuStats(this)
 {
     fatal_if(FullSystem && params.numThreads > 1,
@@ -123,6 +147,15 @@ CPU::CPU(const BaseO3CPUParams &params)
             "More workload items (%d) than threads (%d) on CPU %s.",
             params.workload.size(), params.numThreads, name());
 
+    // Instructions are in flight from fetch until they commit, so each
+    // thread can have a full ROB and a full front end.
+    for (ThreadID tid = 0; tid < numThreads; tid++) {
+        instList[tid].reserve(params.numROBEntries + params.fetchQueueSize +
+                              (params.forwardComSize + 1) *
+                              (params.fetchWidth + params.decodeWidth +
+                               params.renameWidth));
+    }
+
     if (!params.switched_out) {
         _status = Running;
     } else {
@@ -328,7 +361,10 @@ CPU::CPUStats::CPUStats(CPU *cpu)
                "to idling"),
       ADD_STAT(quiesceCycles, statistics::units::Cycle::get(),
                "Total number of cycles that CPU has spent quiesced or waiting "
-               "for an interrupt")
+               "for an interrupt"),
+      ADD_STAT(skippedCycles, statistics::units::Cycle::get(),
+               "Total number of cycles the CPU did not tick because the "
+               "pipeline could not make progress (included in numCycles)")
 {
     // Register any of the O3CPU's stats here.
     timesIdled
@@ -339,6 +375,9 @@ CPU::CPUStats::CPUStats(CPU *cpu)
 
     quiesceCycles
         .prereq(quiesceCycles);
+
+    skippedCycles
+        .prereq(skippedCycles);
 }
 
 void
@@ -351,6 +390,13 @@ CPU::tick()
     ++baseStats.numCycles;
     updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
+    if (skipIdleCycles) {
+        lastCycleStats.swap(curCycleStats);
+        curCycleStats.clear();
+        lastCycleDists.swap(curCycleDists);
+        curCycleDists.clear();
+    }
+
 //    activity = false;
 
     //Tick each of the stages
@@ -387,6 +433,11 @@ CPU::tick()
             DPRINTF(O3CPU, "Idle!\n");
             lastRunningCycle = curCycle();
             cpuStats.timesIdled++;
+        } else if (skipIdleCycles && canSkipCycles()) {
+            DPRINTF(Activity, "Pipeline stalled, skipping idle cycles\n");
+            skippingCycles = true;
+            skipStartCycle = curCycle();
+            skipActiveCycles = Cycles(activityRec.cyclesUntilIdle());
         } else {
             schedule(tickEvent, clockEdge(Cycles(1)));
             DPRINTF(O3CPU, "Scheduling next tick!\n");
@@ -399,6 +450,115 @@ CPU::tick()
     tryDrain();
 }
 
+bool
+CPU::canSkipCycles()
+{
+    // Everything written to the time buffers must have been read, and the
+    // stages must not have anything left to do by themselves.
+    if (drainState() != DrainState::Running ||
+            activityRec.anyStageActive() ||
+            Cycles(activityRec.cyclesSinceActivity()) <=
+                std::max(maxCommDelay, Cycles(1)) ||
+            iew.instQueue.hasReadyInsts()) {
+        return false;
+    }
+
+    // The stages must have seen the same state as in the previous cycle,
+    // so that any further cycle would do the same.
+    return curCycleStats == lastCycleStats && curCycleDists == lastCycleDists;
+}
+
+Cycles
+CPU::stopSkipping(bool waking)
+{
+    assert(skippingCycles);
+    skippingCycles = false;
+
+    // The CPU can tick again in the cycle after the last tick at the
+    // earliest, and would have ticked in the cycles before that until it
+    // ran out of activity.
+    const Cycles next = std::max(curCycle(), Cycles(skipStartCycle + 1));
+    const Cycles elapsed(next - skipStartCycle - 1);
+    const Cycles ticked = std::min(elapsed, skipActiveCycles);
+
+    DPRINTF(Activity, "Stopped skipping, accounting %llu cycles\n",
+            (unsigned long long)ticked);
+
+    for (Cycles i(0); i < ticked; ++i) {
+        timeBuffer.advance();
+        fetchQueue.advance();
+        decodeQueue.advance();
+        renameQueue.advance();
+        iewQueue.advance();
+        activityRec.advance();
+
+        if (!FullSystem)
+            updateThreadPriority();
+
+        // The ROB does not change while skipping, so commit would have
+        // reported the same stalls in every cycle
+        commit.notifyCommitStalls();
+    }
+
+    for (auto stat : curCycleStats)
+        *stat += ticked;
+    for (auto &sample : curCycleDists)
+        sample.first->sample(sample.second, ticked);
+    baseStats.numCycles += ticked;
+    cpuStats.skippedCycles += ticked;
+
+    if (ticked == skipActiveCycles) {
+        // The CPU would have gone idle after the last of those cycles.
+        lastRunningCycle = Cycles(skipStartCycle + ticked);
+        cpuStats.timesIdled++;
+
+        if (waking) {
+            Cycles cycles(next - lastRunningCycle);
+            // @todo: This is an oddity that is only here to match the stats
+            if (cycles > 1) {
+                --cycles;
+                cpuStats.idleCycles += cycles;
+                baseStats.numCycles += cycles;
+            }
+        }
+    }
+
+    return Cycles(next - curCycle());
+}
+
+void
+CPU::accountSkippedCycles()
+{
+    if (!skippingCycles)
+        return;
+
+    const Cycles start = skipStartCycle;
+    const Cycles active = skipActiveCycles;
+    stopSkipping(false);
+
+    const Cycles next = std::max(curCycle(), Cycles(start + 1));
+    const Cycles ticked = std::min(Cycles(next - start - 1), active);
+    if (ticked < active) {
+        skippingCycles = true;
+        skipStartCycle = Cycles(start + ticked);
+        skipActiveCycles = Cycles(active - ticked);
+    }
+}
+
+void
+CPU::preDumpStats()
+{
+    accountSkippedCycles();
+    BaseCPU::preDumpStats();
+}
+
+void
+CPU::preResetStats()
+{
+    accountSkippedCycles();
+    BaseCPU::preResetStats();
+}
+
 void
 CPU::init()
 {
@@ -747,6 +907,8 @@ CPU::drain()
         return DrainState::Draining;
     } else {
         DPRINTF(Drain, "CPU is already drained\n");
+        if (skippingCycles)
+            stopSkipping(false);
         if (tickEvent.scheduled())
             deschedule(tickEvent);
 
@@ -798,7 +960,7 @@ CPU::isCpuDrained() const
 {
     bool drained(true);
 
-    if (!instList.empty() || !removeList.empty()) {
+    if (!instListEmpty()) {
         DPRINTF(Drain, "Main CPU structures not drained.\n");
         drained = false;
     }
@@ -1111,12 +1273,29 @@ CPU::squashFromTC(ThreadID tid)
     commit.generateTCEvent(tid);
 }
 
-CPU::ListIt
+void
 CPU::addInst(const DynInstPtr &inst)
 {
-    instList.push_back(inst);
+    ThreadID tid = inst->threadNumber;
 
-    return --(instList.end());
+    // Squashed instructions are removed at the end of the cycle, unless
+    // younger instructions are added after them.
+    dropSquashedInsts(tid);
+
+    if (instList[tid].full())
+        instList[tid].reserve(2 * instList[tid].capacity());
+    instList[tid].push_back(inst);
+}
+
+bool
+CPU::instListEmpty() const
+{
+    for (ThreadID tid = 0; tid < numThreads; tid++) {
+        if (!instList[tid].empty())
+            return false;
+    }
+
+    return true;
 }
 
 void
@@ -1148,7 +1327,10 @@ CPU::removeFrontInst(const DynInstPtr &inst)
     removeInstsThisCycle = true;
 
     // Remove the front instruction.
-    removeList.push(inst->getInstListIt());
+    ThreadID tid = inst->threadNumber;
+    assert(instList[tid][instList[tid].head() +
+                         numCommittedToRemove[tid]] == inst);
+    ++numCommittedToRemove[tid];
 }
 
 void
@@ -1157,105 +1339,91 @@ CPU::removeInstsNotInROB(ThreadID tid)
     DPRINTF(O3CPU, "Thread %i: Deleting instructions from instruction"
             " list.\n", tid);
 
-    ListIt end_it;
-
-    bool rob_empty = false;
-
-    if (instList.empty()) {
-        return;
-    } else if (rob.isEmpty(tid)) {
+    if (rob.isEmpty(tid)) {
         DPRINTF(O3CPU, "ROB is empty, squashing all insts.\n");
-        end_it = instList.begin();
-        rob_empty = true;
+        squashInstsAfter(0, tid);
     } else {
-        end_it = (rob.readTailInst(tid))->getInstListIt();
         DPRINTF(O3CPU, "ROB is not empty, squashing insts not in ROB.\n");
-    }
-
-    removeInstsThisCycle = true;
-
-    ListIt inst_it = instList.end();
-
-    inst_it--;
-
-    // Walk through the instruction list, removing any instructions
-    // that were inserted after the given instruction iterator, end_it.
-    while (inst_it != end_it) {
-        assert(!instList.empty());
-
-        squashInstIt(inst_it, tid);
-
-        inst_it--;
-    }
-
-    // If the ROB was empty, then we actually need to remove the first
-    // instruction as well.
-    if (rob_empty) {
-        squashInstIt(inst_it, tid);
+        squashInstsAfter(rob.readTailInst(tid)->seqNum, tid);
     }
 }
 
 void
 CPU::removeInstsUntil(const InstSeqNum &seq_num, ThreadID tid)
 {
-    assert(!instList.empty());
-
-    removeInstsThisCycle = true;
-
-    ListIt inst_iter = instList.end();
-
-    inst_iter--;
+    assert(!instList[tid].empty());
 
     DPRINTF(O3CPU, "Deleting instructions from instruction "
             "list that are from [tid:%i] and above [sn:%lli] (end=%lli).\n",
-            tid, seq_num, (*inst_iter)->seqNum);
+            tid, seq_num, instList[tid].back()->seqNum);
+
+    squashInstsAfter(seq_num, tid);
+}
 
-    while ((*inst_iter)->seqNum > seq_num) {
+void
+CPU::squashInstsAfter(InstSeqNum seq_num, ThreadID tid)
+{
+    auto &insts = instList[tid];
 
-        bool break_loop = (inst_iter == instList.begin());
+    removeInstsThisCycle = true;
 
-        squashInstIt(inst_iter, tid);
+    // Walk back from the youngest instruction that is not squashed yet.
+    // Squashed instructions stay in the list until the end of the cycle,
+    // but only after the ones already squashed and before the ones
+    // committed this cycle.
+    size_t idx = insts.tail() - numSquashedToRemove[tid];
+    const size_t oldest = insts.head() + numCommittedToRemove[tid];
 
-        inst_iter--;
+    while (idx >= oldest && insts[idx]->seqNum > seq_num) {
+        DPRINTF(O3CPU, "Squashing instruction, "
+                "[tid:%i] [sn:%lli] PC %s\n",
+                insts[idx]->threadNumber,
+                insts[idx]->seqNum,
+                insts[idx]->pcState());
+
+        // Mark it as squashed.
+        insts[idx]->setSquashed();
 
-        if (break_loop)
-            break;
+        ++numSquashedToRemove[tid];
+        --idx;
     }
 }
 
 void
-CPU::squashInstIt(const ListIt &instIt, ThreadID tid)
+CPU::dropSquashedInsts(ThreadID tid)
 {
-    if ((*instIt)->threadNumber == tid) {
-        DPRINTF(O3CPU, "Squashing instruction, "
-                "[tid:%i] [sn:%lli] PC %s\n",
-                (*instIt)->threadNumber,
-                (*instIt)->seqNum,
-                (*instIt)->pcState());
+    auto &insts = instList[tid];
 
-        // Mark it as squashed.
-        (*instIt)->setSquashed();
+    for (; numSquashedToRemove[tid] > 0; --numSquashedToRemove[tid]) {
+        DPRINTF(O3CPU, "Removing instruction, "
+                "[tid:%i] [sn:%lli] PC %s\n",
+                insts.back()->threadNumber,
+                insts.back()->seqNum,
+                insts.back()->pcState());
 
-        // @todo: Formulate a consistent method for deleting
-        // instructions from the instruction list
-        // Remove the instruction from the list.
-        removeList.push(instIt);
+        insts.back() = nullptr;
+        insts.pop_back();
     }
 }
 
 void
 CPU::cleanUpRemovedInsts()
 {
-    while (!removeList.empty()) {
-        DPRINTF(O3CPU, "Removing instruction, "
-                "[tid:%i] [sn:%lli] PC %s\n",
-                (*removeList.front())->threadNumber,
-                (*removeList.front())->seqNum,
-                (*removeList.front())->pcState());
+    for (ThreadID tid = 0; tid < numThreads; tid++) {
+        auto &insts = instList[tid];
+
+        dropSquashedInsts(tid);
 
-        instList.erase(removeList.front());
+        for (; numCommittedToRemove[tid] > 0; --numCommittedToRemove[tid]) {
+            DPRINTF(O3CPU, "Removing instruction, "
+                    "[tid:%i] [sn:%lli] PC %s\n",
+                    insts.front()->threadNumber,
+                    insts.front()->seqNum,
+                    insts.front()->pcState());
 
-        removeList.pop();
+            insts.front() = nullptr;
+            insts.pop_front();
+        }
     }
 
     removeInstsThisCycle = false;
@@ -1272,19 +1440,16 @@ CPU::dumpInsts()
 {
     int num = 0;
 
-    ListIt inst_list_it = instList.begin();
-
     cprintf("Dumping Instruction List\n");
 
-    while (inst_list_it != instList.end()) {
-        cprintf("Instruction:%i\nPC:%#x\n[tid:%i]\n[sn:%lli]\nIssued:%i\n"
-                "Squashed:%i\n\n",
-                num, (*inst_list_it)->pcState().instAddr(),
-                (*inst_list_it)->threadNumber,
-                (*inst_list_it)->seqNum, (*inst_list_it)->isIssued(),
-                (*inst_list_it)->isSquashed());
-        inst_list_it++;
-        ++num;
+    for (ThreadID tid = 0; tid < numThreads; tid++) {
+        for (const auto &inst : instList[tid]) {
+            cprintf("Instruction:%i\nPC:%#x\n[tid:%i]\n[sn:%lli]\n"
+                    "Issued:%i\nSquashed:%i\n\n",
+                    num, inst->pcState().instAddr(), inst->threadNumber,
+                    inst->seqNum, inst->isIssued(), inst->isSquashed());
+            ++num;
+        }
     }
 }
 /*
@@ -1297,6 +1462,12 @@ CPU::wakeDependents(const DynInstPtr &inst)
 void
 CPU::wakeCPU()
 {
+    if (skippingCycles) {
+        DPRINTF(Activity, "Waking up CPU from skipping idle cycles\n");
+        schedule(tickEvent, clockEdge(stopSkipping(true)));
+        return;
+    }
+
     if (activityRec.active() || tickEvent.scheduled()) {
         DPRINTF(Activity, "CPU already running.\n");
         return;
@@ -1318,6 +1489,11 @@ CPU::wakeCPU()
 void
 CPU::wakeup(ThreadID tid)
 {
+    // A thread could be interrupted in the cycles the CPU would have kept
+    // ticking if it was not skipping them.
+    if (skippingCycles && curCycle() <= skipStartCycle + skipActiveCycles)
+        wakeCPU();
+
     if (thread[tid]->status() != gem5::ThreadContext::Suspended)
         return;
 
@@ -43,17 +43,20 @@
 #ifndef __CPU_O3_CPU_HH__
 #define __CPU_O3_CPU_HH__
 
+#include <algorithm>
 #include <iostream>
 #include <list>
-#include <queue>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "arch/generic/pcstate.hh"
+#include "base/circular_queue.hh"
 #include "base/statistics.hh"
 #include "cpu/o3/comm.hh"
 #include "cpu/o3/commit.hh"
 #include "cpu/o3/decode.hh"
+#include "cpu/o3/dyn_inst_pool.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/fetch.hh"
 #include "cpu/o3/free_list.hh"
@@ -93,8 +96,6 @@ class ThreadContext;
 class CPU : public BaseCPU
 {
   public:
-    typedef std::list<DynInstPtr>::iterator ListIt;
-
     friend class ThreadContext;
 
   public:
@@ -125,6 +126,8 @@ class CPU : public BaseCPU
     void
     scheduleTickEvent(Cycles delay)
     {
+        if (skippingCycles)
+            delay = std::max(delay, stopSkipping(false));
         if (tickEvent.squashed())
             reschedule(tickEvent, clockEdge(delay));
         else if (!tickEvent.scheduled())
@@ -135,6 +138,8 @@ class CPU : public BaseCPU
     void
     unscheduleTickEvent()
     {
+        if (skippingCycles)
+            stopSkipping(false);
         if (tickEvent.scheduled())
             tickEvent.squash();
     }
@@ -176,6 +181,9 @@ class CPU : public BaseCPU
     /** Register probe points. */
     void regProbePoints() override;
 
+    void preDumpStats() override;
+    void preResetStats() override;
+
     void
     demapPage(Addr vaddr, uint64_t asn)
     {
@@ -345,13 +353,16 @@ class CPU : public BaseCPU
     /** Function to add instruction onto the head of the list of the
      *  instructions.  Used when new instructions are fetched.
      */
-    ListIt addInst(const DynInstPtr &inst);
+    void addInst(const DynInstPtr &inst);
+
+    /** Returns if there are no instructions in flight in any thread. */
+    bool instListEmpty() const;
 
     /** Function to tell the CPU that an instruction has completed. */
     void instDone(ThreadID tid, const DynInstPtr &inst);
 
-    /** Remove an instruction from the front end of the list.  There's
-     *  no restriction on location of the instruction.
+    /** Remove an instruction from the front end of the list. The
+     *  instruction must be the oldest one of its thread.
      */
     void removeFrontInst(const DynInstPtr &inst);
 
@@ -362,28 +373,48 @@ class CPU : public BaseCPU
     /** Remove all instructions younger than the given sequence number. */
     void removeInstsUntil(const InstSeqNum &seq_num, ThreadID tid);
 
-    /** Removes the instruction pointed to by the iterator. */
-    void squashInstIt(const ListIt &instIt, ThreadID tid);
+    /** Squashes the instructions of a thread younger than the given
+     *  sequence number, and removes them at the end of the cycle.
+     */
+    void squashInstsAfter(InstSeqNum seq_num, ThreadID tid);
+
+    /** Removes the squashed instructions at the back of the list. */
+    void dropSquashedInsts(ThreadID tid);
 
-    /** Cleans up all instructions on the remove list. */
+    /** Cleans up all instructions to be removed this cycle. */
     void cleanUpRemovedInsts();
 
     /** Debug function to print all instructions on the list. */
     void dumpInsts();
 
   public:
+    /**
+     * Storage of the DynInsts. It must outlive all the structures that hold
+     * DynInsts, and thus be declared before them.
+     */
+    DynInstPool dynInstPool;
+
 #ifndef NDEBUG
     /** Count of total number of dynamic instructions in flight. */
     int instcount;
 #endif
 
-    /** List of all the instructions in flight. */
-    std::list<DynInstPtr> instList;
+    /** List of all the instructions in flight, per thread and in program
+     *  order. Instructions are committed from the front and squashed from
+     *  the back, so the list is a circular buffer that only grows if the
+     *  front end ever holds more instructions than expected.
+     */
+    CircularQueue<DynInstPtr> instList[MaxThreads];
+
+    /** Number of committed instructions at the front of each thread's list
+     *  that will be removed at the end of this cycle.
+     */
+    size_t numCommittedToRemove[MaxThreads] = {};
 
-    /** List of all the instructions that will be removed at the end of this
-     *  cycle.
+    /** Number of squashed instructions at the back of each thread's list
+     *  that will be removed at the end of this cycle.
      */
-    std::queue<ListIt> removeList;
+    size_t numSquashedToRemove[MaxThreads] = {};
 
 #ifdef GEM5_DEBUG
     /** Debug structure to keep track of the sequence numbers still in
@@ -501,6 +532,28 @@ class CPU : public BaseCPU
     /** Wakes the CPU, rescheduling the CPU if it's not already active. */
     void wakeCPU();
 
+    /**
+     * Counts a cycle in one of the stages' per-cycle stats. If idle cycle
+     * skipping is enabled, the stat is also remembered so that it can be
+     * counted again for each cycle the CPU skips.
+     */
+    void
+    countCycle(statistics::Scalar &stat)
+    {
+        ++stat;
+        if (skipIdleCycles)
+            curCycleStats.push_back(&stat);
+    }
+
+    /** Samples a per-cycle distribution; see countCycle(). */
+    void
+    sampleCycle(statistics::Distribution &dist, statistics::Counter val)
+    {
+        dist.sample(val);
+        if (skipIdleCycles)
+            curCycleDists.emplace_back(&dist, val);
+    }
+
     virtual void wakeup(ThreadID tid) override;
 
     /** Gets a free thread id. Use if thread ids change across system. */
@@ -538,6 +591,63 @@ class CPU : public BaseCPU
     /** The cycle that the CPU was last activated by a new thread*/
     Tick lastActivatedCycle;
 
+    /**
+     * Idle cycle skipping. When a cycle leaves the pipeline in a state
+     * that cannot change until an outside event (e.g., a cache response)
+     * wakes the CPU, the tick event is not rescheduled even though the
+     * activity recorder would keep the CPU running for a few more cycles.
+     * When the CPU is woken, the cycles it would have ticked are accounted
+     * by replaying the per-cycle stats of the last tick.
+     */
+    const bool skipIdleCycles;
+
+    /** Largest delay of any of the time buffer wires between stages. */
+    Cycles maxCommDelay;
+
+    /** Whether the CPU is currently skipping idle cycles. */
+    bool skippingCycles = false;
+
+    /** The cycle of the last tick before the CPU started skipping. */
+    Cycles skipStartCycle;
+
+    /**
+     * Number of cycles the CPU would have kept ticking after
+     * skipStartCycle before running out of activity.
+     */
+    Cycles skipActiveCycles;
+
+    /** Per-cycle stats counted in this cycle and in the previous one. */
+    std::vector<statistics::Scalar *> curCycleStats;
+    std::vector<statistics::Scalar *> lastCycleStats;
+
+    /** Per-cycle distribution samples in this cycle and the previous one. */
+    using CycleSample = std::pair<statistics::Distribution *,
+                                  statistics::Counter>;
+    std::vector<CycleSample> curCycleDists;
+    std::vector<CycleSample> lastCycleDists;
+
+    /**
+     * Checks, at the end of a tick, if the pipeline cannot make progress
+     * until something wakes the CPU up.
+     */
+    bool canSkipCycles();
+
+    /**
+     * Stops skipping idle cycles, accounting the cycles the CPU would have
+     * ticked until now.
+     * @param waking Whether the CPU is woken up or just stopped, so that the
+     * idle cycles are accounted the same way wakeCPU() would.
+     * @return The number of cycles until the CPU can tick again.
+     */
+    Cycles stopSkipping(bool waking);
+
+    /**
+     * Accounts the cycles skipped so far, so that the stats are up to date
+     * when they are dumped or reset, and keeps skipping if the CPU would
+     * still have been ticking.
+     */
+    void accountSkippedCycles();
+
     /** Mapping for system thread id to cpu id */
     std::map<ThreadID, unsigned> threadMap;
 
@@ -581,6 +691,9 @@ class CPU : public BaseCPU
         /** Stat for total number of cycles the CPU spends descheduled due to a
          * quiesce operation or waiting for an interrupt. */
         statistics::Scalar quiesceCycles;
+        /** Stat for total number of cycles the CPU did not tick because
+         * nothing could change in the pipeline. */
+        statistics::Scalar skippedCycles;
     } cpuStats;
 
   public:
@@ -585,9 +585,9 @@ Decode::decode(bool &status_change, ThreadID tid)
     //     check if stall conditions have passed
 
     if (decodeStatus[tid] == Blocked) {
-        ++stats.blockedCycles;
+        cpu->countCycle(stats.blockedCycles);
     } else if (decodeStatus[tid] == Squashing) {
-        ++stats.squashCycles;
+        cpu->countCycle(stats.squashCycles);
     }
 
     // Decode should try to decode as many instructions as its bandwidth
@@ -630,14 +630,14 @@ Decode::decodeInsts(ThreadID tid)
         DPRINTF(Decode, "[tid:%i] Nothing to do, breaking out"
                 " early.\n",tid);
         // Should I change the status to idle?
-        ++stats.idleCycles;
+        cpu->countCycle(stats.idleCycles);
         return;
     } else if (decodeStatus[tid] == Unblocking) {
         DPRINTF(Decode, "[tid:%i] Unblocking, removing insts from skid "
                 "buffer.\n",tid);
-        ++stats.unblockCycles;
+        cpu->countCycle(stats.unblockCycles);
     } else if (decodeStatus[tid] == Running) {
-        ++stats.runCycles;
+        cpu->countCycle(stats.runCycles);
     }
 
     std::queue<DynInstPtr>
@@ -107,17 +107,18 @@ DynInst::DynInst(const Arrays &arrays, const StaticInstPtr &_staticInst,
 {}
 
 /*
- * This custom "new" operator uses the default "new" operator to allocate space
+ * This custom "new" operator uses the DynInstPool of the CPU to allocate space
  * for a DynInst, but also pads out the number of bytes to make room for some
  * extra structures the DynInst needs. We save time and improve performance by
- * only going to the heap once to get space for all these structures.
+ * only going to the pool once to get space for all these structures, and the
+ * pool only goes to the heap when it has no freed buffer to recycle.
  *
  * When a DynInst is allocated with new, the compiler will call this "new"
  * operator with "count" set to the number of bytes it needs to store the
- * DynInst. We ultimately call into the default new operator to get those
- * bytes, but before we do, we pad out "count" so that there will be extra
- * space for some structures the DynInst needs. We take into account both the
- * absolute size of these structures, and also what alignment they need.
+ * DynInst. We ultimately call into the pool to get those bytes, but before
+ * we do, we pad out "count" so that there will be extra space for some
+ * structures the DynInst needs. We take into account both the absolute size
+ * of these structures, and also what alignment they need.
  *
  * Once we've gotten a buffer large enough to hold the DynInst itself and these
  * extra structures, we construct the extra bits using placement new. This
@@ -168,7 +169,8 @@ DynInst::operator new(size_t count, Arrays &arrays)
     size_t total_size = ready_src_idx + ready_src_idx_size;
 
     // Actually allocate it.
-    uint8_t *buf = (uint8_t *)::operator new(total_size);
+    assert(arrays.pool);
+    uint8_t *buf = (uint8_t *)arrays.pool->allocate(total_size);
 
     // Fill in "arrays" with pointers to all the arrays.
     arrays.flatDestIdx = (RegId *)(buf + flat_dest_idx);
@@ -187,13 +189,14 @@ DynInst::operator new(size_t count, Arrays &arrays)
     return buf;
 }
 
-// Because of the custom "new" operator that allocates more bytes than the
-// size of the DynInst object, AddressSanitizer throw new-delete-type-mismatch.
-// Adding a custom delete function is enough to shut down this false positive
+// The storage of the DynInst goes back to the pool it was allocated from.
+// This also keeps AddressSanitizer from throwing new-delete-type-mismatch
+// because of the custom "new" operator that allocates more bytes than the
+// size of the DynInst object.
 void
 DynInst::operator delete(void *ptr)
 {
-    ::operator delete(ptr);
+    DynInstPool::release(ptr);
 }
 
 DynInst::~DynInst()
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/dyn_inst_pool.hh"
+
+#include <cstring>
+#include <new>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+DynInstPool::DynInstPool(statistics::Group *parent, size_t max_free,
+                         bool poison)
+    : maxFree(max_free), poison(poison), numFree(0), stats(parent)
+{
+}
+
+DynInstPool::~DynInstPool()
+{
+    for (auto &free_list : freeLists) {
+        for (Header *header : free_list)
+            ::operator delete(header);
+    }
+}
+
+void *
+DynInstPool::allocate(size_t size)
+{
+    const size_t size_class = divCeil(size, Granularity);
+
+    if (size_class < freeLists.size() && !freeLists[size_class].empty()) {
+        Header *header = freeLists[size_class].back();
+        freeLists[size_class].pop_back();
+        --numFree;
+
+        if (poison) {
+            const uint8_t *buf = reinterpret_cast<uint8_t *>(header + 1);
+            for (size_t i = 0; i < header->size; i++) {
+                panic_if(buf[i] != PoisonValue,
+                         "DynInst storage modified after being freed\n");
+            }
+        }
+
+        ++stats.recycled;
+        stats.occupancy = numFree;
+        return header + 1;
+    }
+
+    const size_t buf_size = size_class * Granularity;
+    Header *header =
+        static_cast<Header *>(::operator new(sizeof(Header) + buf_size));
+    header->pool = this;
+    header->size = buf_size;
+
+    ++stats.allocated;
+    return header + 1;
+}
+
+void
+DynInstPool::release(void *ptr)
+{
+    Header *header = static_cast<Header *>(ptr) - 1;
+    header->pool->recycle(header);
+}
+
+void
+DynInstPool::recycle(Header *header)
+{
+    if (numFree == maxFree) {
+        ::operator delete(header);
+        return;
+    }
+
+    if (poison)
+        std::memset(header + 1, PoisonValue, header->size);
+
+    const size_t size_class = header->size / Granularity;
+    if (size_class >= freeLists.size())
+        freeLists.resize(size_class + 1);
+    freeLists[size_class].push_back(header);
+    ++numFree;
+
+    stats.occupancy = numFree;
+}
+
+DynInstPool::DynInstPoolStats::DynInstPoolStats(statistics::Group *parent)
+    : statistics::Group(parent, "dynInstPool"),
+      ADD_STAT(recycled, statistics::units::Count::get(),
+               "Number of DynInsts that reused the storage of a freed one"),
+      ADD_STAT(allocated, statistics::units::Count::get(),
+               "Number of DynInsts allocated from the heap"),
+      ADD_STAT(occupancy, statistics::units::Count::get(),
+               "Average number of free DynInst buffers held by the pool")
+{
+}
+
+} // namespace o3
+} // namespace gem5
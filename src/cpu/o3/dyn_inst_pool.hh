@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_DYN_INST_POOL_HH__
+#define __CPU_O3_DYN_INST_POOL_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "base/statistics.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/**
+ * Recycles the storage of the DynInsts of a CPU. A DynInst and the arrays
+ * that trail it are allocated as a single buffer, which is kept by the pool
+ * when the DynInst is freed and handed out again to a later DynInst that
+ * needs a buffer of the same size class. This avoids going to the heap for
+ * every fetched instruction, including wrong-path ones.
+ *
+ * Each buffer starts with a header that records the pool it belongs to, so
+ * that it can be given back from DynInst::operator delete. The pool keeps
+ * a bounded number of free buffers, any buffer freed beyond that bound is
+ * returned to the heap.
+ *
+ * When poisoning is enabled, freed buffers are filled with a pattern that
+ * is checked when the buffer is handed out again, which catches writes to
+ * a DynInst after it has been freed.
+ */
+class DynInstPool
+{
+  public:
+    /**
+     * @param parent Stats group of the owner
+     * @param max_free Maximum number of free buffers kept
+     * @param poison Poison free buffers
+     */
+    DynInstPool(statistics::Group *parent, size_t max_free, bool poison);
+    ~DynInstPool();
+
+    DynInstPool(const DynInstPool &) = delete;
+    DynInstPool &operator=(const DynInstPool &) = delete;
+
+    /**
+     * Get a buffer for a DynInst.
+     *
+     * @param size Size of the DynInst and its arrays
+     * @return A buffer of at least size bytes
+     */
+    void *allocate(size_t size);
+
+    /**
+     * Give a buffer back to the pool it was allocated from.
+     *
+     * @param ptr Buffer obtained from allocate()
+     */
+    static void release(void *ptr);
+
+  private:
+    struct alignas(alignof(std::max_align_t)) Header
+    {
+        /** Pool the buffer was allocated from */
+        DynInstPool *pool;
+        /** Usable size of the buffer */
+        size_t size;
+    };
+
+    /** Buffer sizes are rounded up to a multiple of this many bytes */
+    static constexpr size_t Granularity = 64;
+
+    static constexpr uint8_t PoisonValue = 0xa5;
+
+    /** Keep a freed buffer, or return it to the heap if the pool is full. */
+    void recycle(Header *header);
+
+    const size_t maxFree;
+
+    const bool poison;
+
+    /** Number of free buffers held */
+    size_t numFree;
+
+    /** Free buffers, indexed by size in units of Granularity */
+    std::vector<std::vector<Header *>> freeLists;
+
+    struct DynInstPoolStats : public statistics::Group
+    {
+        DynInstPoolStats(statistics::Group *parent);
+
+        statistics::Scalar recycled;
+        statistics::Scalar allocated;
+        statistics::Average occupancy;
+    } stats;
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_DYN_INST_POOL_HH__
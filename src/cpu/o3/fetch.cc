@@ -730,7 +730,7 @@ Fetch::doSquash(const PCStateBase &new_pc, const DynInstPtr squashInst,
     // some opportunities to handle interrupts may be missed.
     delayedCommit[tid] = true;
 
-    ++fetchStats.squashCycles;
+    cpu->countCycle(fetchStats.squashCycles);
 }
 
 void
@@ -852,7 +852,7 @@ Fetch::tick()
     }
 
     // Record number of instructions fetched this cycle for distribution.
-    fetchStats.nisnDist.sample(numInst);
+    cpu->sampleCycle(fetchStats.nisnDist, numInst);
 
     if (status_change) {
         // Change the fetch stage status if there was a status change.
@@ -1026,6 +1026,7 @@ Fetch::buildInst(ThreadID tid, StaticInstPtr staticInst,
     DynInst::Arrays arrays;
     arrays.numSrcs = staticInst->numSrcRegs();
     arrays.numDests = staticInst->numDestRegs();
+    arrays.pool = &cpu->dynInstPool;
 
     // Create a new DynInst from the instruction fetched.
     DynInstPtr instruction = new (arrays) DynInst(
@@ -1051,7 +1052,7 @@ Fetch::buildInst(ThreadID tid, StaticInstPtr staticInst,
 #endif
 
     // Add instruction to the CPU's list of instructions.
-    instruction->setInstListIt(cpu->addInst(instruction));
+    cpu->addInst(instruction);
 
     // Write the instruction to the first slot in the queue
     // that heads to decode.
@@ -1123,25 +1124,25 @@ Fetch::fetch(bool &status_change)
             fetchCacheLine(fetchAddr, tid, this_pc.instAddr());
 
             if (fetchStatus[tid] == IcacheWaitResponse) {
-                cpu->fetchStats[tid]->icacheStallCycles++;
+                cpu->countCycle(cpu->fetchStats[tid]->icacheStallCycles);
             }
             else if (fetchStatus[tid] == ItlbWait)
-                ++fetchStats.tlbCycles;
+                cpu->countCycle(fetchStats.tlbCycles);
             else
-                ++fetchStats.miscStallCycles;
+                cpu->countCycle(fetchStats.miscStallCycles);
             return;
         } else if (checkInterrupt(this_pc.instAddr()) &&
                 !delayedCommit[tid]) {
             // Stall CPU if an interrupt is posted and we're not issuing
             // an delayed commit micro-op currently (delayed commit
             // instructions are not interruptable by interrupts, only faults)
-            ++fetchStats.miscStallCycles;
+            cpu->countCycle(fetchStats.miscStallCycles);
             DPRINTF(Fetch, "[tid:%i] Fetch is stalled!\n", tid);
             return;
         }
     } else {
         if (fetchStatus[tid] == Idle) {
-            ++fetchStats.idleCycles;
+            cpu->countCycle(fetchStats.idleCycles);
             DPRINTF(Fetch, "[tid:%i] Fetch is idle!\n", tid);
         }
 
@@ -1538,35 +1539,35 @@ Fetch::profileStall(ThreadID tid)
     // @todo Per-thread stats
 
     if (stalls[tid].drain) {
-        ++fetchStats.pendingDrainCycles;
+        cpu->countCycle(fetchStats.pendingDrainCycles);
         DPRINTF(Fetch, "Fetch is waiting for a drain!\n");
     } else if (activeThreads->empty()) {
-        ++fetchStats.noActiveThreadStallCycles;
+        cpu->countCycle(fetchStats.noActiveThreadStallCycles);
         DPRINTF(Fetch, "Fetch has no active thread!\n");
     } else if (fetchStatus[tid] == Blocked) {
-        ++fetchStats.blockedCycles;
+        cpu->countCycle(fetchStats.blockedCycles);
         DPRINTF(Fetch, "[tid:%i] Fetch is blocked!\n", tid);
     } else if (fetchStatus[tid] == Squashing) {
-        ++fetchStats.squashCycles;
+        cpu->countCycle(fetchStats.squashCycles);
         DPRINTF(Fetch, "[tid:%i] Fetch is squashing!\n", tid);
     } else if (fetchStatus[tid] == IcacheWaitResponse) {
-        cpu->fetchStats[tid]->icacheStallCycles++;
+        cpu->countCycle(cpu->fetchStats[tid]->icacheStallCycles);
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting cache response!\n",
                 tid);
     } else if (fetchStatus[tid] == ItlbWait) {
-        ++fetchStats.tlbCycles;
+        cpu->countCycle(fetchStats.tlbCycles);
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting ITLB walk to "
                 "finish!\n", tid);
     } else if (fetchStatus[tid] == TrapPending) {
-        ++fetchStats.pendingTrapStallCycles;
+        cpu->countCycle(fetchStats.pendingTrapStallCycles);
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting for a pending trap!\n",
                 tid);
     } else if (fetchStatus[tid] == QuiescePending) {
-        ++fetchStats.pendingQuiesceStallCycles;
+        cpu->countCycle(fetchStats.pendingQuiesceStallCycles);
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting for a pending quiesce "
                 "instruction!\n", tid);
     } else if (fetchStatus[tid] == IcacheWaitRetry) {
-        ++fetchStats.icacheWaitRetryStallCycles;
+        cpu->countCycle(fetchStats.icacheWaitRetryStallCycles);
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting for an I-cache retry!\n",
                 tid);
     } else if (fetchStatus[tid] == NoGoodAddr) {
@@ -628,7 +628,7 @@ IEW::updateStatus()
     // If there are no ready instructions waiting to be scheduled by the IQ,
     // and there's no stores waiting to write back, and dispatch is not
     // unblocking, then there is no internal activity for the IEW stage.
-    instQueue.iqIOStats.intInstQueueReads++;
+    cpu->countCycle(instQueue.iqIOStats.intInstQueueReads);
     if (_status == Active && !instQueue.hasReadyInsts() &&
         !ldstQueue.willWB() && !any_unblocking) {
         DPRINTF(IEW, "IEW switching to idle\n");
@@ -799,10 +799,10 @@ IEW::dispatch(ThreadID tid)
     //     check if stall conditions have passed
 
     if (dispatchStatus[tid] == Blocked) {
-        ++iewStats.blockCycles;
+        cpu->countCycle(iewStats.blockCycles);
 
     } else if (dispatchStatus[tid] == Squashing) {
-        ++iewStats.squashCycles;
+        cpu->countCycle(iewStats.squashCycles);
     }
 
     // Dispatch should try to dispatch as many instructions as its bandwidth
@@ -823,7 +823,7 @@ IEW::dispatch(ThreadID tid)
         // the rest of unblocking.
         dispatchInsts(tid);
 
-        ++iewStats.unblockCycles;
+        cpu->countCycle(iewStats.unblockCycles);
 
         if (fromRename->size != 0) {
             // Add the current inputs to the skid buffer so they can be
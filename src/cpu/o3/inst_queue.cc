@@ -904,7 +904,7 @@ InstructionQueue::scheduleReadyInsts()
         }
     }
 
-    iqStats.numIssuedDist.sample(total_issued);
+    cpu->sampleCycle(iqStats.numIssuedDist, total_issued);
     iqStats.instsIssued+= total_issued;
 
     // If we issued any instructions, tell the CPU we had activity.
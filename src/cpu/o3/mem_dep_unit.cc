@@ -28,6 +28,7 @@
 
 #include "cpu/o3/mem_dep_unit.hh"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <vector>
@@ -68,19 +69,20 @@ MemDepUnit::~MemDepUnit()
 {
     for (ThreadID tid = 0; tid < MaxThreads; tid++) {
 
-        ListIt inst_list_it = instList[tid].begin();
-
         MemDepHashIt hash_it;
 
-        while (!instList[tid].empty()) {
-            hash_it = memDepHash.find((*inst_list_it)->seqNum);
+        for (auto &inst : instList[tid]) {
+            if (!inst)
+                continue;
+
+            hash_it = memDepHash.find(inst->seqNum);
 
             assert(hash_it != memDepHash.end());
 
             memDepHash.erase(hash_it);
-
-            instList[tid].erase(inst_list_it++);
         }
+
+        instList[tid].flush();
     }
 
 #ifdef GEM5_DEBUG
@@ -99,6 +101,9 @@ MemDepUnit::init(const BaseO3CPUParams &params, ThreadID tid, CPU *cpu)
     depPred.init(params.store_set_clear_period, params.SSITSize,
             params.LFSTSize);
 
+    // All of the instructions in the list are in the LSQ.
+    instList[tid].reserve(params.LQEntries + params.SQEntries);
+
     std::string stats_group_name = csprintf("MemDepUnit__%i", tid);
     cpu->addStatGroup(stats_group_name.c_str(), &stats);
 }
@@ -200,9 +205,7 @@ MemDepUnit::insert(const DynInstPtr &inst)
     MemDepEntry::memdep_insert++;
 #endif
 
-    instList[tid].push_back(inst);
-
-    inst_entry->listIt = --(instList[tid].end());
+    inst_entry->listIdx = addToInstList(inst);
 
     // Check any barriers and the dependence predictor for any
     // producing memrefs/stores.
@@ -334,13 +337,34 @@ MemDepUnit::insertBarrier(const DynInstPtr &barr_inst)
 #endif
 
     // Add the instruction to the instruction list.
-    instList[tid].push_back(barr_inst);
-
-    inst_entry->listIt = --(instList[tid].end());
+    inst_entry->listIdx = addToInstList(barr_inst);
 
     insertBarrierSN(barr_inst);
 }
 
+size_t
+MemDepUnit::addToInstList(const DynInstPtr &inst)
+{
+    auto &inst_list = instList[inst->threadNumber];
+
+    if (inst_list.full())
+        inst_list.reserve(std::max<size_t>(2 * inst_list.capacity(), 1));
+    inst_list.push_back(inst);
+
+    return inst_list.tail();
+}
+
+void
+MemDepUnit::trimInstList(ThreadID tid)
+{
+    auto &inst_list = instList[tid];
+
+    while (!inst_list.empty() && !inst_list.front())
+        inst_list.pop_front();
+    while (!inst_list.empty() && !inst_list.back())
+        inst_list.pop_back();
+}
+
 void
 MemDepUnit::regsReady(const DynInstPtr &inst)
 {
@@ -414,7 +438,8 @@ MemDepUnit::completed(const DynInstPtr &inst)
 
     assert(hash_it != memDepHash.end());
 
-    instList[tid].erase((*hash_it).second->listIt);
+    instList[tid][(*hash_it).second->listIdx] = nullptr;
+    trimInstList(tid);
 
     (*hash_it).second = NULL;
 
@@ -532,22 +557,22 @@ MemDepUnit::squash(const InstSeqNum &squashed_num, ThreadID tid)
         }
     }
 
-    ListIt squash_it = instList[tid].end();
-    --squash_it;
-
     MemDepHashIt hash_it;
 
+    // Entries of completed instructions are cleared, so there are never
+    // any at the back of the list.
     while (!instList[tid].empty() &&
-           (*squash_it)->seqNum > squashed_num) {
+           instList[tid].back()->seqNum > squashed_num) {
+        DynInstPtr &squash_inst = instList[tid].back();
 
         DPRINTF(MemDepUnit, "Squashing inst [sn:%lli]\n",
-                (*squash_it)->seqNum);
+                squash_inst->seqNum);
 
-        loadBarrierSNs.erase((*squash_it)->seqNum);
+        loadBarrierSNs.erase(squash_inst->seqNum);
 
-        storeBarrierSNs.erase((*squash_it)->seqNum);
+        storeBarrierSNs.erase(squash_inst->seqNum);
 
-        hash_it = memDepHash.find((*squash_it)->seqNum);
+        hash_it = memDepHash.find(squash_inst->seqNum);
 
         assert(hash_it != memDepHash.end());
 
@@ -560,7 +585,9 @@ MemDepUnit::squash(const InstSeqNum &squashed_num, ThreadID tid)
         MemDepEntry::memdep_erase++;
 #endif
 
-        instList[tid].erase(squash_it--);
+        squash_inst = nullptr;
+        instList[tid].pop_back();
+        trimInstList(tid);
     }
 
     // Tell the dependency predictor to squash as well.
@@ -617,18 +644,16 @@ MemDepUnit::dumpLists()
         cprintf("Instruction list %i size: %i\n",
                 tid, instList[tid].size());
 
-        ListIt inst_list_it = instList[tid].begin();
         int num = 0;
 
-        while (inst_list_it != instList[tid].end()) {
+        for (auto &inst : instList[tid]) {
+            if (!inst)
+                continue;
+
             cprintf("Instruction:%i\nPC: %s\n[sn:%llu]\n[tid:%i]\nIssued:%i\n"
                     "Squashed:%i\n\n",
-                    num, (*inst_list_it)->pcState(),
-                    (*inst_list_it)->seqNum,
-                    (*inst_list_it)->threadNumber,
-                    (*inst_list_it)->isIssued(),
-                    (*inst_list_it)->isSquashed());
-            inst_list_it++;
+                    num, inst->pcState(), inst->seqNum, inst->threadNumber,
+                    inst->isIssued(), inst->isSquashed());
             ++num;
         }
     }
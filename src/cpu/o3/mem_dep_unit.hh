@@ -47,6 +47,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "base/circular_queue.hh"
 #include "base/statistics.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
@@ -169,7 +170,6 @@ class MemDepUnit
     /** Wakes any dependents of a memory instruction. */
     void wakeDependents(const DynInstPtr &inst);
 
-    typedef typename std::list<DynInstPtr>::iterator ListIt;
 
     class MemDepEntry;
 
@@ -194,8 +194,8 @@ class MemDepUnit
         /** The instruction being tracked. */
         DynInstPtr inst;
 
-        /** The iterator to the instruction's location inside the list. */
-        ListIt listIt;
+        /** The index of the instruction's entry inside the list. */
+        size_t listIdx = 0;
 
         /** A vector of any dependent instructions. */
         std::vector<MemDepEntryPtr> dependInsts;
@@ -230,8 +230,18 @@ class MemDepUnit
     /** A hash map of all memory dependence entries. */
     MemDepHash memDepHash;
 
-    /** A list of all instructions in the memory dependence unit. */
-    std::list<DynInstPtr> instList[MaxThreads];
+    /** A list of all instructions in the memory dependence unit, in
+     *  program order. Instructions can complete out of order, so the
+     *  entries of completed instructions are cleared and only removed once
+     *  they reach either end of the list.
+     */
+    CircularQueue<DynInstPtr> instList[MaxThreads];
+
+    /** Adds an instruction at the end of the list and returns its index. */
+    size_t addToInstList(const DynInstPtr &inst);
+
+    /** Removes the cleared entries from both ends of the list. */
+    void trimInstList(ThreadID tid);
 
     /** A list of all instructions that are going to be replayed. */
     std::list<DynInstPtr> instsToReplay;
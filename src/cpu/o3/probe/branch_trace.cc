@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/probe/branch_trace.hh"
+
+#include <memory>
+
+#include "base/output.hh"
+#include "cpu/o3/dyn_inst.hh"
+#include "proto/branch.pb.h"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+BranchTrace::BranchTrace(const BranchTraceParams &params)
+    : ProbeListenerObject(params),
+      traceStream(nullptr),
+      instsSinceBranch(0)
+{
+    fatal_if(params.traceFile == "", "Assign the branch trace file path to "
+             "traceFile\n");
+
+    traceStream = new ProtoOutputStream(
+        simout.resolve(name() + "." + params.traceFile));
+
+    ProtoMessage::BranchHeader header;
+    header.set_obj_id(name());
+    traceStream->write(header);
+
+    // Register a callback to close the output stream.
+    registerExitCallback([this]() { flushTrace(); });
+}
+
+void
+BranchTrace::traceCommit(const DynInstConstPtr &dynInst)
+{
+    if (!dynInst->isMicroop() || dynInst->isLastMicroop())
+        ++instsSinceBranch;
+
+    if (!dynInst->isControl())
+        return;
+
+    const PCStateBase &pc = dynInst->pcState();
+    std::unique_ptr<PCStateBase> next_pc(pc.clone());
+    dynInst->staticInst->advancePC(*next_pc);
+
+    // control flow within the microcode of an instruction is not seen by
+    // the branch predictor
+    if (next_pc->instAddr() == pc.instAddr())
+        return;
+
+    ProtoMessage::Branch branch;
+    branch.set_pc(pc.instAddr());
+    branch.set_insts(instsSinceBranch);
+    instsSinceBranch = 0;
+
+    uint32_t flags = ProtoMessage::Branch::None;
+    if (dynInst->isCondCtrl())
+        flags |= ProtoMessage::Branch::Conditional;
+    if (dynInst->isIndirectCtrl())
+        flags |= ProtoMessage::Branch::Indirect;
+    if (dynInst->isCall())
+        flags |= ProtoMessage::Branch::Call;
+    if (dynInst->isReturn())
+        flags |= ProtoMessage::Branch::Return;
+    branch.set_flags(flags);
+
+    if (pc.branching()) {
+        branch.set_taken(true);
+        branch.set_target(next_pc->instAddr());
+    } else {
+        // the fall-through PC gives the size of the branch
+        branch.set_taken(false);
+        branch.set_target(0);
+        branch.set_size(next_pc->instAddr() - pc.instAddr());
+    }
+
+    traceStream->write(branch);
+}
+
+void
+BranchTrace::regProbeListeners()
+{
+    typedef ProbeListenerArg<BranchTrace, DynInstConstPtr> DynInstListener;
+    registerListener(new DynInstListener(this, "Commit",
+                &BranchTrace::traceCommit));
+}
+
+void
+BranchTrace::flushTrace()
+{
+    delete traceStream;
+    traceStream = nullptr;
+}
+
+} // namespace o3
+} // namespace gem5
@@ -125,23 +125,23 @@ ElasticTrace::regEtraceListeners()
         " probe listeners", curTick(), cpu->numSimulatedInsts());
     // Create new listeners: provide method to be called upon a notify() for
     // each probe point.
-    listeners.push_back(new ProbeListenerArg<ElasticTrace, RequestPtr>(this,
+    registerListener(new ProbeListenerArg<ElasticTrace, RequestPtr>(this,
                         "FetchRequest", &ElasticTrace::fetchReqTrace));
-    listeners.push_back(new ProbeListenerArg<ElasticTrace,
+    registerListener(new ProbeListenerArg<ElasticTrace,
             DynInstConstPtr>(this, "Execute",
                 &ElasticTrace::recordExecTick));
-    listeners.push_back(new ProbeListenerArg<ElasticTrace,
+    registerListener(new ProbeListenerArg<ElasticTrace,
             DynInstConstPtr>(this, "ToCommit",
                 &ElasticTrace::recordToCommTick));
-    listeners.push_back(new ProbeListenerArg<ElasticTrace,
+    registerListener(new ProbeListenerArg<ElasticTrace,
             DynInstConstPtr>(this, "Rename",
                 &ElasticTrace::updateRegDep));
-    listeners.push_back(new ProbeListenerArg<ElasticTrace, SeqNumRegPair>(this,
+    registerListener(new ProbeListenerArg<ElasticTrace, SeqNumRegPair>(this,
                         "SquashInRename", &ElasticTrace::removeRegDepMapEntry));
-    listeners.push_back(new ProbeListenerArg<ElasticTrace,
+    registerListener(new ProbeListenerArg<ElasticTrace,
             DynInstConstPtr>(this, "Squash",
                 &ElasticTrace::addSquashedInst));
-    listeners.push_back(new ProbeListenerArg<ElasticTrace,
+    registerListener(new ProbeListenerArg<ElasticTrace,
             DynInstConstPtr>(this, "Commit",
                 &ElasticTrace::addCommittedInst));
     allProbesReg = true;
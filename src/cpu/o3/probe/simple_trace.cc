@@ -68,9 +68,9 @@ SimpleTrace::regProbeListeners()
 {
     typedef ProbeListenerArg<SimpleTrace,
             DynInstConstPtr> DynInstListener;
-    listeners.push_back(new DynInstListener(this, "Commit",
+    registerListener(new DynInstListener(this, "Commit",
                 &SimpleTrace::traceCommit));
-    listeners.push_back(new DynInstListener(this, "Fetch",
+    registerListener(new DynInstListener(this, "Fetch",
                 &SimpleTrace::traceFetch));
 }
 
@@ -86,6 +86,11 @@ Rename::Rename(CPU *_cpu, const BaseO3CPUParams &params)
         serializeInst[tid] = nullptr;
         serializeOnNextInst[tid] = false;
     }
+
+    // Every instruction in the ROB may have renamed a destination register,
+    // the history grows if instructions rename more than one on average.
+    for (ThreadID tid = 0; tid < numThreads; tid++)
+        historyBuffer[tid].reserve(params.numROBEntries);
 }
 
 std::string
@@ -462,11 +467,11 @@ Rename::rename(bool &status_change, ThreadID tid)
     //     check if stall conditions have passed
 
     if (renameStatus[tid] == Blocked) {
-        ++stats.blockCycles;
+        cpu->countCycle(stats.blockCycles);
     } else if (renameStatus[tid] == Squashing) {
-        ++stats.squashCycles;
+        cpu->countCycle(stats.squashCycles);
     } else if (renameStatus[tid] == SerializeStall) {
-        ++stats.serializeStallCycles;
+        cpu->countCycle(stats.serializeStallCycles);
         // If we are currently in SerializeStall and resumeSerialize
         // was set, then that means that we are resuming serializing
         // this cycle.  Tell the previous stages to block.
@@ -520,12 +525,12 @@ Rename::renameInsts(ThreadID tid)
         DPRINTF(Rename, "[tid:%i] Nothing to do, breaking out early.\n",
                 tid);
         // Should I change status to idle?
-        ++stats.idleCycles;
+        cpu->countCycle(stats.idleCycles);
         return;
     } else if (renameStatus[tid] == Unblocking) {
-        ++stats.unblockCycles;
+        cpu->countCycle(stats.unblockCycles);
     } else if (renameStatus[tid] == Running) {
-        ++stats.runCycles;
+        cpu->countCycle(stats.runCycles);
     }
 
     // Will have to do a different calculation for the number of free
@@ -914,15 +919,13 @@ Rename::unblock(ThreadID tid)
 void
 Rename::doSquash(const InstSeqNum &squashed_seq_num, ThreadID tid)
 {
-    auto hb_it = historyBuffer[tid].begin();
-
     // After a syscall squashes everything, the history buffer may be empty
     // but the ROB may still be squashing instructions.
     // Go through the most recent instructions, undoing the mappings
     // they did and freeing up the registers.
     while (!historyBuffer[tid].empty() &&
-           hb_it->instSeqNum > squashed_seq_num) {
-        assert(hb_it != historyBuffer[tid].end());
+           historyBuffer[tid].back().instSeqNum > squashed_seq_num) {
+        const RenameHistory *hb_it = &historyBuffer[tid].back();
 
         DPRINTF(Rename, "[tid:%i] Removing history entry with sequence "
                 "number %i (archReg: %d, newPhysReg: %d, prevPhysReg: %d).\n",
@@ -946,11 +949,11 @@ Rename::doSquash(const InstSeqNum &squashed_seq_num, ThreadID tid)
 
         // Notify potential listeners that the register mapping needs to be
         // removed because the instruction it was mapped to got squashed. Note
-        // that this is done before hb_it is incremented.
+        // that this is done before the entry is removed.
         ppSquashInRename->notify(std::make_pair(hb_it->instSeqNum,
                                                 hb_it->newPhysReg));
 
-        historyBuffer[tid].erase(hb_it++);
+        historyBuffer[tid].pop_back();
 
         ++stats.undoneMaps;
     }
@@ -963,14 +966,10 @@ Rename::removeFromHistory(InstSeqNum inst_seq_num, ThreadID tid)
             "history buffer %u (size=%i), until [sn:%llu].\n",
             tid, tid, historyBuffer[tid].size(), inst_seq_num);
 
-    auto hb_it = historyBuffer[tid].end();
-
-    --hb_it;
-
     if (historyBuffer[tid].empty()) {
         DPRINTF(Rename, "[tid:%i] History buffer is empty.\n", tid);
         return;
-    } else if (hb_it->instSeqNum > inst_seq_num) {
+    } else if (historyBuffer[tid].front().instSeqNum > inst_seq_num) {
         DPRINTF(Rename, "[tid:%i] [sn:%llu] "
                 "Old sequence number encountered. "
                 "Ensure that a syscall happened recently.\n",
@@ -983,8 +982,8 @@ Rename::removeFromHistory(InstSeqNum inst_seq_num, ThreadID tid)
     // rename histories if they did not have destination registers that were
     // renamed.
     while (!historyBuffer[tid].empty() &&
-           hb_it != historyBuffer[tid].end() &&
-           hb_it->instSeqNum <= inst_seq_num) {
+           historyBuffer[tid].front().instSeqNum <= inst_seq_num) {
+        const RenameHistory *hb_it = &historyBuffer[tid].front();
 
         DPRINTF(Rename, "[tid:%i] Freeing up older rename of reg %i (%s), "
                 "[sn:%llu].\n",
@@ -1001,7 +1000,7 @@ Rename::removeFromHistory(InstSeqNum inst_seq_num, ThreadID tid)
 
         ++stats.committedMaps;
 
-        historyBuffer[tid].erase(hb_it--);
+        historyBuffer[tid].pop_front();
     }
 }
 
@@ -1112,11 +1111,14 @@ Rename::renameDestRegs(const DynInstPtr &inst, ThreadID tid)
                                rename_result.first,
                                rename_result.second);
 
-        historyBuffer[tid].push_front(hb_entry);
+        if (historyBuffer[tid].full()) {
+            historyBuffer[tid].reserve(2 * historyBuffer[tid].capacity());
+        }
+        historyBuffer[tid].push_back(hb_entry);
 
         DPRINTF(Rename, "[tid:%i] [sn:%llu] "
                 "Adding instruction to history buffer (size=%i).\n",
-                tid,(*historyBuffer[tid].begin()).instSeqNum,
+                tid, historyBuffer[tid].back().instSeqNum,
                 historyBuffer[tid].size());
 
         // Tell the instruction to rename the appropriate destination
@@ -1410,13 +1412,13 @@ Rename::incrFullStat(const FullSource &source)
 void
 Rename::dumpHistory()
 {
-    std::list<RenameHistory>::iterator buf_it;
-
     for (ThreadID tid = 0; tid < numThreads; tid++) {
 
-        buf_it = historyBuffer[tid].begin();
+        // Dump the most recent renames first.
+        for (size_t idx = historyBuffer[tid].tail() + 1;
+             idx-- > historyBuffer[tid].head();) {
+            const RenameHistory *buf_it = &historyBuffer[tid][idx];
 
-        while (buf_it != historyBuffer[tid].end()) {
             cprintf("Seq num: %i\nArch reg[%s]: %i New phys reg:"
                     " %i[%s] Old phys reg: %i[%s]\n",
                     (*buf_it).instSeqNum,
@@ -1426,8 +1428,6 @@ Rename::dumpHistory()
                     (*buf_it).newPhysReg->className(),
                     (*buf_it).prevPhysReg->index(),
                     (*buf_it).prevPhysReg->className());
-
-            buf_it++;
         }
     }
 }
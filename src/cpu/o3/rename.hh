@@ -45,6 +45,7 @@
 #include <list>
 #include <utility>
 
+#include "base/circular_queue.hh"
 #include "base/statistics.hh"
 #include "cpu/o3/comm.hh"
 #include "cpu/o3/commit.hh"
@@ -296,6 +297,8 @@ class Rename
      */
     struct RenameHistory
     {
+        RenameHistory() = default;
+
         RenameHistory(InstSeqNum _instSeqNum, const RegId& _archReg,
                       PhysRegIdPtr _newPhysReg,
                       PhysRegIdPtr _prevPhysReg)
@@ -305,20 +308,22 @@ class Rename
         }
 
         /** The sequence number of the instruction that renamed. */
-        InstSeqNum instSeqNum;
+        InstSeqNum instSeqNum = 0;
         /** The architectural register index that was renamed. */
         RegId archReg;
         /** The new physical register that the arch. register is renamed to. */
-        PhysRegIdPtr newPhysReg;
+        PhysRegIdPtr newPhysReg = nullptr;
         /** The old physical register that the arch. register was renamed to.
          */
-        PhysRegIdPtr prevPhysReg;
+        PhysRegIdPtr prevPhysReg = nullptr;
     };
 
     /** A per-thread list of all destination register renames, used to either
-     * undo rename mappings or free old physical registers.
+     * undo rename mappings or free old physical registers. The oldest rename
+     * is at the front, so squashes remove entries from the back and commits
+     * from the front.
      */
-    std::list<RenameHistory> historyBuffer[MaxThreads];
+    CircularQueue<RenameHistory> historyBuffer[MaxThreads];
 
     /** Pointer to CPU. */
     CPU *cpu;
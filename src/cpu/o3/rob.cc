@@ -97,6 +97,12 @@ ROB::ROB(CPU *_cpu, const BaseO3CPUParams &params)
         maxEntries[tid] = 0;
     }
 
+    // Any thread can use the whole ROB when the policy allows it, or after
+    // the entries are redistributed between the active threads.
+    for (ThreadID tid = 0; tid < numThreads; tid++) {
+        instList[tid].reserve(numEntries);
+    }
+
     resetState();
 }
 
@@ -105,7 +111,7 @@ ROB::resetState()
 {
     for (ThreadID tid = 0; tid  < MaxThreads; tid++) {
         threadEntries[tid] = 0;
-        squashIt[tid] = instList[tid].end();
+        squashIt[tid] = InstIt();
         squashedSeqNum[tid] = 0;
         doneSquashing[tid] = true;
     }
@@ -113,8 +119,8 @@ ROB::resetState()
 
     // Initialize the "universal" ROB head & tail point to invalid
     // pointers
-    head = instList[0].end();
-    tail = instList[0].end();
+    head = InstIt();
+    tail = InstIt();
 }
 
 std::string
@@ -214,10 +220,7 @@ ROB::insertInst(const DynInstPtr &inst)
         assert((*head) == inst);
     }
 
-    //Must Decrement for iterator to actually be valid  since __.end()
-    //actually points to 1 after the last inst
-    tail = instList[tid].end();
-    tail--;
+    tail = instList[tid].getIterator(instList[tid].tail());
 
     inst->setInROB();
 
@@ -237,11 +240,10 @@ ROB::retireHead(ThreadID tid)
 
     assert(numInstsInROB > 0);
 
-    // Get the head ROB instruction by copying it and remove it from the list
-    InstIt head_it = instList[tid].begin();
-
-    DynInstPtr head_inst = std::move(*head_it);
-    instList[tid].erase(head_it);
+    // Get the head ROB instruction by moving it out of its entry, which
+    // leaves the entry empty, and remove the entry from the list
+    DynInstPtr head_inst = std::move(instList[tid].front());
+    instList[tid].pop_front();
 
     assert(head_inst->readyToCommit());
 
@@ -312,13 +314,13 @@ ROB::doSquash(ThreadID tid)
     DPRINTF(ROB, "[tid:%i] Squashing instructions until [sn:%llu].\n",
             tid, squashedSeqNum[tid]);
 
-    assert(squashIt[tid] != instList[tid].end());
+    assert(squashIt[tid] != InstIt());
 
     if ((*squashIt[tid])->seqNum < squashedSeqNum[tid]) {
         DPRINTF(ROB, "[tid:%i] Done squashing instructions.\n",
                 tid);
 
-        squashIt[tid] = instList[tid].end();
+        squashIt[tid] = InstIt();
 
         doneSquashing[tid] = true;
         return;
@@ -338,7 +340,7 @@ ROB::doSquash(ThreadID tid)
 
     for (int numSquashed = 0;
          numSquashed < numInstsToSquash &&
-         squashIt[tid] != instList[tid].end() &&
+         squashIt[tid] != InstIt() &&
          (*squashIt[tid])->seqNum > squashedSeqNum[tid];
          ++numSquashed)
     {
@@ -358,17 +360,14 @@ ROB::doSquash(ThreadID tid)
             DPRINTF(ROB, "Reached head of instruction list while "
                     "squashing.\n");
 
-            squashIt[tid] = instList[tid].end();
+            squashIt[tid] = InstIt();
 
             doneSquashing[tid] = true;
 
             return;
         }
 
-        InstIt tail_thread = instList[tid].end();
-        tail_thread--;
-
-        if ((*squashIt[tid]) == (*tail_thread))
+        if ((*squashIt[tid]) == instList[tid].back())
             robTailUpdate = true;
 
         squashIt[tid]--;
@@ -380,7 +379,7 @@ ROB::doSquash(ThreadID tid)
         DPRINTF(ROB, "[tid:%i] Done squashing instructions.\n",
                 tid);
 
-        squashIt[tid] = instList[tid].end();
+        squashIt[tid] = InstIt();
 
         doneSquashing[tid] = true;
     }
@@ -427,7 +426,7 @@ ROB::updateHead()
     }
 
     if (first_valid) {
-        head = instList[0].end();
+        head = InstIt();
     }
 
 }
@@ -435,7 +434,7 @@ ROB::updateHead()
 void
 ROB::updateTail()
 {
-    tail = instList[0].end();
+    tail = InstIt();
     bool first_valid = true;
 
     std::list<ThreadID>::iterator threads = activeThreads->begin();
@@ -451,16 +450,15 @@ ROB::updateTail()
         // If this is the first valid then assign w/out
         // comparison
         if (first_valid) {
-            tail = instList[tid].end();
-            tail--;
+            tail = instList[tid].getIterator(instList[tid].tail());
             first_valid = false;
             continue;
         }
 
         // Assign new tail if this thread's tail is younger
         // than our current "tail high"
-        InstIt tail_thread = instList[tid].end();
-        tail_thread--;
+        InstIt tail_thread =
+            instList[tid].getIterator(instList[tid].tail());
 
         if ((*tail_thread)->seqNum > (*tail)->seqNum) {
             tail = tail_thread;
@@ -489,10 +487,7 @@ ROB::squash(InstSeqNum squash_num, ThreadID tid)
     squashedSeqNum[tid] = squash_num;
 
     if (!instList[tid].empty()) {
-        InstIt tail_thread = instList[tid].end();
-        tail_thread--;
-
-        squashIt[tid] = tail_thread;
+        squashIt[tid] = instList[tid].getIterator(instList[tid].tail());
 
         doSquash(tid);
     }
@@ -502,11 +497,11 @@ const DynInstPtr&
 ROB::readHeadInst(ThreadID tid)
 {
     if (threadEntries[tid] != 0) {
-        InstIt head_thread = instList[tid].begin();
+        const DynInstPtr &head_inst = instList[tid].front();
 
-        assert((*head_thread)->isInROB());
+        assert(head_inst->isInROB());
 
-        return *head_thread;
+        return head_inst;
     } else {
         return dummyInst;
     }
@@ -515,10 +510,7 @@ ROB::readHeadInst(ThreadID tid)
 DynInstPtr
 ROB::readTailInst(ThreadID tid)
 {
-    InstIt tail_thread = instList[tid].end();
-    tail_thread--;
-
-    return *tail_thread;
+    return instList[tid].back();
 }
 
 ROB::ROBStats::ROBStats(statistics::Group *parent)
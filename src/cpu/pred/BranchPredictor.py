@@ -67,6 +67,15 @@ class BranchPredictor(SimObject):
     BTBTagSize = Param.Unsigned(16, "Size of the BTB tags, in bits")
     RASSize = Param.Unsigned(16, "RAS size")
     instShiftAmt = Param.Unsigned(2, "Number of bits to shift instructions by")
+    profileHostTime = Param.Bool(
+        False, "Account the host time spent in the predictor in its stats"
+    )
+    randomSeed = Param.UInt32(
+        0,
+        "Seed of the predictor's own random number generator, 0 to draw "
+        "from the global one. Predictors that use random numbers and run "
+        "on different event queues need their own one.",
+    )
 
     indirectBranchPred = Param.IndirectPredictor(
         SimpleIndirectPredictor(),
@@ -117,6 +126,9 @@ class TAGEBase(SimObject):
     instShiftAmt = Param.Unsigned(
         Parent.instShiftAmt, "Number of bits to shift instructions by"
     )
+    randomSeed = Param.UInt32(
+        Parent.randomSeed, "Seed of the own random number generator"
+    )
 
     nHistoryTables = Param.Unsigned(7, "Number of history tables")
     minHist = Param.Unsigned(5, "Minimum history size of TAGE")
@@ -186,6 +198,9 @@ class LoopPredictor(SimObject):
     cxx_class = "gem5::branch_prediction::LoopPredictor"
     cxx_header = "cpu/pred/loop_predictor.hh"
 
+    randomSeed = Param.UInt32(
+        Parent.randomSeed, "Seed of the own random number generator"
+    )
     logSizeLoopPred = Param.Unsigned(8, "Log size of the loop predictor")
     withLoopBits = Param.Unsigned(7, "Size of the WITHLOOP counter")
     loopTableAgeBits = Param.Unsigned(8, "Number of age bits per loop entry")
@@ -35,6 +35,7 @@
 
 #include "base/sat_counter.hh"
 #include "cpu/pred/bpred_unit.hh"
+#include "cpu/pred/history_pool.hh"
 #include "params/BiModeBP.hh"
 
 namespace gem5
@@ -71,7 +72,7 @@ class BiModeBP : public BPredUnit
   private:
     void updateGlobalHistReg(ThreadID tid, bool taken);
 
-    struct BPHistory
+    struct BPHistory : public PooledHistory
     {
         unsigned globalHistoryReg;
         // was the taken array's prediction used?
@@ -58,6 +58,7 @@ namespace branch_prediction
 BPredUnit::BPredUnit(const Params &params)
     : SimObject(params),
       numThreads(params.numThreads),
+      profileHostTime(params.profileHostTime),
       predHist(numThreads),
       BTB(params.BTBEntries,
           params.BTBTagSize,
@@ -66,7 +67,9 @@ BPredUnit::BPredUnit(const Params &params)
       RAS(numThreads),
       iPred(params.indirectBranchPred),
       stats(this),
-      instShiftAmt(params.instShiftAmt)
+      instShiftAmt(params.instShiftAmt),
+      ownRandom(params.randomSeed),
+      rng(params.randomSeed ? ownRandom : random_mt)
 {
     for (auto& r : RAS)
         r.init(params.RASSize);
@@ -98,9 +101,20 @@ BPredUnit::BPredUnitStats::BPredUnitStats(statistics::Group *parent)
       ADD_STAT(indirectMisses, statistics::units::Count::get(),
                "Number of indirect misses."),
       ADD_STAT(indirectMispredicted, statistics::units::Count::get(),
-               "Number of mispredicted indirect branches.")
+               "Number of mispredicted indirect branches."),
+      ADD_STAT(hostPredictTime, statistics::units::Second::get(),
+               "Host time spent predicting branches"),
+      ADD_STAT(hostUpdateTime, statistics::units::Second::get(),
+               "Host time spent updating the predictor"),
+      ADD_STAT(hostSquashTime, statistics::units::Second::get(),
+               "Host time spent squashing the predictor")
 {
     BTBHitRatio.precision(6);
+
+    // only reported when profiling the host time
+    hostPredictTime.flags(statistics::nozero);
+    hostUpdateTime.flags(statistics::nozero);
+    hostSquashTime.flags(statistics::nozero);
 }
 
 probing::PMUUPtr
@@ -137,6 +151,8 @@ BPredUnit::predict(const StaticInstPtr &inst, const InstSeqNum &seqNum,
     // Save off record of branch stuff so the RAS can be fixed
     // up once it's done.
 
+    HostTimer timer(profileHostTime, stats.hostPredictTime);
+
     bool pred_taken = false;
     std::unique_ptr<PCStateBase> target(pc.clone());
 
@@ -312,6 +328,8 @@ BPredUnit::update(const InstSeqNum &done_sn, ThreadID tid)
     DPRINTF(Branch, "[tid:%i] Committing branches until "
             "sn:%llu]\n", tid, done_sn);
 
+    HostTimer timer(profileHostTime, stats.hostUpdateTime);
+
     while (!predHist[tid].empty() &&
            predHist[tid].back().seqNum <= done_sn) {
         // Update the branch predictor with the correct results.
@@ -331,6 +349,14 @@ BPredUnit::update(const InstSeqNum &done_sn, ThreadID tid)
 
 void
 BPredUnit::squash(const InstSeqNum &squashed_sn, ThreadID tid)
+{
+    HostTimer timer(profileHostTime, stats.hostSquashTime);
+
+    squashHistory(squashed_sn, tid);
+}
+
+void
+BPredUnit::squashHistory(const InstSeqNum &squashed_sn, ThreadID tid)
 {
     History &pred_hist = predHist[tid];
 
@@ -400,6 +426,8 @@ BPredUnit::squash(const InstSeqNum &squashed_sn,
     //     PC-relative, branch was predicted incorrectly. If so, a signal
     //     to the fetch stage is sent to squash history after the mispredict
 
+    HostTimer timer(profileHostTime, stats.hostSquashTime);
+
     History &pred_hist = predHist[tid];
 
     ++stats.condIncorrect;
@@ -409,7 +437,7 @@ BPredUnit::squash(const InstSeqNum &squashed_sn,
             "setting target to %s\n", tid, squashed_sn, corr_target);
 
     // Squash All Branches AFTER this mispredicted branch
-    squash(squashed_sn, tid);
+    squashHistory(squashed_sn, tid);
 
     // If there's a squash due to a syscall, there may not be an entry
     // corresponding to the squash.  In that case, don't bother trying to
@@ -42,11 +42,14 @@
 #ifndef __CPU_PRED_BPRED_UNIT_HH__
 #define __CPU_PRED_BPRED_UNIT_HH__
 
+#include <chrono>
 #include <deque>
 
+#include "base/random.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/pred/btb.hh"
+#include "cpu/pred/history_pool.hh"
 #include "cpu/pred/indirect.hh"
 #include "cpu/pred/ras.hh"
 #include "cpu/inst_seq.hh"
@@ -199,6 +202,9 @@ class BPredUnit : public SimObject
     void dump();
 
   private:
+    /** Squashes the history of all branches younger than squashed_sn. */
+    void squashHistory(const InstSeqNum &squashed_sn, ThreadID tid);
+
     struct PredictorHistory
     {
         /**
@@ -281,11 +287,42 @@ class BPredUnit : public SimObject
         const StaticInstPtr inst;
     };
 
-    typedef std::deque<PredictorHistory> History;
+    typedef std::deque<PredictorHistory, HistoryAllocator<PredictorHistory>>
+        History;
 
     /** Number of the threads for which the branch history is maintained. */
     const unsigned numThreads;
 
+    /** Whether to account the host time spent in the predictor. */
+    const bool profileHostTime;
+
+    /**
+     * Adds the host time spent in its scope to a stat, if host time is
+     * being profiled.
+     */
+    class HostTimer
+    {
+      public:
+        HostTimer(bool enabled, statistics::Scalar &_stat)
+            : stat(enabled ? &_stat : nullptr)
+        {
+            if (stat)
+                start = std::chrono::steady_clock::now();
+        }
+
+        ~HostTimer()
+        {
+            if (stat) {
+                *stat += std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start).count();
+            }
+        }
+
+      private:
+        statistics::Scalar *stat;
+        std::chrono::steady_clock::time_point start;
+    };
+
 
     /**
      * The per-thread predictor history. This is used to update the predictor
@@ -334,12 +371,28 @@ class BPredUnit : public SimObject
         statistics::Scalar indirectMisses;
         /** Stat for the number of indirect target mispredictions.*/
         statistics::Scalar indirectMispredicted;
+
+        /** Host time spent predicting branches, if profiled. */
+        statistics::Scalar hostPredictTime;
+        /** Host time spent updating the predictor, if profiled. */
+        statistics::Scalar hostUpdateTime;
+        /** Host time spent squashing the predictor, if profiled. */
+        statistics::Scalar hostSquashTime;
     } stats;
 
   protected:
     /** Number of bits to shift instructions by for predictor addresses. */
     const unsigned instShiftAmt;
 
+    /** Random number generator of the predictor, if it is seeded. */
+    Random ownRandom;
+
+    /**
+     * Random number generator drawn from by the predictor: its own one if
+     * it is seeded, the global one otherwise.
+     */
+    Random &rng;
+
     /**
      * @{
      * @name PMU Probe points.
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_FOLDED_HISTORIES_HH__
+#define __CPU_PRED_FOLDED_HISTORIES_HH__
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+/**
+ * Folded histories - compressed histories to mix with instruction PC to
+ * index partially tagged tables.
+ *
+ * The folded histories of all the tables of a TAGE predictor, for the
+ * index and the two tag hashes, are kept as a structure of arrays.
+ * Updating all of them on every branch is then a single loop without
+ * dependencies between iterations, which the compiler can vectorize, and
+ * saving or restoring them for a branch is a single copy.
+ */
+class FoldedHistories
+{
+  public:
+    enum Kind
+    {
+        Index = 0,
+        Tag0,
+        Tag1,
+        NumKinds
+    };
+
+    /**
+     * Allocate the folded histories of tables 0 to num_tables - 1,
+     * which are all empty until initialized.
+     */
+    void
+    resize(int num_tables)
+    {
+        numTables = num_tables;
+        comp.assign(NumKinds * num_tables, 0);
+        compLength.assign(NumKinds * num_tables, 0);
+        compMask.assign(NumKinds * num_tables, 0);
+        origLength.assign(NumKinds * num_tables, 0);
+        outpoint.assign(NumKinds * num_tables, 0);
+    }
+
+    void
+    init(Kind kind, int table, int original_length,
+         int compressed_length)
+    {
+        const int i = kind * numTables + table;
+        origLength[i] = original_length;
+        compLength[i] = compressed_length;
+        compMask[i] = (1ULL << compressed_length) - 1;
+        outpoint[i] = original_length % compressed_length;
+    }
+
+    /** Folded history of a table for its index. */
+    unsigned
+    index(int table) const
+    {
+        return comp[Index * numTables + table];
+    }
+
+    /** Folded history of a table for the first or second tag hash. */
+    unsigned
+    tag(int which, int table) const
+    {
+        return comp[(Tag0 + which) * numTables + table];
+    }
+
+    /** Number of values saved for a branch by save(). */
+    int size() const { return comp.size(); }
+
+    /** Shift the most recent outcome in h[0] into all histories. */
+    void
+    update(const uint8_t *h)
+    {
+        const unsigned newest = h[0];
+        unsigned *const c = comp.data();
+        const int n = comp.size();
+        for (int i = 0; i < n; i++) {
+            unsigned v = (c[i] << 1) | newest;
+            v ^= unsigned(h[origLength[i]]) << outpoint[i];
+            v ^= v >> compLength[i];
+            c[i] = v & compMask[i];
+        }
+    }
+
+    void
+    save(int *dest) const
+    {
+        std::copy(comp.begin(), comp.end(), dest);
+    }
+
+    void
+    restore(const int *src)
+    {
+        std::copy(src, src + comp.size(), comp.begin());
+    }
+
+  private:
+    int numTables = 0;
+    std::vector<unsigned> comp;
+    std::vector<unsigned> compLength;
+    std::vector<unsigned> compMask;
+    std::vector<int> origLength;
+    std::vector<unsigned> outpoint;
+};
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_FOLDED_HISTORIES_HH__
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "cpu/pred/folded_histories.hh"
+
+using namespace gem5::branch_prediction;
+
+namespace
+{
+
+/** A single folded history, updated as the TAGE predictors used to. */
+struct FoldedHistory
+{
+    unsigned comp = 0;
+    int compLength;
+    int origLength;
+    int outpoint;
+
+    FoldedHistory(int original_length, int compressed_length)
+        : compLength(compressed_length), origLength(original_length),
+          outpoint(original_length % compressed_length)
+    {}
+
+    void
+    update(const uint8_t *h)
+    {
+        comp = (comp << 1) | h[0];
+        comp ^= h[origLength] << outpoint;
+        comp ^= (comp >> compLength);
+        comp &= (1ULL << compLength) - 1;
+    }
+};
+
+/** Geometric history lengths and table widths, as in a TAGE predictor */
+constexpr int NumTables = 12;
+const int histLengths[NumTables] =
+    {4, 6, 10, 16, 25, 40, 64, 101, 160, 254, 403, 640};
+const int indexBits[NumTables] = {10, 10, 10, 10, 11, 11, 11, 11, 10, 10,
+                                  10, 10};
+const int tagBits[NumTables] = {7, 7, 8, 8, 9, 10, 11, 12, 12, 13, 14, 15};
+
+} // anonymous namespace
+
+TEST(FoldedHistoriesTest, MatchesFoldedHistory)
+{
+    FoldedHistories folded;
+    folded.resize(NumTables);
+
+    std::vector<FoldedHistory> index, tag0, tag1;
+    for (int i = 0; i < NumTables; i++) {
+        folded.init(FoldedHistories::Index, i, histLengths[i], indexBits[i]);
+        folded.init(FoldedHistories::Tag0, i, histLengths[i], tagBits[i]);
+        folded.init(FoldedHistories::Tag1, i, histLengths[i],
+                    tagBits[i] - 1);
+        index.emplace_back(histLengths[i], indexBits[i]);
+        tag0.emplace_back(histLengths[i], tagBits[i]);
+        tag1.emplace_back(histLengths[i], tagBits[i] - 1);
+    }
+
+    // The global history grows downwards, the newest outcome being at
+    // h[0], as in the predictors
+    const int num_branches = 200000;
+    const int max_length = histLengths[NumTables - 1];
+    std::vector<uint8_t> ghist(num_branches + max_length + 1, 0);
+    std::mt19937 rng(1);
+
+    for (int n = 0; n < num_branches; n++) {
+        uint8_t *h = &ghist[num_branches - n];
+        h[0] = rng() & 1;
+
+        folded.update(h);
+        for (int i = 0; i < NumTables; i++) {
+            index[i].update(h);
+            tag0[i].update(h);
+            tag1[i].update(h);
+        }
+
+        for (int i = 0; i < NumTables; i++) {
+            ASSERT_EQ(folded.index(i), index[i].comp);
+            ASSERT_EQ(folded.tag(0, i), tag0[i].comp);
+            ASSERT_EQ(folded.tag(1, i), tag1[i].comp);
+        }
+    }
+}
+
+TEST(FoldedHistoriesTest, SaveRestore)
+{
+    FoldedHistories folded;
+    folded.resize(NumTables);
+    for (int i = 0; i < NumTables; i++) {
+        folded.init(FoldedHistories::Index, i, histLengths[i], indexBits[i]);
+        folded.init(FoldedHistories::Tag0, i, histLengths[i], tagBits[i]);
+        folded.init(FoldedHistories::Tag1, i, histLengths[i],
+                    tagBits[i] - 1);
+    }
+    ASSERT_EQ(folded.size(), FoldedHistories::NumKinds * NumTables);
+
+    const int max_length = histLengths[NumTables - 1];
+    std::vector<uint8_t> ghist(1000 + max_length + 1, 0);
+    std::mt19937 rng(2);
+    for (int n = 0; n < 500; n++) {
+        uint8_t *h = &ghist[1000 - n];
+        h[0] = rng() & 1;
+        folded.update(h);
+    }
+
+    std::vector<int> saved(folded.size());
+    folded.save(saved.data());
+
+    // Speculate down a wrong path, then restore the saved state
+    for (int n = 500; n < 1000; n++) {
+        uint8_t *h = &ghist[1000 - n];
+        h[0] = rng() & 1;
+        folded.update(h);
+    }
+
+    FoldedHistories restored = folded;
+    restored.restore(saved.data());
+    std::vector<int> after(folded.size());
+    restored.save(after.data());
+    EXPECT_EQ(after, saved);
+}
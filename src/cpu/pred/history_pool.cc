@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/history_pool.hh"
+
+#include <cassert>
+#include <new>
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+HistoryPool::Pool &
+HistoryPool::pool()
+{
+    thread_local Pool _pool;
+    return _pool;
+}
+
+void *
+HistoryPool::allocate(std::size_t size)
+{
+    if (size == 0 || size > MaxSize)
+        return ::operator new(size);
+
+    Pool &p = pool();
+    const std::size_t size_class = sizeClass(size);
+
+    FreeSlot *&free_list = p.freeLists[size_class - 1];
+    if (free_list) {
+        FreeSlot *slot = free_list;
+        free_list = slot->next;
+        return slot;
+    }
+
+    const std::size_t slot_size = size_class * Granule;
+    if (p.chunkLeft < slot_size) {
+        // The rest of the current chunk is too small for this size class,
+        // it stays unused.
+        p.chunks.emplace_back(new std::byte[ChunkSize]);
+        p.chunkPos = p.chunks.back().get();
+        p.chunkLeft = ChunkSize;
+    }
+
+    void *slot = p.chunkPos;
+    p.chunkPos += slot_size;
+    p.chunkLeft -= slot_size;
+    return slot;
+}
+
+void
+HistoryPool::release(void *ptr, std::size_t size)
+{
+    if (!ptr)
+        return;
+
+    if (size == 0 || size > MaxSize) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    Pool &p = pool();
+    FreeSlot *&free_list = p.freeLists[sizeClass(size) - 1];
+    FreeSlot *slot = new (ptr) FreeSlot{free_list};
+    free_list = slot;
+}
+
+} // namespace branch_prediction
+} // namespace gem5
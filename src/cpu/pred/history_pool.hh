@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_HISTORY_POOL_HH__
+#define __CPU_PRED_HISTORY_POOL_HH__
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+/**
+ * Storage for the state that the branch predictors keep for every
+ * predicted branch until it commits or is squashed. Rather than going to
+ * the heap for every branch, the storage is carved out of large chunks and
+ * recycled through one free list per size class, so that once the pool
+ * has grown to the number of branches in flight, predicting a branch does
+ * not allocate memory any more. Recently freed slots are reused first,
+ * which keeps the in-flight histories in a small, cache-friendly region.
+ *
+ * There is one pool per host thread, since the branch predictors of a CPU
+ * only allocate and free history in the thread that simulates the CPU.
+ */
+class HistoryPool
+{
+  public:
+    /** Granularity of the size classes, which is also the alignment. */
+    static constexpr std::size_t Granule = 16;
+
+    /** Largest size served from the pool, larger sizes use the heap. */
+    static constexpr std::size_t MaxSize = 1024;
+
+    /** Size of the chunks slots are carved from. */
+    static constexpr std::size_t ChunkSize = 64 * 1024;
+
+    /** Allocates storage for the history of a branch. */
+    static void *allocate(std::size_t size);
+
+    /**
+     * Releases storage previously returned by allocate().
+     * @param size The size that was allocated.
+     */
+    static void release(void *ptr, std::size_t size);
+
+  private:
+    struct FreeSlot
+    {
+        FreeSlot *next;
+    };
+
+    struct Pool
+    {
+        std::array<FreeSlot *, MaxSize / Granule> freeLists{};
+        std::vector<std::unique_ptr<std::byte[]>> chunks;
+        std::byte *chunkPos = nullptr;
+        std::size_t chunkLeft = 0;
+    };
+
+    static Pool &pool();
+
+    static std::size_t
+    sizeClass(std::size_t size)
+    {
+        return (size + Granule - 1) / Granule;
+    }
+};
+
+/**
+ * Base class for the per-branch history of the branch predictors, which
+ * makes new and delete of the history use the HistoryPool.
+ */
+struct PooledHistory
+{
+    static void *
+    operator new(std::size_t size)
+    {
+        return HistoryPool::allocate(size);
+    }
+
+    static void
+    operator delete(void *ptr, std::size_t size)
+    {
+        HistoryPool::release(ptr, size);
+    }
+};
+
+/**
+ * Allocator that takes the storage of a container of histories from the
+ * HistoryPool, so that the container does not go to the heap either as it
+ * grows and shrinks with the branches in flight.
+ */
+template <class T>
+struct HistoryAllocator
+{
+    using value_type = T;
+
+    HistoryAllocator() = default;
+
+    template <class U>
+    HistoryAllocator(const HistoryAllocator<U> &) {}
+
+    T *
+    allocate(std::size_t n)
+    {
+        return static_cast<T *>(HistoryPool::allocate(n * sizeof(T)));
+    }
+
+    void
+    deallocate(T *ptr, std::size_t n)
+    {
+        HistoryPool::release(ptr, n * sizeof(T));
+    }
+
+    template <class U>
+    bool operator==(const HistoryAllocator<U> &) const { return true; }
+
+    template <class U>
+    bool operator!=(const HistoryAllocator<U> &) const { return false; }
+};
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_HISTORY_POOL_HH__
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <thread>
+#include <vector>
+
+#include "cpu/pred/history_pool.hh"
+
+using namespace gem5;
+using namespace gem5::branch_prediction;
+
+namespace
+{
+
+struct TestHistory : public PooledHistory
+{
+    TestHistory(uint64_t value=0) : values{value} {}
+
+    uint64_t values[5];
+};
+
+} // anonymous namespace
+
+TEST(HistoryPoolTest, Recycle)
+{
+    void *first = HistoryPool::allocate(40);
+    void *second = HistoryPool::allocate(40);
+    EXPECT_NE(first, second);
+
+    // Freed slots are reused most recently freed first, by any size of
+    // the same size class
+    HistoryPool::release(first, 40);
+    HistoryPool::release(second, 40);
+    EXPECT_EQ(HistoryPool::allocate(33), second);
+    EXPECT_EQ(HistoryPool::allocate(48), first);
+
+    // Other size classes do not share the free slots
+    HistoryPool::release(first, 48);
+    EXPECT_NE(HistoryPool::allocate(64), first);
+    EXPECT_EQ(HistoryPool::allocate(40), first);
+
+    HistoryPool::release(first, 40);
+    HistoryPool::release(second, 33);
+}
+
+TEST(HistoryPoolTest, Alignment)
+{
+    for (std::size_t size = 1; size <= HistoryPool::MaxSize; size += 7) {
+        void *ptr = HistoryPool::allocate(size);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % HistoryPool::Granule,
+                  0);
+        HistoryPool::release(ptr, size);
+    }
+}
+
+TEST(HistoryPoolTest, Large)
+{
+    // Sizes larger than the pool serves go to the heap, and are usable
+    const std::size_t size = HistoryPool::MaxSize + 1;
+    uint8_t *ptr = static_cast<uint8_t *>(HistoryPool::allocate(size));
+    ASSERT_NE(ptr, nullptr);
+    ptr[0] = 1;
+    ptr[size - 1] = 1;
+    HistoryPool::release(ptr, size);
+}
+
+TEST(HistoryPoolTest, ChunkBoundary)
+{
+    // Allocate more than a chunk worth of slots, all of them distinct
+    const std::size_t size = HistoryPool::MaxSize;
+    const std::size_t count = 2 * HistoryPool::ChunkSize / size + 1;
+    std::vector<uint8_t *> slots;
+    for (std::size_t i = 0; i < count; ++i) {
+        slots.push_back(static_cast<uint8_t *>(HistoryPool::allocate(size)));
+        std::fill(slots.back(), slots.back() + size, uint8_t(i));
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(slots[i][0], uint8_t(i));
+        EXPECT_EQ(slots[i][size - 1], uint8_t(i));
+        HistoryPool::release(slots[i], size);
+    }
+}
+
+TEST(HistoryPoolTest, PooledHistory)
+{
+    TestHistory *first = new TestHistory;
+    delete first;
+
+    // The history came from the pool, so its slot is reused right away
+    TestHistory *second = new TestHistory;
+    EXPECT_EQ(second, first);
+    delete second;
+}
+
+TEST(HistoryPoolTest, Allocator)
+{
+    std::deque<TestHistory, HistoryAllocator<TestHistory>> history;
+
+    // Let the container reach its steady state size
+    for (int i = 0; i < 1000; ++i)
+        history.push_front(TestHistory(i));
+    while (!history.empty())
+        history.pop_back();
+
+    // The container keeps working on the storage it freed and got back
+    for (int i = 0; i < 1000; ++i) {
+        history.push_front(TestHistory(i));
+        if (history.size() > 64) {
+            EXPECT_EQ(history.back().values[0], uint64_t(i) - 64);
+            history.pop_back();
+        }
+    }
+    EXPECT_EQ(history.size(), 64);
+    EXPECT_EQ(history.front().values[0], 999);
+}
+
+TEST(HistoryPoolTest, PerThread)
+{
+    // Each host thread has its own pool, so a slot freed in one thread is
+    // not handed out in another
+    void *main_slot = HistoryPool::allocate(16);
+    HistoryPool::release(main_slot, 16);
+
+    void *thread_slot = nullptr;
+    std::thread thread([&thread_slot]() {
+        thread_slot = HistoryPool::allocate(16);
+        HistoryPool::release(thread_slot, 16);
+    });
+    thread.join();
+
+    EXPECT_NE(thread_slot, main_slot);
+    EXPECT_EQ(HistoryPool::allocate(16), main_slot);
+    HistoryPool::release(main_slot, 16);
+}
@@ -34,8 +34,10 @@
 #ifndef __CPU_PRED_LOOP_PREDICTOR_HH__
 #define __CPU_PRED_LOOP_PREDICTOR_HH__
 
+#include "base/random.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
+#include "cpu/pred/history_pool.hh"
 #include "sim/sim_object.hh"
 
 namespace gem5
@@ -89,6 +91,15 @@ class LoopPredictor : public SimObject
     const unsigned initialLoopAge;
     const bool optionalAgeReset;
 
+    /** Random number generator of the predictor, if it is seeded. */
+    Random ownRandom;
+
+    /**
+     * Random number generator drawn from by the predictor: its own one if
+     * it is seeded, the global one otherwise.
+     */
+    Random &rng;
+
     struct LoopPredictorStats : public statistics::Group
     {
         LoopPredictorStats(statistics::Group *parent);
@@ -126,7 +137,7 @@ class LoopPredictor : public SimObject
     }
   public:
     // Primary branch history entry
-    struct BranchInfo
+    struct BranchInfo : public PooledHistory
     {
         uint16_t loopTag;
         uint16_t currentIter;
@@ -28,7 +28,10 @@
 
 #include "cpu/pred/simple_indirect.hh"
 
+#include <new>
+
 #include "base/intmath.hh"
+#include "cpu/pred/history_pool.hh"
 #include "debug/Indirect.hh"
 
 namespace gem5
@@ -71,7 +74,8 @@ SimpleIndirectPredictor::genIndirectInfo(ThreadID tid,
     // record the GHR as it was before this prediction
     // It will be used to recover the history in case this prediction is
     // wrong or belongs to bad path
-    indirect_history = new unsigned(threadInfo[tid].ghr);
+    indirect_history = new (HistoryPool::allocate(sizeof(unsigned)))
+        unsigned(threadInfo[tid].ghr);
 }
 
 void
@@ -134,7 +138,7 @@ SimpleIndirectPredictor::commit(InstSeqNum seq_num, ThreadID tid,
 
     // we do not need to recover the GHR, so delete the information
     unsigned * previousGhr = static_cast<unsigned *>(indirect_history);
-    delete previousGhr;
+    HistoryPool::release(previousGhr, sizeof(unsigned));
 
     if (t_info.pathHist.empty()) return;
 
@@ -174,7 +178,7 @@ SimpleIndirectPredictor::deleteIndirectInfo(ThreadID tid,
     unsigned * previousGhr = static_cast<unsigned *>(indirect_history);
     threadInfo[tid].ghr = *previousGhr;
 
-    delete previousGhr;
+    HistoryPool::release(previousGhr, sizeof(unsigned));
 }
 
 void
@@ -44,6 +44,7 @@
 
 #include "base/statistics.hh"
 #include "base/types.hh"
+#include "cpu/pred/history_pool.hh"
 #include "cpu/static_inst.hh"
 #include "sim/sim_object.hh"
 
@@ -197,7 +198,7 @@ class StatisticalCorrector : public SimObject
     } stats;
 
   public:
-    struct BranchInfo
+    struct BranchInfo : public PooledHistory
     {
         BranchInfo() : lowConf(false), highConf(false), altConf(false),
               medConf(false), scPred(false), lsum(0), thres(0),
@@ -52,6 +52,7 @@
 
 #include "base/types.hh"
 #include "cpu/pred/bpred_unit.hh"
+#include "cpu/pred/history_pool.hh"
 #include "cpu/pred/tage_base.hh"
 #include "params/TAGE.hh"
 
@@ -66,7 +67,7 @@ class TAGE: public BPredUnit
   protected:
     TAGEBase *tage;
 
-    struct TageBranchInfo
+    struct TageBranchInfo : public PooledHistory
     {
         TAGEBase::BranchInfo *tageBranchInfo;
 
@@ -50,8 +50,11 @@
 
 #include <vector>
 
+#include "base/random.hh"
 #include "base/statistics.hh"
 #include "cpu/null_static_inst.hh"
+#include "cpu/pred/folded_histories.hh"
+#include "cpu/pred/history_pool.hh"
 #include "cpu/static_inst.hh"
 #include "params/TAGEBase.hh"
 #include "sim/sim_object.hh"
@@ -80,38 +83,6 @@ class TAGEBase : public SimObject
         TageEntry() : ctr(0), tag(0), u(0) { }
     };
 
-    // Folded History Table - compressed history
-    // to mix with instruction PC to index partially
-    // tagged tables.
-    struct FoldedHistory
-    {
-        unsigned comp;
-        int compLength;
-        int origLength;
-        int outpoint;
-        int bufferSize;
-
-        FoldedHistory()
-        {
-            comp = 0;
-        }
-
-        void init(int original_length, int compressed_length)
-        {
-            origLength = original_length;
-            compLength = compressed_length;
-            outpoint = original_length % compressed_length;
-        }
-
-        void update(uint8_t * h)
-        {
-            comp = (comp << 1) | h[0];
-            comp ^= h[origLength] << outpoint;
-            comp ^= (comp >> compLength);
-            comp &= (1ULL << compLength) - 1;
-        }
-    };
-
   public:
 
     // provider type
@@ -125,7 +96,7 @@ class TAGEBase : public SimObject
     };
 
     // Primary branch history entry
-    struct BranchInfo
+    struct BranchInfo : public PooledHistory
     {
         int pathHist;
         int ptGhist;
@@ -142,18 +113,18 @@ class TAGEBase : public SimObject
         bool pseudoNewAlloc;
         Addr branchPC;
 
-        // Pointer to dynamically allocated storage
+        // Pointer to storage taken from the history pool
         // to save table indices and folded histories.
-        // To do one call to new instead of five.
+        // To do one allocation instead of three.
         int *storage;
+        std::size_t storageSize;
 
         // Pointers to actual saved array within the dynamically
         // allocated storage.
         int *tableIndices;
         int *tableTags;
-        int *ci;
-        int *ct0;
-        int *ct1;
+        // Folded histories, see FoldedHistories::save()
+        int *foldedHists;
 
         // for stats purposes
         unsigned provider;
@@ -169,17 +140,17 @@ class TAGEBase : public SimObject
               provider(-1)
         {
             int sz = tage.nHistoryTables + 1;
-            storage = new int [sz * 5];
+            storageSize = sz * 5 * sizeof(int);
+            storage = static_cast<int *>(
+                HistoryPool::allocate(storageSize));
             tableIndices = storage;
             tableTags = storage + sz;
-            ci = tableTags + sz;
-            ct0 = ci + sz;
-            ct1 = ct0 + sz;
+            foldedHists = tableTags + sz;
         }
 
         virtual ~BranchInfo()
         {
-            delete[] storage;
+            HistoryPool::release(storage, storageSize);
         }
     };
 
@@ -457,8 +428,7 @@ class TAGEBase : public SimObject
         int ptGhist;
 
         // Speculative folded histories.
-        FoldedHistory *computeIndices;
-        FoldedHistory *computeTags[2];
+        FoldedHistories foldedHistories;
     };
 
     std::vector<ThreadHistory> threadHistory;
@@ -491,6 +461,15 @@ class TAGEBase : public SimObject
 
     bool initialized;
 
+    /** Random number generator of the predictor, if it is seeded. */
+    Random ownRandom;
+
+    /**
+     * Random number generator drawn from by the predictor: its own one if
+     * it is seeded, the global one otherwise.
+     */
+    Random &rng;
+
     struct TAGEBaseStats : public statistics::Group
     {
         TAGEBaseStats(statistics::Group *parent, unsigned nHistoryTables);
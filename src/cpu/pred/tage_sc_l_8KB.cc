@@ -149,12 +149,12 @@ TAGE_SC_L_TAGE_8KB::initFoldedHistories(ThreadHistory & history)
     // Some hardcoded values are used here
     // (they do not seem to depend on any parameter)
     for (int i = 1; i <= nHistoryTables; i++) {
-        history.computeIndices[i].init(
+        history.foldedHistories.init(FoldedHistories::Index, i,
             histLengths[i], 17 + (2 * ((i - 1) / 2) % 4));
-        history.computeTags[0][i].init(
-            history.computeIndices[i].origLength, 13);
-        history.computeTags[1][i].init(
-            history.computeIndices[i].origLength, 11);
+        history.foldedHistories.init(FoldedHistories::Tag0, i,
+            histLengths[i], 13);
+        history.foldedHistories.init(FoldedHistories::Tag1, i,
+            histLengths[i], 11);
         DPRINTF(TageSCL, "HistLength:%d, TTSize:%d, TTTWidth:%d\n",
                 histLengths[i], logTagTableSizes[i], tagTableTagWidths[i]);
     }
@@ -170,16 +170,16 @@ TAGE_SC_L_TAGE_8KB::gindex_ext(int index, int bank) const
 uint16_t
 TAGE_SC_L_TAGE_8KB::gtag(ThreadID tid, Addr pc, int bank) const
 {
-    int tag = (threadHistory[tid].computeIndices[bank - 1].comp << 2) ^ pc ^
-              (pc >> instShiftAmt) ^
-              threadHistory[tid].computeIndices[bank].comp;
+    int tag = (threadHistory[tid].foldedHistories.index(bank - 1) << 2) ^
+              pc ^ (pc >> instShiftAmt) ^
+              threadHistory[tid].foldedHistories.index(bank);
     int hlen = (histLengths[bank] > pathHistBits) ? pathHistBits :
                                                     histLengths[bank];
 
     tag = (tag >> 1) ^ ((tag & 1) << 10) ^
            F(threadHistory[tid].pathHist, hlen, bank);
-    tag ^= threadHistory[tid].computeTags[0][bank].comp ^
-           (threadHistory[tid].computeTags[1][bank].comp << 1);
+    tag ^= threadHistory[tid].foldedHistories.tag(0, bank) ^
+           (threadHistory[tid].foldedHistories.tag(1, bank) << 1);
 
     return ((tag ^ (tag >> tagTableTagWidths[bank]))
             & ((1ULL << tagTableTagWidths[bank]) - 1));
@@ -208,7 +208,7 @@ TAGE_SC_L_TAGE_8KB::handleAllocAndUReset(
             if (noSkip[i]) {
                 if (gtable[i][bi->tableIndices[i]].u == 0) {
                     gtable[i][bi->tableIndices[i]].u =
-                        ((random_mt.random<int>() & 31) == 0);
+                        ((rng.random<int>() & 31) == 0);
                     // protect randomly from fast replacement
                     gtable[i][bi->tableIndices[i]].tag = bi->tableTags[i];
                     gtable[i][bi->tableIndices[i]].ctr = taken ? 0 : -1;
@@ -223,7 +223,7 @@ TAGE_SC_L_TAGE_8KB::handleAllocAndUReset(
                     int8_t ctr = gtable[i][bi->tableIndices[i]].ctr;
                     if ((gtable[i][bi->tableIndices[i]].u == 1) &
                         (abs (2 * ctr + 1) == 1)) {
-                        if ((random_mt.random<int>() & 7) == 0) {
+                        if ((rng.random<int>() & 7) == 0) {
                             gtable[i][bi->tableIndices[i]].u = 0;
                         }
                     } else {
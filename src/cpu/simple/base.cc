@@ -220,9 +220,9 @@ BaseSimpleCPU::haltContext(ThreadID thread_num)
 }
 
 void
-BaseSimpleCPU::resetStats()
+BaseSimpleCPU::postResetStats()
 {
-    BaseCPU::resetStats();
+    BaseCPU::postResetStats();
     for (auto &thread_info : threadInfo) {
         thread_info->execContextStats.notIdleFraction = (_status != Idle);
     }
@@ -143,7 +143,7 @@ class BaseSimpleCPU : public BaseCPU
     void haltContext(ThreadID thread_num) override;
 
     // statistics
-    void resetStats() override;
+    void postResetStats() override;
 
     virtual Fault
     readMem(Addr addr, uint8_t* data, unsigned size, Request::Flags flags,
@@ -70,8 +70,8 @@ SimPoint::regProbeListeners()
 {
     typedef ProbeListenerArg<SimPoint, std::pair<SimpleThread*,StaticInstPtr>>
         SimPointListener;
-    listeners.push_back(new SimPointListener(this, "Commit",
-                                             &SimPoint::profile));
+    registerListener(new SimPointListener(this, "Commit",
+                                          &SimPoint::profile));
 }
 
 void
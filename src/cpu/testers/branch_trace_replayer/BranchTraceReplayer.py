@@ -0,0 +1,71 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.objects.ClockedObject import ClockedObject
+
+
+class BranchTraceReplayer(ClockedObject):
+    """
+    Replays a branch trace through a branch predictor, without a CPU, to
+    evaluate predictors quickly. Every branch is predicted and resolved
+    through the same interface the O3 CPU uses, including the BTB, RAS and
+    indirect predictor of the predictor. The trace is in the protobuf format
+    of src/proto/branch.proto, as recorded by the BranchTrace probe of the O3
+    CPU or extracted from an Exec trace with util/extract_branch_trace.py.
+
+    The trace is read once for all replayers using the same file. Placing
+    each replayer on its own event queue evaluates several predictors in
+    parallel, see configs/example/bpred_trace_eval.py.
+    """
+
+    type = "BranchTraceReplayer"
+    cxx_header = "cpu/testers/branch_trace_replayer/branch_trace_replayer.hh"
+    cxx_class = "gem5::BranchTraceReplayer"
+
+    bpred = Param.BranchPredictor("Branch predictor to evaluate")
+
+    # Resolved by the predictor through its parent, as for a CPU
+    numThreads = Param.Unsigned(
+        1, "Number of threads of the predictor, only thread 0 is replayed"
+    )
+
+    trace_file = Param.String("Branch trace to replay")
+
+    batch_size = Param.Unsigned(
+        100000, "Number of branches replayed by each event"
+    )
+
+    update_delay = Param.Unsigned(
+        16,
+        "Number of younger branches predicted before a branch updates the "
+        "predictor, standing for the delay until the branch commits",
+    )
+
+    max_branches = Param.Counter(
+        0, "Number of trace branches to replay before stopping, 0 for all"
+    )
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/testers/branch_trace_replayer/branch_trace_replayer.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "cpu/static_inst.hh"
+#include "debug/BranchTraceReplayer.hh"
+#include "proto/branch.pb.h"
+#include "proto/protoio.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+/**
+ * Static instruction standing for a branch of the trace, which only
+ * carries the control flags the branch predictor looks at.
+ */
+class TraceBranchInst : public StaticInst
+{
+  public:
+    TraceBranchInst(uint8_t branch_flags)
+        : StaticInst("trace branch", No_OpClass)
+    {
+        using ProtoMessage::Branch;
+
+        flags[IsControl] = true;
+        if (branch_flags & Branch::Conditional)
+            flags[IsCondControl] = true;
+        else
+            flags[IsUncondControl] = true;
+        if (branch_flags & Branch::Indirect)
+            flags[IsIndirectControl] = true;
+        else
+            flags[IsDirectControl] = true;
+        flags[IsCall] = branch_flags & Branch::Call;
+        flags[IsReturn] = branch_flags & Branch::Return;
+    }
+
+    Fault
+    execute(ExecContext *xc, trace::InstRecord *traceData) const override
+    {
+        panic("Trace branches cannot be executed\n");
+    }
+
+    void
+    advancePC(PCStateBase &pc) const override
+    {
+        pc.advance();
+    }
+
+    std::unique_ptr<PCStateBase>
+    buildRetPC(const PCStateBase &cur_pc,
+               const PCStateBase &call_pc) const override
+    {
+        // the next PC of a call is the address following it
+        std::unique_ptr<PCStateBase> ret_pc(call_pc.clone());
+        ret_pc->advance();
+        return ret_pc;
+    }
+
+    std::string
+    generateDisassembly(Addr pc,
+            const loader::SymbolTable *symtab) const override
+    {
+        return mnemonic;
+    }
+};
+
+/** Number of distinct combinations of Branch::Flags */
+constexpr unsigned NumBranchTypes = 16;
+
+/** Largest instruction size expected when inferring the size of a call */
+constexpr Addr MaxInstSize = 16;
+
+/** Size assumed for the branches whose size cannot be inferred */
+constexpr uint8_t DefaultInstSize = 4;
+
+} // anonymous namespace
+
+std::atomic<unsigned> BranchTraceReplayer::numActive(0);
+
+BranchTraceReplayer::BranchTraceReplayer(const Params &p)
+    : ClockedObject(p),
+      replayEvent([this]{ replay(); }, name()),
+      bpred(p.bpred),
+      trace(getTrace(p.trace_file)),
+      batchSize(p.batch_size),
+      updateDelay(p.update_delay),
+      numBranches(p.max_branches == 0 ? trace->size() :
+                  std::min<size_t>(p.max_branches, trace->size())),
+      nextBranch(0),
+      seqNum(0),
+      stats(this)
+{
+    fatal_if(batchSize == 0, "%s: batch size must be non-zero\n", name());
+
+    for (unsigned type = 0; type < NumBranchTypes; ++type)
+        branchInsts.push_back(new TraceBranchInst(type));
+
+    ++numActive;
+}
+
+std::shared_ptr<const BranchTraceReplayer::BranchTrace>
+BranchTraceReplayer::getTrace(const std::string &file_name)
+{
+    static std::mutex tracesMutex;
+    static std::map<std::string, std::shared_ptr<const BranchTrace>> traces;
+
+    std::lock_guard<std::mutex> lock(tracesMutex);
+    auto it = traces.find(file_name);
+    if (it != traces.end())
+        return it->second;
+
+    ProtoInputStream input(file_name);
+    ProtoMessage::BranchHeader header_msg;
+    if (!input.read(header_msg))
+        fatal("Failed to read branch trace header from %s\n", file_name);
+
+    auto trace = std::make_shared<BranchTrace>();
+    ProtoMessage::Branch branch_msg;
+    while (input.read(branch_msg)) {
+        BranchRecord branch;
+        branch.pc = branch_msg.pc();
+        branch.target = branch_msg.target();
+        branch.insts = branch_msg.has_insts() ? branch_msg.insts() : 1;
+        branch.size = branch_msg.has_size() ? branch_msg.size() : 0;
+        branch.flags = branch_msg.flags() % NumBranchTypes;
+        branch.taken = branch_msg.taken();
+        trace->push_back(branch);
+    }
+
+    // The size of a taken branch cannot be observed in the trace, but the
+    // size of a call is what gives the return address the RAS predicts,
+    // so recover it from the target of the matching return.
+    std::vector<size_t> calls;
+    for (size_t idx = 0; idx < trace->size(); ++idx) {
+        const BranchRecord &branch = (*trace)[idx];
+        if (!branch.taken)
+            continue;
+
+        if ((branch.flags & ProtoMessage::Branch::Return) && !calls.empty()) {
+            BranchRecord &call = (*trace)[calls.back()];
+            calls.pop_back();
+            if (call.size == 0 && branch.target > call.pc &&
+                branch.target - call.pc <= MaxInstSize) {
+                call.size = branch.target - call.pc;
+            }
+        }
+        if (branch.flags & ProtoMessage::Branch::Call)
+            calls.push_back(idx);
+    }
+
+    for (auto &branch : *trace) {
+        if (branch.size == 0)
+            branch.size = DefaultInstSize;
+    }
+
+    inform("Read %d branches from %s\n", trace->size(), file_name);
+
+    traces[file_name] = trace;
+    return trace;
+}
+
+void
+BranchTraceReplayer::startup()
+{
+    schedule(replayEvent, curTick());
+}
+
+void
+BranchTraceReplayer::replay()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    const size_t end = std::min<size_t>(nextBranch + batchSize, numBranches);
+    while (nextBranch < end)
+        replayBranch((*trace)[nextBranch++]);
+
+    const bool done = nextBranch == numBranches;
+    if (done) {
+        // commit the branches still waiting for their update
+        bpred->update(seqNum, 0);
+    }
+
+    stats.hostSeconds += std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    if (done)
+        finish();
+    else
+        schedule(replayEvent, clockEdge(Cycles(1)));
+}
+
+void
+BranchTraceReplayer::replayBranch(const BranchRecord &branch)
+{
+    const Addr fall_through = branch.pc + branch.size;
+    const bool cond = branch.flags & ProtoMessage::Branch::Conditional;
+
+    // the next PC holds the fall-through address, which is where
+    // not-taken branches and the RAS get it from
+    pc.set(branch.pc);
+    pc.npc(fall_through);
+
+    ++seqNum;
+    const bool pred_taken =
+        bpred->predict(branchInsts[branch.flags], seqNum, pc, 0);
+
+    ++stats.branches;
+    if (cond)
+        ++stats.condBranches;
+    stats.insts += branch.insts;
+
+    const Addr next_pc = branch.taken ? branch.target : fall_through;
+    if (pc.instAddr() != next_pc) {
+        DPRINTF(BranchTraceReplayer, "[sn:%llu] Mispredicted branch at "
+                "%#x, predicted %#x instead of %#x\n", seqNum, branch.pc,
+                pc.instAddr(), next_pc);
+
+        ++stats.mispredicts;
+        if (cond && pred_taken != branch.taken)
+            ++stats.condMispredicts;
+        else
+            ++stats.targetMispredicts;
+
+        GenericISA::SimplePCState<4> corr_target(next_pc);
+        bpred->squash(seqNum, corr_target, branch.taken, 0);
+    }
+
+    if (seqNum > updateDelay)
+        bpred->update(seqNum - updateDelay, 0);
+}
+
+void
+BranchTraceReplayer::finish()
+{
+    DPRINTF(BranchTraceReplayer, "Done replaying %d branches\n",
+            numBranches);
+
+    if (--numActive == 0)
+        exitSimLoop("all branch traces replayed");
+}
+
+BranchTraceReplayer::ReplayerStats::ReplayerStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(branches, statistics::units::Count::get(),
+               "Number of branches replayed"),
+      ADD_STAT(condBranches, statistics::units::Count::get(),
+               "Number of conditional branches replayed"),
+      ADD_STAT(insts, statistics::units::Count::get(),
+               "Number of instructions covered by the replayed branches"),
+      ADD_STAT(mispredicts, statistics::units::Count::get(),
+               "Number of mispredicted branches"),
+      ADD_STAT(condMispredicts, statistics::units::Count::get(),
+               "Number of conditional branches with a mispredicted "
+               "direction"),
+      ADD_STAT(targetMispredicts, statistics::units::Count::get(),
+               "Number of other mispredictions, i.e., of the BTB, RAS or "
+               "indirect predictor"),
+      ADD_STAT(mispredictRate, statistics::units::Ratio::get(),
+               "Fraction of branches mispredicted"),
+      ADD_STAT(mpki, statistics::units::Rate<
+                  statistics::units::Count, statistics::units::Count>::get(),
+               "Mispredictions per thousand instructions"),
+      ADD_STAT(hostSeconds, statistics::units::Second::get(),
+               "Host time spent replaying the trace"),
+      ADD_STAT(hostBranchRate, statistics::units::Rate<
+                  statistics::units::Count, statistics::units::Second>::get(),
+               "Branches replayed per host second")
+{
+    mispredictRate = mispredicts / branches;
+    mpki = mispredicts * 1000 / insts;
+    hostBranchRate = branches / hostSeconds;
+    hostBranchRate.precision(0);
+}
+
+} // namespace gem5
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_TESTERS_BRANCH_TRACE_REPLAYER_BRANCH_TRACE_REPLAYER_HH__
+#define __CPU_TESTERS_BRANCH_TRACE_REPLAYER_BRANCH_TRACE_REPLAYER_HH__
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arch/generic/pcstate.hh"
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "cpu/inst_seq.hh"
+#include "cpu/pred/bpred_unit.hh"
+#include "cpu/static_inst_fwd.hh"
+#include "params/BranchTraceReplayer.hh"
+#include "sim/clocked_object.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+/**
+ * The BranchTraceReplayer feeds a branch trace directly to a branch
+ * predictor, without a CPU model, to compare predictors at a fraction of
+ * the cost of a detailed simulation. Every branch is predicted through
+ * the same BPredUnit interface the O3 CPU uses, i.e., including the BTB,
+ * the RAS and the indirect predictor, and is resolved right away. A
+ * mispredicted branch squashes the predictor with the actual outcome, and
+ * the predictor is updated once a configurable number of younger branches
+ * has been predicted, to mimic the delay between prediction and commit.
+ *
+ * The trace is read once and shared by all replayers using the same file,
+ * so that several predictors can be evaluated on it in one process. Each
+ * replayer can be placed on its own event queue to replay the trace with
+ * all predictors in parallel. The simulation exits once all replayers are
+ * done.
+ */
+class BranchTraceReplayer : public ClockedObject
+{
+  public:
+    typedef BranchTraceReplayerParams Params;
+    BranchTraceReplayer(const Params &p);
+
+    void startup() override;
+
+    /** A branch of the trace. */
+    struct BranchRecord
+    {
+        Addr pc;
+        Addr target;
+        /** Instructions since the previous branch, including this one */
+        uint32_t insts;
+        /** Size of the branch, which gives its fall-through PC */
+        uint8_t size;
+        /** Branch::Flags of the trace */
+        uint8_t flags;
+        bool taken;
+    };
+
+    typedef std::vector<BranchRecord> BranchTrace;
+
+  protected:
+    /**
+     * Get the trace in a file, reading it on first use.
+     *
+     * @param file_name Name of the trace file
+     * @return The branches of the trace
+     */
+    static std::shared_ptr<const BranchTrace>
+    getTrace(const std::string &file_name);
+
+    /** Replay a batch of branches. */
+    void replay();
+
+    EventFunctionWrapper replayEvent;
+
+    /** Predict, resolve and update a branch. */
+    void replayBranch(const BranchRecord &branch);
+
+    /** Account for a replayer that is done and exit when all are. */
+    void finish();
+
+    branch_prediction::BPredUnit *const bpred;
+
+    const std::shared_ptr<const BranchTrace> trace;
+
+    const unsigned batchSize;
+
+    const unsigned updateDelay;
+
+    /** Number of branches to replay */
+    const size_t numBranches;
+
+    /** Index of the next branch to replay */
+    size_t nextBranch;
+
+    /** Sequence number of the last branch predicted */
+    InstSeqNum seqNum;
+
+    /** PC handed to the branch predictor */
+    GenericISA::SimplePCState<4> pc;
+
+    /** Static instructions for every combination of branch flags */
+    std::vector<StaticInstPtr> branchInsts;
+
+    /** Number of replayers that still have branches to replay */
+    static std::atomic<unsigned> numActive;
+
+    struct ReplayerStats : public statistics::Group
+    {
+        ReplayerStats(statistics::Group *parent);
+
+        statistics::Scalar branches;
+        statistics::Scalar condBranches;
+        statistics::Scalar insts;
+        statistics::Scalar mispredicts;
+        statistics::Scalar condMispredicts;
+        statistics::Scalar targetMispredicts;
+        statistics::Formula mispredictRate;
+        statistics::Formula mpki;
+        statistics::Scalar hostSeconds;
+        statistics::Formula hostBranchRate;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif // __CPU_TESTERS_BRANCH_TRACE_REPLAYER_BRANCH_TRACE_REPLAYER_HH__
@@ -0,0 +1,59 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import SimObject
+
+
+class CompressorTest(SimObject):
+    """
+    Checks that the size-only compression path of the cache compressors
+    agrees with the full compression. Every cache line of a fixed set of
+    edge cases, followed by random lines, is compressed with compress() by
+    each of the compressors, and with compressSize() by the matching
+    compressor of size_compressors, which must be configured the same way.
+    The sizes and latencies must be equal, and so must the stats of both
+    compressors, which the test config compares at the end. The
+    simulation exits once all lines have been checked.
+    """
+
+    type = "CompressorTest"
+    cxx_header = "cpu/testers/compressor_test/compressor_test.hh"
+    cxx_class = "gem5::CompressorTest"
+
+    compressors = VectorParam.BaseCacheCompressor(
+        "Compressors checked with the full compression"
+    )
+    size_compressors = VectorParam.BaseCacheCompressor(
+        "Compressors checked with the size-only compression"
+    )
+
+    block_size = Param.Int(Parent.cache_line_size, "Block size in bytes")
+    random_lines = Param.Unsigned(
+        10000, "Number of random lines checked after the edge cases"
+    )
+    seed = Param.UInt32(1, "Seed of the random lines")
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/testers/compressor_test/compressor_test.hh"
+
+#include <string>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+#include "mem/cache/compressors/base.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+CompressorTest::CompressorTest(const Params &p)
+    : SimObject(p), compressors(p.compressors),
+      sizeCompressors(p.size_compressors), lineWords(p.block_size / 8),
+      randomLines(p.random_lines), rng(p.seed)
+{
+    fatal_if(compressors.size() != sizeCompressors.size(),
+             "%s: Each compressor needs an identical size-only compressor",
+             name());
+    fatal_if(p.block_size % 8 || !lineWords,
+             "%s: The block size must be a multiple of 8 bytes", name());
+}
+
+std::vector<CompressorTest::Line>
+CompressorTest::edgeCases() const
+{
+    std::vector<Line> lines;
+    auto add = [&](auto &&word) {
+        Line line(lineWords);
+        for (unsigned i = 0; i < lineWords; ++i)
+            line[i] = word(i);
+        lines.push_back(line);
+    };
+
+    // Lines made of a single value
+    add([](unsigned i) { return 0ULL; });
+    add([](unsigned i) { return ~0ULL; });
+    add([](unsigned i) { return 0x0123456789abcdefULL; });
+
+    // Repeated values other than the first one
+    add([](unsigned i) { return i ? 0xfedcba9876543210ULL : 1ULL; });
+    add([&](unsigned i) {
+        return i + 1 < lineWords ? 0x1111111111111111ULL : 2ULL;
+    });
+    add([](unsigned i) {
+        return i % 2 ? 0xaaaaaaaaaaaaaaaaULL : 0x5555555555555555ULL;
+    });
+    add([](unsigned i) { return 0x1000ULL * (i % 3); });
+
+    // Zeros in the first or last word only, and runs of zeros
+    add([](unsigned i) { return i ? 0x0123456789abcdefULL + i : 0ULL; });
+    add([&](unsigned i) { return i + 1 < lineWords ? 0ULL : 0x42ULL; });
+    add([](unsigned i) { return i % 4 ? 0ULL : 0x8000000000000000ULL; });
+    add([](unsigned i) { return i % 2 ? 0ULL : 0x12345678ULL; });
+
+    // Small values, positive and negative, in 32- and 64-bit chunks
+    add([](unsigned i) { return uint64_t(i) << 32 | (i * 3); });
+    add([](unsigned i) { return 0xfffffff0fffffff8ULL - i; });
+    add([](unsigned i) { return uint64_t(-int64_t(i) * 1000); });
+    add([](unsigned i) { return 0x00007fff00008000ULL + i; });
+
+    // A common base with deltas of increasing sizes, and deltas that are
+    // only small from the zero base
+    add([](unsigned i) { return 0x7fff000000000000ULL + i; });
+    add([](unsigned i) { return 0x7fff000000000000ULL + i * 0x100; });
+    add([](unsigned i) { return 0x7fff000000000000ULL + i * 0x10000; });
+    add([](unsigned i) {
+        return i % 2 ? i : 0x7fff000000000000ULL + i * 0x80;
+    });
+    add([](unsigned i) { return 0x12345678ULL + i * 0x7f; });
+
+    // Halfwords and bytes that are padded or repeated
+    add([](unsigned i) { return 0x0000abcd00001234ULL + i; });
+    add([](unsigned i) { return 0xabcd00001234000ULL << (i % 2); });
+    add([](unsigned i) { return 0x7a7a7a7a7a7a7a7aULL; });
+    add([](unsigned i) { return 0xffff8000007f0001ULL + i; });
+
+    // Words that partially match earlier ones
+    add([](unsigned i) { return 0xdeadbe00deadbe00ULL | i; });
+    add([](unsigned i) { return 0xdead0000dead0000ULL | (i << 8 | i); });
+
+    // All different
+    add([](unsigned i) {
+        return 0x9e3779b97f4a7c15ULL * (i + 1) ^ 0xbf58476d1ce4e5b9ULL;
+    });
+
+    return lines;
+}
+
+CompressorTest::Line
+CompressorTest::randomLine()
+{
+    uint64_t values[4];
+    for (auto &value : values)
+        value = rng.random<uint64_t>();
+
+    Line line(lineWords);
+    for (auto &word : line) {
+        const uint64_t value = values[rng.random<unsigned>(0, 3)];
+        switch (rng.random<unsigned>(0, 5)) {
+          case 0:
+            word = value;
+            break;
+          case 1:
+            word = value ^ rng.random<uint64_t>(0, 0xff);
+            break;
+          case 2:
+            word = value + rng.random<uint64_t>(0, 0xffff);
+            break;
+          case 3:
+            word = rng.random<uint64_t>(0, 0xff);
+            break;
+          case 4:
+            word = uint64_t(-int64_t(rng.random<uint64_t>(0, 0x7fff)));
+            break;
+          default:
+            word = 0;
+        }
+    }
+    return line;
+}
+
+void
+CompressorTest::check(compression::Base &full, compression::Base &size_only,
+                      const Line &line)
+{
+    Cycles comp_lat, decomp_lat;
+    const std::size_t size_bits =
+        full.compress(line.data(), comp_lat, decomp_lat)->getSizeBits();
+
+    Cycles size_comp_lat, size_decomp_lat;
+    const std::size_t size_only_bits = size_only.compressSize(
+        line.data(), size_comp_lat, size_decomp_lat);
+
+    if (size_bits == size_only_bits && comp_lat == size_comp_lat &&
+            decomp_lat == size_decomp_lat) {
+        return;
+    }
+
+    std::string words;
+    for (auto word : line)
+        words += csprintf(" %#018x", word);
+    panic("%s: compress() gives %d bits and latencies %d/%d, while "
+          "compressSize() gives %d bits and latencies %d/%d, for line%s",
+          full.name(), size_bits, comp_lat, decomp_lat, size_only_bits,
+          size_comp_lat, size_decomp_lat, words);
+}
+
+void
+CompressorTest::startup()
+{
+    std::vector<Line> lines = edgeCases();
+    for (unsigned i = 0; i < randomLines; ++i)
+        lines.push_back(randomLine());
+
+    for (size_t c = 0; c < compressors.size(); ++c) {
+        for (const auto &line : lines)
+            check(*compressors[c], *sizeCompressors[c], line);
+    }
+
+    inform("%s: %d lines compressed alike by %d compressor pairs", name(),
+           lines.size(), compressors.size());
+    exitSimLoop("compressor test complete");
+}
+
+} // namespace gem5
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_TESTERS_COMPRESSOR_TEST_COMPRESSOR_TEST_HH__
+#define __CPU_TESTERS_COMPRESSOR_TEST_COMPRESSOR_TEST_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/random.hh"
+#include "params/CompressorTest.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+namespace compression
+{
+class Base;
+} // namespace compression
+
+/**
+ * The CompressorTest checks that the size-only compression path of the
+ * cache compressors, compressSize(), gives the same size and latencies
+ * as the full compression, compress(). Each compressor is paired with
+ * an identical one, so that both paths update their own stats, which
+ * must also end up equal. The lines are a set of edge cases for the
+ * compressors, followed by random lines made of a few distinct values.
+ */
+class CompressorTest : public SimObject
+{
+  public:
+    typedef CompressorTestParams Params;
+    CompressorTest(const Params &p);
+
+    void startup() override;
+
+  protected:
+    typedef std::vector<uint64_t> Line;
+
+    /** Lines that exercise the corner cases of the compressors. */
+    std::vector<Line> edgeCases() const;
+
+    /** A random line, with values drawn from a small set. */
+    Line randomLine();
+
+    /** Compress a line along both paths and compare the results. */
+    void check(compression::Base &full, compression::Base &size_only,
+               const Line &line);
+
+    const std::vector<compression::Base *> compressors;
+
+    const std::vector<compression::Base *> sizeCompressors;
+
+    /** Number of 64-bit words in a line */
+    const unsigned lineWords;
+
+    const unsigned randomLines;
+
+    Random rng;
+};
+
+} // namespace gem5
+
+#endif // __CPU_TESTERS_COMPRESSOR_TEST_COMPRESSOR_TEST_HH__
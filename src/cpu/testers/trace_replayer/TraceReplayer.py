@@ -0,0 +1,69 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.objects.ClockedObject import ClockedObject
+
+
+class TraceReplayer(ClockedObject):
+    """
+    Replays a memory-access trace, sending the accesses to the memory system
+    as fast as it accepts them, ignoring the timestamps of the trace. This is
+    meant to evaluate caches, replacement policies and prefetchers without a
+    CPU. The trace uses the packet trace format of CommMonitor's
+    MemTraceProbe, which can also be produced from text traces with
+    util/encode_packet_trace.py.
+
+    In atomic mode, accesses are replayed back to back in batches. Since the
+    caches do not prefetch in atomic mode, timing mode must be used to
+    evaluate prefetchers, in which case a window of accesses is kept in
+    flight.
+    """
+
+    type = "TraceReplayer"
+    cxx_header = "cpu/testers/trace_replayer/trace_replayer.hh"
+    cxx_class = "gem5::TraceReplayer"
+
+    system = Param.System(Parent.any, "System this replayer is part of")
+
+    port = RequestPort("Port to the memory system")
+
+    trace_file = Param.String("Packet trace to replay")
+
+    batch_size = Param.Unsigned(
+        1024,
+        "Number of packets replayed by each event in atomic mode, time "
+        "advances by the latency of the whole batch",
+    )
+
+    max_outstanding = Param.Unsigned(
+        16, "Maximum number of accesses in flight in timing mode"
+    )
+
+    max_accesses = Param.Counter(
+        0, "Number of trace accesses to replay before stopping, 0 for all"
+    )
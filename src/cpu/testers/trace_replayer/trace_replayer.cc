@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/testers/trace_replayer/trace_replayer.hh"
+
+#include <algorithm>
+#include <cstring>
+
+#include "base/chunk_generator.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/TraceReplayer.hh"
+#include "proto/packet.pb.h"
+#include "sim/core.hh"
+#include "sim/sim_exit.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+std::atomic<unsigned> TraceReplayer::numActive(0);
+
+TraceReplayer::TraceReplayer(const Params &p)
+    : ClockedObject(p),
+      replayEvent([this]{ replay(); }, name()),
+      port(name() + ".port", *this),
+      trace(p.trace_file),
+      atomic(p.system->isAtomicMode()),
+      batchSize(p.batch_size),
+      maxOutstanding(p.max_outstanding),
+      maxAccesses(p.max_accesses),
+      blockSize(p.system->cacheLineSize()),
+      requestorId(p.system->getRequestorId(this)),
+      retryPkt(nullptr),
+      numOutstanding(0),
+      numAccesses(0),
+      traceDone(false),
+      stats(this)
+{
+    fatal_if(batchSize == 0, "%s: batch size must be non-zero\n", name());
+    fatal_if(maxOutstanding == 0,
+             "%s: maximum number of outstanding accesses must be non-zero\n",
+             name());
+
+    // Create a protobuf message for the header and read it from the stream
+    ProtoMessage::PacketHeader header_msg;
+    if (!trace.read(header_msg)) {
+        panic("Failed to read packet header from trace\n");
+    } else if (header_msg.tick_freq() != sim_clock::Frequency) {
+        panic("Trace was recorded with a different tick frequency %d\n",
+              header_msg.tick_freq());
+    }
+
+    ++numActive;
+}
+
+Port &
+TraceReplayer::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "port")
+        return port;
+    else
+        return ClockedObject::getPort(if_name, idx);
+}
+
+void
+TraceReplayer::init()
+{
+    ClockedObject::init();
+
+    fatal_if(!port.isConnected(), "%s: port is not connected\n", name());
+}
+
+void
+TraceReplayer::startup()
+{
+    schedule(replayEvent, curTick());
+}
+
+PacketPtr
+TraceReplayer::nextPacket()
+{
+    while (pendingPkts.empty()) {
+        ProtoMessage::Packet pkt_msg;
+        if (traceDone || (maxAccesses != 0 && numAccesses == maxAccesses) ||
+            !trace.read(pkt_msg)) {
+            traceDone = true;
+            return nullptr;
+        }
+
+        ++numAccesses;
+
+        const MemCmd cmd(static_cast<MemCmd::Command>(pkt_msg.cmd()));
+        const Addr addr = pkt_msg.addr();
+        const unsigned size = pkt_msg.size();
+        const Request::FlagsType flags =
+            pkt_msg.has_flags() ? pkt_msg.flags() : 0;
+
+        if ((!cmd.isRead() && !cmd.isWrite()) || size == 0) {
+            DPRINTF(TraceReplayer, "Skipping %s access to %#x of %d bytes\n",
+                    cmd.toString(), addr, size);
+            continue;
+        }
+
+        // the caches only deal with accesses within a cache line
+        for (ChunkGenerator gen(addr, size, blockSize); !gen.done();
+             gen.next()) {
+            RequestPtr req = std::make_shared<Request>(
+                gen.addr(), gen.size(), flags, requestorId);
+            PacketPtr pkt = new Packet(req, cmd.isRead() ? MemCmd::ReadReq :
+                                       MemCmd::WriteReq);
+            pkt->allocate();
+            if (pkt->isWrite()) {
+                // keep the written data deterministic
+                std::memset(pkt->getPtr<uint8_t>(), 0, pkt->getSize());
+            }
+            pendingPkts.push_back(pkt);
+        }
+    }
+
+    PacketPtr pkt = pendingPkts.front();
+    pendingPkts.pop_front();
+    return pkt;
+}
+
+void
+TraceReplayer::replay()
+{
+    if (atomic) {
+        Tick latency = 0;
+        for (unsigned i = 0; i < batchSize; ++i) {
+            PacketPtr pkt = nextPacket();
+            if (!pkt) {
+                // account for the latency of a partial last batch before
+                // finishing, the next event finds the trace done
+                if (latency > 0)
+                    schedule(replayEvent, curTick() + latency);
+                else
+                    finish();
+                return;
+            }
+
+            const Tick pkt_latency = port.sendAtomic(pkt);
+            complete(pkt, pkt_latency);
+            latency += pkt_latency;
+        }
+
+        // make sure that time moves forward even if the memory system
+        // reported no latency at all
+        schedule(replayEvent, curTick() + std::max(latency, Tick(1)));
+    } else {
+        while (!retryPkt && numOutstanding < maxOutstanding) {
+            PacketPtr pkt = nextPacket();
+            if (!pkt) {
+                if (numOutstanding == 0)
+                    finish();
+                return;
+            }
+
+            if (port.sendTimingReq(pkt)) {
+                ++numOutstanding;
+            } else {
+                DPRINTF(TraceReplayer, "Waiting for retry\n");
+                retryPkt = pkt;
+            }
+        }
+    }
+}
+
+void
+TraceReplayer::recvTimingResp(PacketPtr pkt)
+{
+    assert(numOutstanding > 0);
+    --numOutstanding;
+
+    complete(pkt, curTick() - pkt->req->time());
+
+    // refill the window
+    if (!replayEvent.scheduled())
+        schedule(replayEvent, curTick());
+}
+
+void
+TraceReplayer::recvReqRetry()
+{
+    assert(retryPkt);
+
+    if (port.sendTimingReq(retryPkt)) {
+        retryPkt = nullptr;
+        ++numOutstanding;
+        replay();
+    }
+}
+
+void
+TraceReplayer::complete(PacketPtr pkt, Tick latency)
+{
+    if (pkt->isRead())
+        ++stats.numReads;
+    else
+        ++stats.numWrites;
+
+    stats.totalLatency += latency;
+
+    delete pkt;
+}
+
+void
+TraceReplayer::finish()
+{
+    DPRINTF(TraceReplayer, "Done replaying %d accesses\n", numAccesses);
+
+    if (--numActive == 0)
+        exitSimLoop("all traces replayed");
+}
+
+TraceReplayer::ReplayerStats::ReplayerStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(numReads, statistics::units::Count::get(),
+               "Number of read packets sent to the memory system"),
+      ADD_STAT(numWrites, statistics::units::Count::get(),
+               "Number of write packets sent to the memory system"),
+      ADD_STAT(totalLatency, statistics::units::Tick::get(),
+               "Total latency of the packets"),
+      ADD_STAT(avgLatency, statistics::units::Rate<
+                  statistics::units::Tick, statistics::units::Count>::get(),
+               "Average latency of the packets")
+{
+    avgLatency = totalLatency / (numReads + numWrites);
+}
+
+} // namespace gem5
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_TESTERS_TRACE_REPLAYER_TRACE_REPLAYER_HH__
+#define __CPU_TESTERS_TRACE_REPLAYER_TRACE_REPLAYER_HH__
+
+#include <atomic>
+#include <deque>
+
+#include "base/statistics.hh"
+#include "mem/port.hh"
+#include "params/TraceReplayer.hh"
+#include "proto/protoio.hh"
+#include "sim/clocked_object.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+/**
+ * The TraceReplayer reads a packet trace and sends every access to the
+ * memory system as soon as it is accepted, with no CPU in the way and
+ * without following the timestamps of the trace. Accesses that cross a
+ * cache line are split.
+ *
+ * In atomic mode, the accesses are replayed in batches, each batch being a
+ * single event, and simulated time advances by the latency of the batch so
+ * that the stats of the memory system remain meaningful. In timing mode, a
+ * window of accesses is kept in flight.
+ *
+ * Several replayers driving independent memory systems can be placed on
+ * different event queues to evaluate multiple configurations in parallel
+ * in a single process. The simulation exits once all replayers are done.
+ */
+class TraceReplayer : public ClockedObject
+{
+  public:
+    typedef TraceReplayerParams Params;
+    TraceReplayer(const Params &p);
+
+    void init() override;
+    void startup() override;
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+
+  protected:
+    class ReplayerPort : public RequestPort
+    {
+        TraceReplayer &replayer;
+
+      public:
+        ReplayerPort(const std::string &_name, TraceReplayer &_replayer)
+            : RequestPort(_name), replayer(_replayer)
+        { }
+
+      protected:
+        bool
+        recvTimingResp(PacketPtr pkt) override
+        {
+            replayer.recvTimingResp(pkt);
+            return true;
+        }
+
+        void recvReqRetry() override { replayer.recvReqRetry(); }
+    };
+
+    /** Replay accesses, in a batch in atomic mode or up to the window. */
+    void replay();
+
+    EventFunctionWrapper replayEvent;
+
+    /**
+     * Get the next packet to send, reading the trace if needed.
+     *
+     * @return The next packet, or nullptr if the replay is done
+     */
+    PacketPtr nextPacket();
+
+    void recvTimingResp(PacketPtr pkt);
+
+    void recvReqRetry();
+
+    /**
+     * Account for a completed packet.
+     *
+     * @param pkt The packet
+     * @param latency Latency of the access
+     */
+    void complete(PacketPtr pkt, Tick latency);
+
+    /** Account for a replayer that is done and exit when all are. */
+    void finish();
+
+    ReplayerPort port;
+
+    ProtoInputStream trace;
+
+    const bool atomic;
+
+    const unsigned batchSize;
+
+    const unsigned maxOutstanding;
+
+    const Counter maxAccesses;
+
+    const unsigned blockSize;
+
+    /** Request id for all replayed traffic */
+    const RequestorID requestorId;
+
+    /** Packets of the current trace access still to be sent */
+    std::deque<PacketPtr> pendingPkts;
+
+    /** Packet waiting for a retry */
+    PacketPtr retryPkt;
+
+    /** Number of packets in flight in timing mode */
+    unsigned numOutstanding;
+
+    /** Number of trace accesses read so far */
+    Counter numAccesses;
+
+    /** Set once the whole trace has been read */
+    bool traceDone;
+
+    /** Number of replayers that still have accesses to replay */
+    static std::atomic<unsigned> numActive;
+
+    struct ReplayerStats : public statistics::Group
+    {
+        ReplayerStats(statistics::Group *parent);
+
+        statistics::Scalar numReads;
+        statistics::Scalar numWrites;
+        statistics::Scalar totalLatency;
+        statistics::Formula avgLatency;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif // __CPU_TESTERS_TRACE_REPLAYER_TRACE_REPLAYER_HH__
@@ -50,17 +50,29 @@ namespace gem5
 {
 
 TraceGen::InputStream::InputStream(const std::string& filename)
-    : trace(filename)
 {
+    if (PacketTraceFormat::isPacketTrace(filename))
+        blockTrace.reset(new PacketTraceReader(filename));
+    else
+        protoTrace.reset(new ProtoInputStream(filename));
+
     init();
 }
 
 void
 TraceGen::InputStream::init()
 {
+    if (blockTrace) {
+        if (blockTrace->header().tickFreq != sim_clock::Frequency) {
+            panic("Trace was recorded with a different tick frequency %d\n",
+                  blockTrace->header().tickFreq);
+        }
+        return;
+    }
+
     // Create a protobuf message for the header and read it from the stream
     ProtoMessage::PacketHeader header_msg;
-    if (!trace.read(header_msg)) {
+    if (!protoTrace->read(header_msg)) {
         panic("Failed to read packet header from trace\n");
     } else if (header_msg.tick_freq() != sim_clock::Frequency) {
         panic("Trace was recorded with a different tick frequency %d\n",
@@ -71,15 +83,33 @@ TraceGen::InputStream::init()
 void
 TraceGen::InputStream::reset()
 {
-    trace.reset();
+    if (blockTrace) {
+        blockTrace->reset();
+        return;
+    }
+
+    protoTrace->reset();
     init();
 }
 
 bool
 TraceGen::InputStream::read(TraceElement& element)
 {
+    if (blockTrace) {
+        PacketTraceRecord record;
+        if (!blockTrace->read(record))
+            return false;
+
+        element.cmd = record.cmd;
+        element.addr = record.addr;
+        element.blocksize = record.size;
+        element.tick = record.tick;
+        element.flags = record.flags;
+        return true;
+    }
+
     ProtoMessage::Packet pkt_msg;
-    if (trace.read(pkt_msg)) {
+    if (protoTrace->read(pkt_msg)) {
         element.cmd = pkt_msg.cmd();
         element.addr = pkt_msg.addr();
         element.blocksize = pkt_msg.size();
@@ -44,10 +44,13 @@
 #ifndef __CPU_TRAFFIC_GEN_TRACE_GEN_HH__
 #define __CPU_TRAFFIC_GEN_TRACE_GEN_HH__
 
+#include <memory>
+
 #include "base/bitfield.hh"
 #include "base/intmath.hh"
 #include "base_gen.hh"
 #include "mem/packet.hh"
+#include "mem/packet_trace.hh"
 #include "proto/protoio.hh"
 
 namespace gem5
@@ -111,13 +114,18 @@ class TraceGen : public BaseGen
 
       private:
 
-        /// Input file stream for the protobuf trace
-        ProtoInputStream trace;
+        /// Input file stream for a protobuf trace
+        std::unique_ptr<ProtoInputStream> protoTrace;
+
+        /// Reader for a block compressed packet trace
+        std::unique_ptr<PacketTraceReader> blockTrace;
 
       public:
 
         /**
-         * Create a trace input stream for a given file name.
+         * Create a trace input stream for a given file name. Both
+         * protobuf packet traces and block compressed packet traces
+         * are supported, and told apart by their magic number.
          *
          * @param filename Path to the file to read from
          */
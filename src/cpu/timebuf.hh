@@ -31,11 +31,23 @@
 
 #include <cassert>
 #include <cstring>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace gem5
 {
 
+/**
+ * A TimeBuffer holds the values of a structure over a window of cycles
+ * around the current one. When advancing, the slot that enters the window
+ * in the future is cleared. By default, this is done by destroying it,
+ * zeroing its storage and default-constructing it again. Structures that
+ * are large or own storage, e.g. PC states, can instead provide a reset()
+ * member which is then called on the slot. It must restore every field
+ * that consumers may read to its cleared value, but it can keep owned
+ * storage around to avoid allocating it again in the next cycles.
+ */
 template <class T>
 class TimeBuffer
 {
@@ -54,6 +66,13 @@ class TimeBuffer
         assert (idx >= -past && idx <= future);
     }
 
+    template <class U, class = void>
+    struct HasReset : std::false_type {};
+
+    template <class U>
+    struct HasReset<U, std::void_t<decltype(std::declval<U &>().reset())>>
+        : std::true_type {};
+
   public:
     friend class wire;
     class wire
@@ -184,9 +203,13 @@ class TimeBuffer
         int ptr = base + future;
         if (ptr >= (int)size)
             ptr -= size;
-        (reinterpret_cast<T *>(index[ptr]))->~T();
-        std::memset(index[ptr], 0, sizeof(T));
-        new (index[ptr]) T;
+        if constexpr (HasReset<T>::value) {
+            (reinterpret_cast<T *>(index[ptr]))->reset();
+        } else {
+            (reinterpret_cast<T *>(index[ptr]))->~T();
+            std::memset(index[ptr], 0, sizeof(T));
+            new (index[ptr]) T;
+        }
     }
 
   protected:
@@ -63,6 +63,14 @@ class TraceCPU(BaseCPU):
 
     instTraceFile = Param.String("", "Instruction trace file")
     dataTraceFile = Param.String("", "Data dependency trace file")
+    # Decode the data trace once and share it with all the Trace CPUs of the
+    # process replaying the same file, e.g. against different memory systems.
+    # The whole trace is then held in memory rather than read window by
+    # window. Pre-decoded trace images written by util/elastic_trace_image.py
+    # are always shared, and mapped rather than read.
+    sharedDataTrace = Param.Bool(
+        False, "Share a single decoded copy of the data trace"
+    )
     sizeStoreBuffer = Param.Unsigned(
         16, "Number of entries in the store buffer"
     )
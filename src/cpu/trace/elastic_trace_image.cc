@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/trace/elastic_trace_image.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+
+#include "base/logging.hh"
+#include "proto/inst_dep_record.pb.h"
+#include "proto/protoio.hh"
+#include "sim/byteswap.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+/** Images currently in use, indexed by file name */
+std::map<std::string, std::weak_ptr<const ElasticTraceImage>> images;
+std::mutex imagesMutex;
+
+} // anonymous namespace
+
+std::shared_ptr<const ElasticTraceImage>
+ElasticTraceImage::get(const std::string &filename)
+{
+    std::lock_guard<std::mutex> lock(imagesMutex);
+
+    // Forget about the images nobody uses anymore
+    for (auto it = images.begin(); it != images.end(); ) {
+        if (it->second.expired())
+            it = images.erase(it);
+        else
+            ++it;
+    }
+
+    auto &image = images[filename];
+    std::shared_ptr<const ElasticTraceImage> shared = image.lock();
+    if (!shared) {
+        shared.reset(new ElasticTraceImage(filename));
+        image = shared;
+    }
+    return shared;
+}
+
+bool
+ElasticTraceImage::isImage(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    uint64_t magic = 0;
+    if (!file.read(reinterpret_cast<char *>(&magic), sizeof(magic)))
+        return false;
+
+    fatal_if(magic == swap_byte(Magic),
+             "Elastic trace image %s has a different byte order than the "
+             "host\n", filename);
+
+    return magic == Magic;
+}
+
+ElasticTraceImage::ElasticTraceImage(const std::string &filename)
+    : records(nullptr), deps(nullptr), mapped(nullptr), mappedSize(0)
+{
+    if (isImage(filename))
+        map(filename);
+    else
+        decode(filename);
+}
+
+ElasticTraceImage::~ElasticTraceImage()
+{
+    if (mapped)
+        munmap(mapped, mappedSize);
+}
+
+void
+ElasticTraceImage::map(const std::string &filename)
+{
+    int fd = open(filename.c_str(), O_RDONLY);
+    fatal_if(fd < 0, "Failed to open elastic trace image %s\n", filename);
+
+    struct stat info;
+    panic_if(fstat(fd, &info) < 0, "Failed to stat %s\n", filename);
+    mappedSize = info.st_size;
+
+    fatal_if(mappedSize < sizeof(Header),
+             "Elastic trace image %s is truncated\n", filename);
+
+    mapped = mmap(nullptr, mappedSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    panic_if(mapped == MAP_FAILED, "Failed to mmap %s\n", filename);
+
+    std::memcpy(&header, mapped, sizeof(Header));
+    fatal_if(header.magic != Magic,
+             "%s is not an elastic trace image\n", filename);
+    fatal_if(header.version != Version,
+             "Elastic trace image %s has version %d, expected %d\n",
+             filename, header.version, Version);
+
+    // Check the counts one at a time so that corrupt ones cannot overflow
+    // the expected size
+    const size_t body_size = mappedSize - sizeof(Header);
+    fatal_if(header.numRecords > body_size / sizeof(Record) ||
+             header.numDeps > body_size / sizeof(uint64_t) ||
+             body_size != header.numRecords * sizeof(Record) +
+             header.numDeps * sizeof(uint64_t),
+             "Elastic trace image %s is truncated\n", filename);
+
+    const uint8_t *data = static_cast<const uint8_t *>(mapped);
+    records = reinterpret_cast<const Record *>(data + sizeof(Header));
+    deps = reinterpret_cast<const uint64_t *>(
+        data + sizeof(Header) + header.numRecords * sizeof(Record));
+
+    // The records are trusted from here on, so make sure none of them
+    // points outside the dependency array
+    for (uint64_t i = 0; i < header.numRecords; i++) {
+        const Record &rec = records[i];
+        fatal_if(rec.depIdx > header.numDeps ||
+                 header.numDeps - rec.depIdx <
+                 uint64_t(rec.numRobDeps) + rec.numRegDeps,
+                 "Record %d of elastic trace image %s has dependencies "
+                 "outside of the image\n", rec.seqNum, filename);
+    }
+}
+
+void
+ElasticTraceImage::decode(const std::string &filename)
+{
+    ProtoInputStream trace(filename);
+
+    ProtoMessage::InstDepRecordHeader header_msg;
+    panic_if(!trace.read(header_msg),
+             "Failed to read packet header from %s\n", filename);
+
+    header.magic = Magic;
+    header.version = Version;
+    header.windowSize = header_msg.window_size();
+    header.tickFreq = header_msg.tick_freq();
+
+    ProtoMessage::InstDepRecord pkt_msg;
+    while (trace.read(pkt_msg)) {
+        Record rec = {};
+        rec.seqNum = pkt_msg.seq_num();
+        rec.physAddr = pkt_msg.has_p_addr() ? pkt_msg.p_addr() : 0;
+        rec.virtAddr = pkt_msg.has_v_addr() ? pkt_msg.v_addr() : 0;
+        rec.pc = pkt_msg.has_pc() ? pkt_msg.pc() : 0;
+        rec.compDelay = pkt_msg.comp_delay();
+        rec.flags = pkt_msg.has_flags() ? pkt_msg.flags() : 0;
+        rec.depIdx = ownedDeps.size();
+        rec.size = pkt_msg.has_size() ? pkt_msg.size() : 0;
+        rec.weight = pkt_msg.has_weight() ? pkt_msg.weight() : 0;
+        rec.type = pkt_msg.type();
+
+        fatal_if(pkt_msg.rob_dep_size() > MaxDeps ||
+                 pkt_msg.reg_dep_size() > MaxDeps,
+                 "Record %d of %s has more than %d dependencies\n",
+                 pkt_msg.seq_num(), filename, MaxDeps);
+
+        for (int i = 0; i < pkt_msg.rob_dep_size(); i++)
+            ownedDeps.push_back(pkt_msg.rob_dep(i));
+        rec.numRobDeps = pkt_msg.rob_dep_size();
+
+        for (int i = 0; i < pkt_msg.reg_dep_size(); i++) {
+            // Register dependencies on an instruction that also is an
+            // order dependency are omitted
+            const uint64_t reg_dep = pkt_msg.reg_dep(i);
+            bool duplicate = false;
+            for (int j = 0; j < pkt_msg.rob_dep_size(); j++)
+                duplicate |= (reg_dep == pkt_msg.rob_dep(j));
+            if (!duplicate) {
+                ownedDeps.push_back(reg_dep);
+                ++rec.numRegDeps;
+            }
+        }
+
+        ownedRecords.push_back(rec);
+    }
+
+    header.numRecords = ownedRecords.size();
+    header.numDeps = ownedDeps.size();
+    records = ownedRecords.data();
+    deps = ownedDeps.data();
+}
+
+} // namespace gem5
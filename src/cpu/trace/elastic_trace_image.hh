@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_TRACE_ELASTIC_TRACE_IMAGE_HH__
+#define __CPU_TRACE_ELASTIC_TRACE_IMAGE_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace gem5
+{
+
+/**
+ * An ElasticTraceImage holds a fully decoded elastic data dependency trace
+ * as flat arrays of fixed-size records, so that the protobuf decoding is
+ * done once and the result shared by all the Trace CPUs of a process that
+ * replay the same trace, e.g. against different memory systems.
+ *
+ * An image is obtained either by decoding a protobuf trace in memory or by
+ * mapping a file written by util/elastic_trace_image.py. A mapped image is
+ * read-only and backed by the page cache, so it is also shared by all the
+ * processes of a design-space sweep and costs nothing to load.
+ *
+ * The file starts with a Header, followed by the records, followed by the
+ * dependency array. All fields are little endian. The order dependencies
+ * of a record are followed by its register dependencies in the dependency
+ * array, and register dependencies that also are order dependencies are
+ * left out.
+ */
+class ElasticTraceImage
+{
+  public:
+    /** "gem5etri" in little endian */
+    static constexpr uint64_t Magic = 0x69727465356d6567ULL;
+    static constexpr uint32_t Version = 1;
+    /** Maximum number of dependencies of each kind of a record */
+    static constexpr int MaxDeps = UINT16_MAX;
+
+    struct Header
+    {
+        uint64_t magic;
+        uint32_t version;
+        /** Window size the trace was generated with */
+        uint32_t windowSize;
+        uint64_t tickFreq;
+        uint64_t numRecords;
+        uint64_t numDeps;
+    };
+
+    struct Record
+    {
+        uint64_t seqNum;
+        uint64_t physAddr;
+        uint64_t virtAddr;
+        uint64_t pc;
+        uint64_t compDelay;
+        uint64_t flags;
+        /** Index of the first dependency in the dependency array */
+        uint64_t depIdx;
+        uint32_t size;
+        /** Number of filtered ops preceding this one */
+        uint32_t weight;
+        uint16_t numRobDeps;
+        uint16_t numRegDeps;
+        /** ProtoMessage::InstDepRecord::RecordType */
+        uint8_t type;
+        uint8_t pad[3];
+    };
+
+    static_assert(sizeof(Header) == 40, "Unexpected image header layout");
+    static_assert(sizeof(Record) == 72, "Unexpected image record layout");
+
+    ~ElasticTraceImage();
+
+    ElasticTraceImage(const ElasticTraceImage &) = delete;
+    ElasticTraceImage &operator=(const ElasticTraceImage &) = delete;
+
+    /**
+     * Get the image of a trace, creating it if no other user currently
+     * holds it.
+     *
+     * @param filename Image file, or protobuf trace to decode
+     * @return The shared image
+     */
+    static std::shared_ptr<const ElasticTraceImage>
+    get(const std::string &filename);
+
+    /** Check if a file is an image rather than a protobuf trace. */
+    static bool isImage(const std::string &filename);
+
+    uint32_t windowSize() const { return header.windowSize; }
+    uint64_t tickFreq() const { return header.tickFreq; }
+    size_t numRecords() const { return header.numRecords; }
+
+    const Record &record(size_t idx) const { return records[idx]; }
+
+    const uint64_t *
+    robDeps(const Record &rec) const
+    {
+        return deps + rec.depIdx;
+    }
+
+    const uint64_t *
+    regDeps(const Record &rec) const
+    {
+        return deps + rec.depIdx + rec.numRobDeps;
+    }
+
+  private:
+    explicit ElasticTraceImage(const std::string &filename);
+
+    /** Map an image file. */
+    void map(const std::string &filename);
+
+    /** Decode a protobuf trace into the owned arrays. */
+    void decode(const std::string &filename);
+
+    Header header;
+
+    const Record *records;
+    const uint64_t *deps;
+
+    /** Mapping of an image file, if any */
+    void *mapped;
+    size_t mappedSize;
+
+    /** Storage of a decoded protobuf trace */
+    std::vector<Record> ownedRecords;
+    std::vector<uint64_t> ownedDeps;
+};
+
+} // namespace gem5
+
+#endif // __CPU_TRACE_ELASTIC_TRACE_IMAGE_HH__
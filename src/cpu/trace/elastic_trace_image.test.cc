@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "base/gtest/logging.hh"
+#include "cpu/trace/elastic_trace_image.hh"
+#include "proto/inst_dep_record.pb.h"
+#include "proto/protoio.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+std::string
+tempName(const std::string &suffix)
+{
+    return testing::TempDir() + "elastic_trace_image.test." +
+        testing::UnitTest::GetInstance()->current_test_info()->name() +
+        suffix;
+}
+
+/** Write a protobuf trace of records that depend on the previous ones */
+void
+writeTrace(const std::string &filename, uint64_t num_records,
+           uint64_t first_seq_num=1)
+{
+    ProtoOutputStream trace(filename);
+
+    ProtoMessage::InstDepRecordHeader header;
+    header.set_obj_id("test");
+    header.set_tick_freq(1000000000000ULL);
+    header.set_window_size(64);
+    trace.write(header);
+
+    for (uint64_t i = 0; i < num_records; i++) {
+        ProtoMessage::InstDepRecord rec;
+        const uint64_t seq_num = first_seq_num + i;
+        rec.set_seq_num(seq_num);
+        rec.set_type(i % 2 ? ProtoMessage::InstDepRecord::LOAD :
+                     ProtoMessage::InstDepRecord::COMP);
+        rec.set_comp_delay(i * 10);
+        if (i % 2) {
+            rec.set_p_addr(0x1000 + i * 64);
+            rec.set_size(8);
+        }
+        rec.set_pc(0x400000 + i * 4);
+        // Depend on the two previous records, both through the ROB and
+        // through registers, so that half the register dependencies are
+        // duplicates
+        if (i > 0) {
+            rec.add_rob_dep(seq_num - 1);
+            rec.add_reg_dep(seq_num - 1);
+        }
+        if (i > 1)
+            rec.add_reg_dep(seq_num - 2);
+        trace.write(rec);
+    }
+}
+
+/**
+ * Write a decoded trace out as an image file, as done by
+ * util/elastic_trace_image.py. The header and records can be corrupted
+ * before they are written.
+ */
+void
+writeImage(const std::string &trace, const std::string &image_file,
+           const std::function<void(ElasticTraceImage::Header &,
+               std::vector<ElasticTraceImage::Record> &)> &corrupt={})
+{
+    auto decoded = ElasticTraceImage::get(trace);
+    std::vector<uint64_t> deps;
+    std::vector<ElasticTraceImage::Record> records;
+    for (size_t i = 0; i < decoded->numRecords(); i++) {
+        ElasticTraceImage::Record rec = decoded->record(i);
+        const uint64_t *rob = decoded->robDeps(rec);
+        deps.insert(deps.end(), rob, rob + rec.numRobDeps + rec.numRegDeps);
+        records.push_back(rec);
+    }
+
+    ElasticTraceImage::Header header = {};
+    header.magic = ElasticTraceImage::Magic;
+    header.version = ElasticTraceImage::Version;
+    header.windowSize = decoded->windowSize();
+    header.tickFreq = decoded->tickFreq();
+    header.numRecords = records.size();
+    header.numDeps = deps.size();
+
+    if (corrupt)
+        corrupt(header, records);
+
+    std::ofstream out(image_file, std::ios::binary);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(records.data()),
+              records.size() * sizeof(records[0]));
+    out.write(reinterpret_cast<const char *>(deps.data()),
+              deps.size() * sizeof(deps[0]));
+}
+
+void
+checkImage(const ElasticTraceImage &image, uint64_t num_records)
+{
+    EXPECT_EQ(image.windowSize(), 64);
+    EXPECT_EQ(image.tickFreq(), 1000000000000ULL);
+    ASSERT_EQ(image.numRecords(), num_records);
+
+    for (uint64_t i = 0; i < num_records; i++) {
+        const ElasticTraceImage::Record &rec = image.record(i);
+        EXPECT_EQ(rec.seqNum, i + 1);
+        EXPECT_EQ(rec.compDelay, i * 10);
+        EXPECT_EQ(rec.pc, 0x400000 + i * 4);
+        EXPECT_EQ(rec.physAddr, i % 2 ? 0x1000 + i * 64 : 0);
+        EXPECT_EQ(rec.size, i % 2 ? 8 : 0);
+
+        ASSERT_EQ(rec.numRobDeps, i > 0 ? 1 : 0);
+        ASSERT_EQ(rec.numRegDeps, i > 1 ? 1 : 0);
+        if (i > 0) {
+            EXPECT_EQ(image.robDeps(rec)[0], i);
+        }
+        if (i > 1) {
+            EXPECT_EQ(image.regDeps(rec)[0], i - 1);
+        }
+    }
+}
+
+} // anonymous namespace
+
+TEST(ElasticTraceImageTest, Decode)
+{
+    const std::string trace = tempName(".pb");
+    writeTrace(trace, 100);
+
+    EXPECT_FALSE(ElasticTraceImage::isImage(trace));
+    checkImage(*ElasticTraceImage::get(trace), 100);
+
+    std::remove(trace.c_str());
+}
+
+TEST(ElasticTraceImageTest, Shared)
+{
+    const std::string trace = tempName(".pb");
+    writeTrace(trace, 10);
+
+    auto first = ElasticTraceImage::get(trace);
+    auto second = ElasticTraceImage::get(trace);
+    EXPECT_EQ(first.get(), second.get());
+    first.reset();
+    second.reset();
+
+    // Once released, the trace is decoded again
+    writeTrace(trace, 10, 100);
+    EXPECT_EQ(ElasticTraceImage::get(trace)->record(0).seqNum, 100);
+
+    std::remove(trace.c_str());
+}
+
+TEST(ElasticTraceImageTest, Map)
+{
+    const std::string trace = tempName(".pb");
+    const std::string image_file = tempName(".img");
+    writeTrace(trace, 100);
+
+    writeImage(trace, image_file);
+
+    EXPECT_TRUE(ElasticTraceImage::isImage(image_file));
+    checkImage(*ElasticTraceImage::get(image_file), 100);
+
+    std::remove(trace.c_str());
+    std::remove(image_file.c_str());
+}
+
+TEST(ElasticTraceImageTest, TooManyDeps)
+{
+    const std::string trace = tempName(".pb");
+    {
+        ProtoOutputStream out(trace);
+        ProtoMessage::InstDepRecordHeader header;
+        header.set_obj_id("test");
+        header.set_tick_freq(1000000000000ULL);
+        header.set_window_size(64);
+        out.write(header);
+
+        ProtoMessage::InstDepRecord rec;
+        rec.set_seq_num(1);
+        rec.set_type(ProtoMessage::InstDepRecord::COMP);
+        rec.set_comp_delay(0);
+        for (int i = 0; i <= ElasticTraceImage::MaxDeps; i++)
+            rec.add_rob_dep(i);
+        out.write(rec);
+    }
+
+    // The counts must not silently wrap around
+    gtestLogOutput.str("");
+    EXPECT_ANY_THROW(ElasticTraceImage::get(trace));
+    EXPECT_NE(gtestLogOutput.str().find("more than 65535 dependencies"),
+              std::string::npos);
+
+    std::remove(trace.c_str());
+}
+
+TEST(ElasticTraceImageTest, MapDepsOutOfRange)
+{
+    const std::string trace = tempName(".pb");
+    const std::string image_file = tempName(".img");
+    writeTrace(trace, 10);
+    writeImage(trace, image_file,
+        [](ElasticTraceImage::Header &header,
+           std::vector<ElasticTraceImage::Record> &records) {
+            records[5].depIdx = header.numDeps;
+        });
+
+    gtestLogOutput.str("");
+    EXPECT_ANY_THROW(ElasticTraceImage::get(image_file));
+    EXPECT_NE(gtestLogOutput.str().find(
+                  "Record 6 of elastic trace image " + image_file +
+                  " has dependencies outside of the image"),
+              std::string::npos);
+
+    std::remove(trace.c_str());
+    std::remove(image_file.c_str());
+}
+
+TEST(ElasticTraceImageTest, MapCorruptCounts)
+{
+    const std::string trace = tempName(".pb");
+    const std::string image_file = tempName(".img");
+    writeTrace(trace, 10);
+
+    // A record count that would wrap the expected file size around
+    writeImage(trace, image_file,
+        [](ElasticTraceImage::Header &header,
+           std::vector<ElasticTraceImage::Record> &records) {
+            header.numRecords += 1ULL << 61;
+        });
+
+    gtestLogOutput.str("");
+    EXPECT_ANY_THROW(ElasticTraceImage::get(image_file));
+    EXPECT_NE(gtestLogOutput.str().find("is truncated"), std::string::npos);
+
+    std::remove(trace.c_str());
+    std::remove(image_file.c_str());
+}
@@ -44,7 +44,7 @@ namespace gem5
 {
 
 // Declare and initialize the static counter for number of trace CPUs.
-int TraceCPU::numTraceCPUs = 0;
+std::atomic<int> TraceCPU::numTraceCPUs(0);
 
 TraceCPU::TraceCPU(const TraceCPUParams &params)
     :   BaseCPU(params),
@@ -61,7 +61,8 @@ TraceCPU::TraceCPU(const TraceCPUParams &params)
         dcacheNextEvent([this]{ schedDcacheNext(); }, name()),
         oneTraceComplete(false),
         traceOffset(0),
-        execCompleteEvent(nullptr),
+        execCompleteEvent([this]{ execComplete(); }, name(), false,
+                          Event::Sim_Exit_Pri),
         enableEarlyExit(params.enableEarlyExit),
         progressMsgInterval(params.progressMsgInterval),
         progressMsgThreshold(params.progressMsgInterval), traceStats(this)
@@ -131,17 +132,13 @@ TraceCPU::init()
     // send its first request at the first event and schedule subsequent
     // events using a relative tick delta
     dcacheGen.adjustInitTraceOffset(traceOffset);
+}
 
-    // If the Trace CPU simulation is configured to exit on any one trace
-    // completion then we don't need a counted event to count down all Trace
-    // CPUs in the system. If not then instantiate a counted event.
-    if (!enableEarlyExit) {
-        // The static counter for number of Trace CPUs is correctly set at
-        // this point so create an event and pass it.
-        execCompleteEvent = new CountedExitEvent("end of all traces reached.",
-                                                 numTraceCPUs);
-    }
-
+void
+TraceCPU::execComplete()
+{
+    if (--numTraceCPUs == 0)
+        exitSimLoop("end of all traces reached.");
 }
 
 void
@@ -200,7 +197,7 @@ TraceCPU::checkAndSchedExitEvent()
         if (enableEarlyExit) {
             exitSimLoop("End of trace reached");
         } else {
-            schedule(*execCompleteEvent, curTick());
+            schedule(execCompleteEvent, curTick());
         }
     }
 }
@@ -1195,14 +1192,27 @@ TraceCPU::DcachePort::recvReqRetry()
 }
 
 TraceCPU::ElasticDataGen::InputStream::InputStream(
-        const std::string& filename, const double time_multiplier) :
-    trace(filename),
+        const std::string& filename, const double time_multiplier,
+        bool shared) :
+    nextRecord(0),
     timeMultiplier(time_multiplier),
     microOpCount(0)
 {
+    // Pre-decoded images are always shared
+    if (shared || ElasticTraceImage::isImage(filename)) {
+        image = ElasticTraceImage::get(filename);
+        panic_if(image->tickFreq() != sim_clock::Frequency,
+                 "Trace %s was recorded with a different tick frequency %d\n",
+                 filename, image->tickFreq());
+        windowSize = image->windowSize();
+        return;
+    }
+
+    trace = std::make_unique<ProtoInputStream>(filename);
+
     // Create a protobuf message for the header and read it from the stream
     ProtoMessage::InstDepRecordHeader header_msg;
-    if (!trace.read(header_msg)) {
+    if (!trace->read(header_msg)) {
         panic("Failed to read packet header from %s\n", filename);
 
         if (header_msg.tick_freq() != sim_clock::Frequency) {
@@ -1219,14 +1229,45 @@ TraceCPU::ElasticDataGen::InputStream::InputStream(
 void
 TraceCPU::ElasticDataGen::InputStream::reset()
 {
-    trace.reset();
+    if (image)
+        nextRecord = 0;
+    else
+        trace->reset();
 }
 
 bool
 TraceCPU::ElasticDataGen::InputStream::read(GraphNode* element)
 {
+    if (image) {
+        if (nextRecord == image->numRecords())
+            return false;
+
+        const auto &rec = image->record(nextRecord++);
+        element->seqNum = rec.seqNum;
+        element->type = static_cast<RecordType>(rec.type);
+        // Scale the compute delay to effectively scale the Trace CPU frequency
+        element->compDelay = rec.compDelay * timeMultiplier;
+
+        // Duplicated register dependencies are already left out of the image
+        const uint64_t *rob_deps = image->robDeps(rec);
+        element->robDep.assign(rob_deps, rob_deps + rec.numRobDeps);
+        const uint64_t *reg_deps = image->regDeps(rec);
+        element->regDep.assign(reg_deps, reg_deps + rec.numRegDeps);
+
+        element->physAddr = rec.physAddr;
+        element->virtAddr = rec.virtAddr;
+        element->size = rec.size;
+        element->flags = rec.flags;
+        element->pc = rec.pc;
+
+        // ROB occupancy number
+        microOpCount += 1 + rec.weight;
+        element->robNum = microOpCount;
+        return true;
+    }
+
     ProtoMessage::InstDepRecord pkt_msg;
-    if (trace.read(pkt_msg)) {
+    if (trace->read(pkt_msg)) {
         // Required fields
         element->seqNum = pkt_msg.seq_num();
         element->type = pkt_msg.type();
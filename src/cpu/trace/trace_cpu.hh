@@ -38,21 +38,23 @@
 #ifndef __CPU_TRACE_TRACE_CPU_HH__
 #define __CPU_TRACE_TRACE_CPU_HH__
 
+#include <atomic>
 #include <cstdint>
 #include <list>
+#include <memory>
 #include <queue>
 #include <set>
 #include <unordered_map>
 
 #include "base/statistics.hh"
 #include "cpu/base.hh"
+#include "cpu/trace/elastic_trace_image.hh"
 #include "debug/TraceCPUData.hh"
 #include "debug/TraceCPUInst.hh"
 #include "params/TraceCPU.hh"
 #include "proto/inst_dep_record.pb.h"
 #include "proto/packet.pb.h"
 #include "proto/protoio.hh"
-#include "sim/sim_events.hh"
 
 namespace gem5
 {
@@ -134,9 +136,11 @@ namespace gem5
  * Strictly-ordered requests are skipped and the dependencies on such requests
  * are handled by simply marking them complete immediately.
  *
- * A CountedExitEvent that contains a static int belonging to the Trace CPU
- * class as a down counter is used to implement multi Trace CPU simulation
- * exit.
+ * A static atomic counter belonging to the Trace CPU class is counted
+ * down by each Trace CPU that completes to implement multi Trace CPU
+ * simulation exit. Trace CPUs replaying the same elastic trace against
+ * different memory systems, possibly on different event queues, can share
+ * a single decoded copy of it (see ElasticTraceImage).
  */
 
 class TraceCPU : public BaseCPU
@@ -761,8 +765,17 @@ class TraceCPU : public BaseCPU
         class InputStream
         {
           private:
-            /** Input file stream for the protobuf trace */
-            ProtoInputStream trace;
+            /**
+             * Input file stream for the protobuf trace, unused when the
+             * trace is read from a shared image
+             */
+            std::unique_ptr<ProtoInputStream> trace;
+
+            /** Shared decoded trace, if any */
+            std::shared_ptr<const ElasticTraceImage> image;
+
+            /** Index of the next record to read from the image */
+            size_t nextRecord;
 
             /**
              * A multiplier for the compute delays in the trace to modulate
@@ -787,9 +800,10 @@ class TraceCPU : public BaseCPU
              *
              * @param filename Path to the file to read from
              * @param time_multiplier used to scale the compute delays
+             * @param shared decode the trace once for all its readers
              */
             InputStream(const std::string& filename,
-                        const double time_multiplier);
+                        const double time_multiplier, bool shared);
 
             /**
              * Reset the stream such that it can be played once
@@ -824,7 +838,8 @@ class TraceCPU : public BaseCPU
             owner(_owner),
             port(_port),
             requestorId(requestor_id),
-            trace(trace_file, 1.0 / params.freqMultiplier),
+            trace(trace_file, 1.0 / params.freqMultiplier,
+                  params.sharedDataTrace),
             genName(owner.name() + ".elastic." + _name),
             retryPkt(nullptr),
             traceComplete(false),
@@ -1072,19 +1087,23 @@ class TraceCPU : public BaseCPU
     Tick traceOffset;
 
     /**
-     * Number of Trace CPUs in the system used as a shared variable and passed
-     * to the CountedExitEvent event used for counting down exit events.  It is
+     * Number of Trace CPUs in the system used as a shared variable and
+     * counted down by the execCompleteEvent of each of them. It is
      * incremented in the constructor call so that the total is arrived at
-     * automatically.
+     * automatically. It is atomic as Trace CPUs may run on different event
+     * queues.
      */
-    static int numTraceCPUs;
+    static std::atomic<int> numTraceCPUs;
 
    /**
-    * A CountedExitEvent which when serviced decrements the counter. A sim
-    * exit event is scheduled when the counter equals zero, that is all
-    * instances of Trace CPU have had their execCompleteEvent serviced.
+    * Event which when serviced decrements the counter. The simulation
+    * exits when the counter equals zero, that is all instances of Trace CPU
+    * have had their execCompleteEvent serviced.
     */
-    CountedExitEvent *execCompleteEvent;
+    EventFunctionWrapper execCompleteEvent;
+
+    /** Count down the Trace CPUs and exit once all are complete. */
+    void execComplete();
 
     /**
      * Exit when any one Trace CPU completes its execution. If this is
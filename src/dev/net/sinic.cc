@@ -116,9 +116,9 @@ Device::DeviceStats::DeviceStats(statistics::Group *parent)
 }
 
 void
-Device::resetStats()
+Device::postResetStats()
 {
-    Base::resetStats();
+    Base::postResetStats();
 
     sinicDeviceStats._maxVnicDistance = 0;
 }
@@ -293,7 +293,7 @@ class Device : public Base
 
 
   public:
-    void resetStats() override;
+    void postResetStats() override;
 
 /**
  * Serialization stuff
@@ -70,6 +70,14 @@ class DRAMInterface(MemInterface):
     # performance being lower when enabled
     enable_dram_powerdown = Param.Bool(False, "Enable powerdown states")
 
+    # When powerdown is disabled, idle ranks still refresh every tREFI,
+    # which costs a handful of events per rank and refresh. If True, the
+    # refreshes of an idle rank are instead accounted for analytically when
+    # the rank is next accessed, or when the stats are dumped or reset
+    lazy_refresh = Param.Bool(
+        False, "Account for refreshes of idle ranks without events"
+    )
+
     # For power modelling we need to know if the DRAM has a DLL or not
     dll = Param.Bool(True, "DRAM has DLL or not")
 
@@ -0,0 +1,117 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.objects.AbstractMemory import *
+from m5.proxy import *
+from m5.SimObject import SimObject
+
+
+class ShmBridgeClient(AbstractMemory):
+    """The CPU side of a shared memory bridge, used to split a simulation
+    across gem5 processes on the same host. It is the memory of the
+    process it is in, and forwards timing requests to the ShmBridgeServer
+    with the same channel in the memory process. The two processes are
+    kept in lockstep quanta.
+
+    Functional and atomic accesses are performed directly on the memory of
+    the memory process, which must use a shared backing store and export
+    it with a SharedMemoryServer.
+
+    Limitations:
+
+    * Functional and atomic accesses bypass any caches in the memory
+      process, so they only see the data of the memory itself. Caches in
+      the memory process must therefore not hold dirty data that a CPU
+      process reads functionally, e.g. through system calls, and the
+      memory process should not be simulated in atomic mode. Keep the
+      caches in the CPU processes.
+    * Snoops do not cross the bridge. The caches of different CPU
+      processes are not kept coherent with each other or with caches in
+      the memory process, so CPU processes must not share data through
+      the memory.
+
+    Example, in the memory process:
+
+    system.shared_backstore = "gem5_mem"
+    system.shm_server = SharedMemoryServer(server_path="/tmp/gem5_mem.sock")
+    system.bridge = ShmBridgeServer(channel="gem5_cluster0")
+    system.bridge.mem_side = system.membus.cpu_side_ports
+
+    and in each CPU process:
+
+    system.bridge = ShmBridgeClient(
+        channel="gem5_cluster0",
+        range=system.mem_ranges[0],
+        shm_server_path="/tmp/gem5_mem.sock",
+    )
+    system.membus.mem_side_ports = system.bridge.port
+    """
+
+    type = "ShmBridgeClient"
+    cxx_header = "mem/shm_bridge.hh"
+    cxx_class = "gem5::memory::ShmBridgeClient"
+
+    port = ResponsePort("This port sends responses and receives requests")
+
+    channel = Param.String(
+        "Name of the POSIX shared memory object shared with the server"
+    )
+    quantum = Param.Latency("1us", "Synchronisation quantum")
+    latency = Param.Latency(
+        "1us", "Latency of the link, must be at least one quantum"
+    )
+    ring_entries = Param.Unsigned(
+        1024, "Number of packets in flight in each direction"
+    )
+    shm_server_path = Param.String(
+        "Socket of the SharedMemoryServer of the memory process"
+    )
+
+
+class ShmBridgeServer(SimObject):
+    """The memory side of a shared memory bridge. It issues the timing
+    requests of one CPU process to the memory system of the process it is
+    in. See ShmBridgeClient."""
+
+    type = "ShmBridgeServer"
+    cxx_header = "mem/shm_bridge.hh"
+    cxx_class = "gem5::memory::ShmBridgeServer"
+
+    mem_side = RequestPort("This port sends requests and receives responses")
+
+    channel = Param.String(
+        "Name of the POSIX shared memory object shared with the client"
+    )
+    quantum = Param.Latency("1us", "Synchronisation quantum")
+    latency = Param.Latency(
+        "1us", "Latency of the link, must be at least one quantum"
+    )
+    ring_entries = Param.Unsigned(
+        1024, "Number of packets in flight in each direction"
+    )
+
+    system = Param.System(Parent.any, "System the requests belong to")
@@ -39,14 +39,18 @@ class ThreadBridge(SimObject):
     the issue. The receiver side is expected to use the same EventQueue that
     the ThreadBridge is using.
 
-    Given that this is only used for simulation speed accelerating, only the
-    atomic and functional access are supported.
+    Atomic and functional accesses are forwarded right away, by taking over
+    the event queue of the receiver. Timing packets are passed through a
+    lock-free channel in each direction, and are picked up by the other
+    side in batches at the next quantum boundary. The delay of timing
+    packets must thus be at least the simulation quantum in parallel mode,
+    and the initiator side must use the EventQueue given by in_eventq_index.
 
-    Example:
+    Example, with root.sim_quantum = "1us":
 
     sys.initator = Initiator(eventq_index=0)
     sys.target = Target(eventq_index=1)
-    sys.bridge = ThreadBridge(eventq_index=1)
+    sys.bridge = ThreadBridge(eventq_index=1, in_eventq_index=0, delay="1us")
 
     sys.initator.out_port = sys.bridge.in_port
     sys.bridge.out_port = sys.target.in_port
@@ -58,3 +62,9 @@ class ThreadBridge(SimObject):
 
     in_port = ResponsePort("Incoming port")
     out_port = RequestPort("Outgoing port")
+
+    in_eventq_index = Param.UInt32(0, "Event queue of the initiator side")
+    delay = Param.Latency("0ns", "Delay of timing packets")
+    channel_entries = Param.Unsigned(
+        256, "Number of timing packets in flight in each direction"
+    )
@@ -166,12 +166,54 @@ Base::compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat)
              "Decompressed line does not match original line.");
     #endif
 
-    // Get compression size. If compressed size is greater than the size
-    // threshold, the compression is seen as unsuccessful
-    std::size_t comp_size_bits = comp_data->getSizeBits();
+    // Get compression size, which is reverted to the uncompressed size if
+    // the compression was unsuccessful
+    const std::size_t comp_size_bits =
+        updateCompressionStats(comp_data->getSizeBits());
+    comp_data->setSizeBits(comp_size_bits);
+
+    // Print debug information
+    DPRINTF(CacheComp, "Compressed cache line from %d to %d bits. " \
+            "Compression latency: %llu, decompression latency: %llu\n",
+            blkSize*8, comp_size_bits, comp_lat, decomp_lat);
+
+    return comp_data;
+}
+
+std::size_t
+Base::compressSize(const std::vector<Chunk>& chunks, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    return compress(chunks, comp_lat, decomp_lat)->getSizeBits();
+}
+
+std::size_t
+Base::compressSize(const uint64_t* data, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    // In debug mode the compressed data is needed to check the
+    // decompression, so go through the full compression process
+    #ifdef DEBUG_COMPRESSION
+    return compress(data, comp_lat, decomp_lat)->getSizeBits();
+    #else
+    const std::size_t comp_size_bits = updateCompressionStats(
+        compressSize(toChunks(data), comp_lat, decomp_lat));
+
+    DPRINTF(CacheComp, "Compressed cache line from %d to %d bits. " \
+            "Compression latency: %llu, decompression latency: %llu\n",
+            blkSize*8, comp_size_bits, comp_lat, decomp_lat);
+
+    return comp_size_bits;
+    #endif
+}
+
+std::size_t
+Base::updateCompressionStats(std::size_t comp_size_bits)
+{
+    // If compressed size is greater than the size threshold, the
+    // compression is seen as unsuccessful
     if (comp_size_bits > sizeThreshold * CHAR_BIT) {
         comp_size_bits = blkSize * CHAR_BIT;
-        comp_data->setSizeBits(comp_size_bits);
         stats.failedCompressions++;
     }
 
@@ -184,12 +226,7 @@ Base::compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat)
         stats.compressionSize[0]++;
     }
 
-    // Print debug information
-    DPRINTF(CacheComp, "Compressed cache line from %d to %d bits. " \
-            "Compression latency: %llu, decompression latency: %llu\n",
-            blkSize*8, comp_size_bits, comp_lat, decomp_lat);
-
-    return comp_data;
+    return comp_size_bits;
 }
 
 Cycles
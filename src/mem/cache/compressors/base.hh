@@ -197,6 +197,31 @@ class Base : public SimObject
     virtual void decompress(const CompressionData* comp_data,
                               uint64_t* cache_line) = 0;
 
+    /**
+     * Apply the compression process to the cache line, but only calculate
+     * the size of the compressed line. This is what the cache needs in
+     * most cases, since it stores the data uncompressed, so compressors
+     * should override it with a version that does not build the
+     * compressed data. The stats must be updated as if compress() had
+     * been called.
+     *
+     * @param chunks The cache line to be compressed, divided into chunks.
+     * @param comp_lat Compression latency in number of cycles.
+     * @param decomp_lat Decompression latency in number of cycles.
+     * @return Size of the compressed cache line, in number of bits.
+     */
+    virtual std::size_t compressSize(const std::vector<Chunk>& chunks,
+        Cycles& comp_lat, Cycles& decomp_lat);
+
+    /**
+     * Update the compression stats given the compressed size of a line.
+     *
+     * @param comp_size_bits Size of the compressed line, in number of bits.
+     * @return The size of the line, which is the uncompressed size if the
+     *         compression was unsuccessful.
+     */
+    std::size_t updateCompressionStats(std::size_t comp_size_bits);
+
   public:
     typedef BaseCacheCompressorParams Params;
     Base(const Params &p);
@@ -217,6 +242,19 @@ class Base : public SimObject
     std::unique_ptr<CompressionData>
     compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat);
 
+    /**
+     * Apply the compression process to the cache line, without building
+     * the compressed data. The latencies are the same as the ones set by
+     * compress().
+     *
+     * @param data The cache line to be compressed.
+     * @param comp_lat Compression latency in number of cycles.
+     * @param decomp_lat Decompression latency in number of cycles.
+     * @return Size of the cache line after compression, in number of bits.
+     */
+    std::size_t
+    compressSize(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat);
+
     /**
      * Get the decompression latency if the block is compressed. Latency is 0
      * otherwise.
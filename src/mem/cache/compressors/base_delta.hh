@@ -106,6 +106,14 @@ class BaseDelta : public DictionaryCompressor<BaseType>
         return PatternFactory::getPattern(bytes, dict_bytes, match_location);
     }
 
+    std::size_t
+    getPatternSizeBits(const DictionaryEntry& bytes,
+        const DictionaryEntry& dict_bytes,
+        const int match_location) const override
+    {
+        return PatternFactory::getSizeBits(bytes, dict_bytes, match_location);
+    }
+
     std::string
     getName(int number) const override
     {
@@ -124,6 +132,17 @@ class BaseDelta : public DictionaryCompressor<BaseType>
         const std::vector<Base::Chunk>& chunks,
         Cycles& comp_lat, Cycles& decomp_lat) override;
 
+    std::size_t compressSize(const std::vector<Base::Chunk>& chunks,
+        Cycles& comp_lat, Cycles& decomp_lat) override;
+
+    /**
+     * Account for the bases in the size of the compressed line.
+     *
+     * @param size_bits Size of the compressed patterns, in bits.
+     * @return The size of the compressed line.
+     */
+    std::size_t addBasesSizeBits(std::size_t size_bits) const;
+
   public:
     typedef BaseDictionaryCompressorParams Params;
     BaseDelta(const Params &p);
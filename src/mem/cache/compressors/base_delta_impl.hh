@@ -77,7 +77,27 @@ BaseDelta<BaseType, DeltaSizeBits>::compress(
 {
     std::unique_ptr<Base::CompressionData> comp_data =
         DictionaryCompressor<BaseType>::compress(chunks, comp_lat, decomp_lat);
+    comp_data->setSizeBits(addBasesSizeBits(comp_data->getSizeBits()));
 
+    // Return compressed line
+    return comp_data;
+}
+
+template <class BaseType, std::size_t DeltaSizeBits>
+std::size_t
+BaseDelta<BaseType, DeltaSizeBits>::compressSize(
+    const std::vector<Base::Chunk>& chunks, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    return addBasesSizeBits(DictionaryCompressor<BaseType>::compressSize(
+        chunks, comp_lat, decomp_lat));
+}
+
+template <class BaseType, std::size_t DeltaSizeBits>
+std::size_t
+BaseDelta<BaseType, DeltaSizeBits>::addBasesSizeBits(
+    std::size_t size_bits) const
+{
     // If there are more bases than the maximum, the compressor failed.
     // Otherwise, we have to take into account all bases that have not
     // been used, considering that there is an implicit zero base that
@@ -85,16 +105,12 @@ BaseDelta<BaseType, DeltaSizeBits>::compress(
     const int diff = DEFAULT_MAX_NUM_BASES -
         DictionaryCompressor<BaseType>::numEntries;
     if (diff < 0) {
-        comp_data->setSizeBits(DictionaryCompressor<BaseType>::blkSize * 8);
         DPRINTF(CacheComp, "Base%dDelta%d compression failed\n",
             8 * sizeof(BaseType), DeltaSizeBits);
-    } else if (diff > 0) {
-        comp_data->setSizeBits(comp_data->getSizeBits() +
-            8 * sizeof(BaseType) * diff);
+        return DictionaryCompressor<BaseType>::blkSize * 8;
+    } else {
+        return size_bits + 8 * sizeof(BaseType) * diff;
     }
-
-    // Return compressed line
-    return comp_data;
 }
 
 } // namespace compression
@@ -167,6 +167,22 @@ class DictionaryCompressor : public BaseDictionaryCompressor
                                                     match_location);
             }
         }
+
+        /**
+         * Get the size of the pattern getPattern() would instantiate,
+         * without allocating it.
+         */
+        static std::size_t getSizeBits(
+            const DictionaryEntry& bytes, const DictionaryEntry& dict_bytes,
+            const int match_location)
+        {
+            if (Head::isPattern(bytes, dict_bytes, match_location)) {
+                return Head(bytes, match_location).getSizeBits();
+            } else {
+                return Factory<Tail...>::getSizeBits(bytes, dict_bytes,
+                                                     match_location);
+            }
+        }
     };
 
     /**
@@ -188,6 +204,13 @@ class DictionaryCompressor : public BaseDictionaryCompressor
         {
             return std::unique_ptr<Pattern>(new Head(bytes, match_location));
         }
+
+        static std::size_t
+        getSizeBits(const DictionaryEntry& bytes,
+            const DictionaryEntry& dict_bytes, const int match_location)
+        {
+            return Head(bytes, match_location).getSizeBits();
+        }
     };
 
     /** The dictionary. */
@@ -202,6 +225,15 @@ class DictionaryCompressor : public BaseDictionaryCompressor
     getPattern(const DictionaryEntry& bytes, const DictionaryEntry& dict_bytes,
         const int match_location) const = 0;
 
+    /**
+     * Get the size of the pattern that getPattern() would return. As with
+     * getPattern(), this must be implemented by calling the factory's
+     * getSizeBits.
+     */
+    virtual std::size_t
+    getPatternSizeBits(const DictionaryEntry& bytes,
+        const DictionaryEntry& dict_bytes, const int match_location) const = 0;
+
     /**
      * Compress data.
      *
@@ -251,6 +283,22 @@ class DictionaryCompressor : public BaseDictionaryCompressor
 
     using BaseDictionaryCompressor::compress;
 
+    /**
+     * Apply compression, but only keep track of the size of the patterns.
+     * Patterns whose size depends on their neighbours (e.g., FPC's zero
+     * runs) are handled by the compression data's addEntry, so the last
+     * pattern is kept around.
+     *
+     * @param chunks The cache line to be compressed.
+     * @return Size of the cache line after compression, in bits.
+     */
+    std::size_t compressSize(const std::vector<Chunk>& chunks);
+
+    std::size_t compressSize(const std::vector<Chunk>& chunks,
+        Cycles& comp_lat, Cycles& decomp_lat) override;
+
+    using BaseDictionaryCompressor::compressSize;
+
     void decompress(const CompressionData* comp_data, uint64_t* data) override;
 
     /**
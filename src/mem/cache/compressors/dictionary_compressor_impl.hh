@@ -99,21 +99,28 @@ DictionaryCompressor<T>::compressValue(const T data)
 
     // Start as a no-match pattern. A negative match location is used so that
     // patterns that depend on the dictionary entry don't match
-    std::unique_ptr<Pattern> pattern =
-        getPattern(bytes, toDictionaryEntry(0), -1);
+    const DictionaryEntry no_match = toDictionaryEntry(0);
+    int match_location = -1;
+    std::size_t size_bits = getPatternSizeBits(bytes, no_match, -1);
 
-    // Search for word on dictionary
+    // Search for word on dictionary. Only the sizes are needed to find the
+    // best match, so the pattern is instantiated once it has been found
     for (std::size_t i = 0; i < numEntries; i++) {
         // Try matching input with possible patterns
-        std::unique_ptr<Pattern> temp_pattern =
-            getPattern(bytes, dictionary[i], i);
+        const std::size_t temp_size_bits =
+            getPatternSizeBits(bytes, dictionary[i], i);
 
         // Check if found pattern is better than previous
-        if (temp_pattern->getSizeBits() < pattern->getSizeBits()) {
-            pattern = std::move(temp_pattern);
+        if (temp_size_bits < size_bits) {
+            size_bits = temp_size_bits;
+            match_location = i;
         }
     }
 
+    std::unique_ptr<Pattern> pattern = (match_location < 0) ?
+        getPattern(bytes, no_match, -1) :
+        getPattern(bytes, dictionary[match_location], match_location);
+
     // Update stats
     dictionaryStats.patterns[pattern->getPatternNumber()]++;
 
@@ -163,6 +170,45 @@ DictionaryCompressor<T>::compress(const std::vector<Chunk>& chunks,
     return compress(chunks);
 }
 
+template <class T>
+std::size_t
+DictionaryCompressor<T>::compressSize(const std::vector<Chunk>& chunks)
+{
+    std::unique_ptr<CompData> comp_data = instantiateDictionaryCompData();
+
+    // Reset dictionary
+    resetDictionary();
+
+    // Compress every value sequentially. The size of an entry can only
+    // depend on the previous one, so all the others are dropped
+    for (const auto& value : chunks) {
+        std::unique_ptr<Pattern> pattern = compressValue(value);
+        DPRINTF(CacheComp, "Compressed %016x to %s\n", value,
+            pattern->print());
+        comp_data->addEntry(std::move(pattern));
+        if (comp_data->entries.size() > 1) {
+            comp_data->entries.erase(comp_data->entries.begin());
+        }
+    }
+
+    return comp_data->getSizeBits();
+}
+
+template <class T>
+std::size_t
+DictionaryCompressor<T>::compressSize(const std::vector<Chunk>& chunks,
+    Cycles& comp_lat, Cycles& decomp_lat)
+{
+    // Set latencies based on the degree of parallelization, and any extra
+    // latencies due to shifting or packaging
+    comp_lat = Cycles(compExtraLatency +
+        (chunks.size() / compChunksPerCycle));
+    decomp_lat = Cycles(decompExtraLatency +
+        (chunks.size() / decompChunksPerCycle));
+
+    return compressSize(chunks);
+}
+
 template <class T>
 T
 DictionaryCompressor<T>::decompressValue(const Pattern* pattern)
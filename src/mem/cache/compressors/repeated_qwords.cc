@@ -81,5 +81,43 @@ RepeatedQwords::compress(const std::vector<Chunk>& chunks,
     return comp_data;
 }
 
+std::size_t
+RepeatedQwords::compressSize(const std::vector<Chunk>& chunks,
+    Cycles& comp_lat, Cycles& decomp_lat)
+{
+    // Every distinct qword is added to the dictionary the first time it
+    // is seen, and any later occurrence of it is a match. This is what
+    // the dictionary search in compress() yields, without building the
+    // dictionary itself
+    std::size_t num_matches = 0;
+    for (std::size_t i = 1; i < chunks.size(); i++) {
+        bool seen = false;
+        for (std::size_t j = 0; j < i; j++) {
+            seen |= (chunks[i] == chunks[j]);
+        }
+        num_matches += seen;
+    }
+
+    // Update stats
+    dictionaryStats.patterns[M] += num_matches;
+    dictionaryStats.patterns[X] += chunks.size() - num_matches;
+
+    // Set compression latency
+    comp_lat = Cycles(1);
+
+    // Set decompression latency
+    decomp_lat = Cycles(1);
+
+    // If there is more than one distinct value, the compressor failed
+    if (num_matches != chunks.size() - 1) {
+        DPRINTF(CacheComp, "Repeated qwords compression failed\n");
+        return blkSize * 8;
+    }
+
+    const DictionaryEntry bytes = toDictionaryEntry(chunks[0]);
+    return PatternFactory::getSizeBits(bytes, toDictionaryEntry(0), -1) +
+        num_matches * PatternFactory::getSizeBits(bytes, bytes, 0);
+}
+
 } // namespace compression
 } // namespace gem5
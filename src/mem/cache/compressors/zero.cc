@@ -79,5 +79,37 @@ Zero::compress(const std::vector<Chunk>& chunks, Cycles& comp_lat,
     return comp_data;
 }
 
+std::size_t
+Zero::compressSize(const std::vector<Chunk>& chunks, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    // Zero qwords always match the zero pattern, and every other qword is
+    // left uncompressed, so there is no need to go through the dictionary.
+    // The loop is kept branchless so that it can be vectorized
+    std::size_t num_zeros = 0;
+    for (const auto& value : chunks) {
+        num_zeros += (value == 0);
+    }
+
+    // Update stats
+    dictionaryStats.patterns[Z] += num_zeros;
+    dictionaryStats.patterns[X] += chunks.size() - num_zeros;
+
+    // Set compression latency (Assumes full line zero comparison)
+    comp_lat = Cycles(1);
+
+    // Set decompression latency
+    decomp_lat = Cycles(1);
+
+    // If there is any non-zero entry, the compressor failed
+    if (num_zeros != chunks.size()) {
+        DPRINTF(CacheComp, "Zero compression failed\n");
+        return blkSize * 8;
+    }
+
+    const DictionaryEntry zero = toDictionaryEntry(0);
+    return num_zeros * PatternFactory::getSizeBits(zero, zero, -1);
+}
+
 } // namespace compression
 } // namespace gem5
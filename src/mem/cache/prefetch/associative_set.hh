@@ -62,6 +62,13 @@ class AssociativeSet
     /** Vector containing the entries of the container */
     std::vector<Entry> entries;
 
+    /**
+     * Scratch vector holding the possible entries of the last lookup. It is
+     * reused across lookups so that tables that are accessed on every
+     * cache access do not allocate memory for each of them.
+     */
+    mutable std::vector<ReplaceableEntry*> candidates;
+
   public:
     /**
      * Public constructor
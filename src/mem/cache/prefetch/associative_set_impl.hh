@@ -42,6 +42,8 @@ AssociativeSet<Entry>::AssociativeSet(int assoc, int num_entries,
   : associativity(assoc), numEntries(num_entries), indexingPolicy(idx_policy),
     replacementPolicy(rpl_policy), entries(numEntries, init_value)
 {
+    candidates.reserve(assoc);
+
     fatal_if(!isPowerOf2(num_entries), "The number of entries of an "
              "AssociativeSet<> must be a power of 2");
     fatal_if(!isPowerOf2(assoc), "The associativity of an AssociativeSet<> "
@@ -58,10 +60,9 @@ Entry*
 AssociativeSet<Entry>::findEntry(Addr addr, bool is_secure) const
 {
     Addr tag = indexingPolicy->extractTag(addr);
-    const std::vector<ReplaceableEntry*> selected_entries =
-        indexingPolicy->getPossibleEntries(addr);
+    indexingPolicy->getPossibleEntries(addr, candidates);
 
-    for (const auto& location : selected_entries) {
+    for (const auto& location : candidates) {
         Entry* entry = static_cast<Entry *>(location);
         if ((entry->getTag() == tag) && entry->isValid() &&
             entry->isSecure() == is_secure) {
@@ -83,10 +84,9 @@ Entry*
 AssociativeSet<Entry>::findVictim(Addr addr)
 {
     // Get possible entries to be victimized
-    const std::vector<ReplaceableEntry*> selected_entries =
-        indexingPolicy->getPossibleEntries(addr);
+    indexingPolicy->getPossibleEntries(addr, candidates);
     Entry* victim = static_cast<Entry*>(replacementPolicy->getVictim(
-                            selected_entries));
+                            candidates));
     // There is only one eviction for this replacement
     invalidate(victim);
     return victim;
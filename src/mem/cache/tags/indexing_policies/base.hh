@@ -149,6 +149,22 @@ class BaseIndexingPolicy : public SimObject
     virtual std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr)
                                                                     const = 0;
 
+    /**
+     * Find all possible entries for insertion and replacement of an address,
+     * and store them in the given vector. Lookup intensive users can reuse
+     * the same vector across calls, so that no memory is allocated once it
+     * has grown to the associativity.
+     *
+     * @param addr The addr to a find possible entries for.
+     * @param entries The vector where the possible entries are stored.
+     */
+    virtual void
+    getPossibleEntries(const Addr addr,
+                       std::vector<ReplaceableEntry*> &entries) const
+    {
+        entries = getPossibleEntries(addr);
+    }
+
     /**
      * Regenerate an entry's address from its tag and assigned indexing bits.
      *
@@ -75,4 +75,12 @@ SetAssociative::getPossibleEntries(const Addr addr) const
     return sets[extractSet(addr)];
 }
 
+void
+SetAssociative::getPossibleEntries(const Addr addr,
+    std::vector<ReplaceableEntry*> &entries) const
+{
+    const auto &set = sets[extractSet(addr)];
+    entries.assign(set.begin(), set.end());
+}
+
 } // namespace gem5
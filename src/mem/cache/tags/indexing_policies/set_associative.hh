@@ -117,6 +117,8 @@ class SetAssociative : public BaseIndexingPolicy
      */
     std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
                                                                      override;
+    void getPossibleEntries(const Addr addr,
+        std::vector<ReplaceableEntry*> &entries) const override;
 
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
@@ -220,4 +220,17 @@ SkewedAssociative::getPossibleEntries(const Addr addr) const
     return entries;
 }
 
+void
+SkewedAssociative::getPossibleEntries(const Addr addr,
+    std::vector<ReplaceableEntry*> &entries) const
+{
+    entries.clear();
+
+    // Parse all ways
+    for (uint32_t way = 0; way < assoc; ++way) {
+        // Apply hash to get set, and get way entry in it
+        entries.push_back(sets[extractSet(addr, way)][way]);
+    }
+}
+
 } // namespace gem5
@@ -162,6 +162,8 @@ class SkewedAssociative : public BaseIndexingPolicy
      */
     std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
                                                                    override;
+    void getPossibleEntries(const Addr addr,
+        std::vector<ReplaceableEntry*> &entries) const override;
 
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
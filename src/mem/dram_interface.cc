@@ -657,6 +657,7 @@ DRAMInterface::DRAMInterface(const DRAMInterfaceParams &_p)
       maxAccessesPerRow(_p.max_accesses_per_row),
       timeStampOffset(0), activeRank(0),
       enableDRAMPowerdown(_p.enable_dram_powerdown),
+      lazyRefresh(_p.lazy_refresh),
       lastStatsResetTick(0),
       stats(*this)
 {
@@ -919,6 +920,13 @@ DRAMInterface::decodePacket(const PacketPtr pkt, Addr pkt_addr,
 
 void DRAMInterface::setupRank(const uint8_t rank, const bool is_read)
 {
+    // a lazily refreshing rank only stays lazy while the whole interface
+    // is idle, as the refresh of a rank interacts with the scheduling of
+    // requests to the other ranks
+    for (auto r : ranks) {
+        r->catchUpRefresh();
+    }
+
     // increment entry count of the rank based on packet type
     if (is_read) {
         ++ranks[rank]->readEntries;
@@ -992,6 +1000,9 @@ DRAMInterface::drainRanks()
 {
     // also need to kick off events to exit self-refresh
     for (auto r : ranks) {
+        // bring the refresh event loop back before draining
+        r->catchUpRefresh();
+
         // force self-refresh exit, which in turn will issue auto-refresh
         if (r->pwrState == PWR_SREF) {
             DPRINTF(DRAM,"Rank%d: Forcing self-refresh wakeup in drain\n",
@@ -1119,7 +1130,8 @@ DRAMInterface::Rank::Rank(const DRAMInterfaceParams &_p,
                          int _rank, DRAMInterface& _dram)
     : EventManager(&_dram), dram(_dram),
       pwrStateTrans(PWR_IDLE), pwrStatePostRefresh(PWR_IDLE),
-      pwrStateTick(0), refreshDueAt(0), pwrState(PWR_IDLE),
+      pwrStateTick(0), refreshDueAt(0), lazyRefreshStart(MaxTick),
+      pwrState(PWR_IDLE),
       refreshState(REF_IDLE), inLowPowerState(false), rank(_rank),
       readEntries(0), writeEntries(0), outstandingEvents(0),
       wakeUpAllowedAt(0), power(_p, false), banks(_p.banks_per_rank),
@@ -1168,6 +1180,9 @@ DRAMInterface::Rank::startup(Tick ref_tick)
 void
 DRAMInterface::Rank::suspend()
 {
+    // bring the refresh event loop back so that it can be stopped
+    catchUpRefresh();
+
     deschedule(refreshEvent);
 
     // Update the stats
@@ -1283,9 +1298,119 @@ DRAMInterface::Rank::processWriteDoneEvent()
     --outstandingEvents;
 }
 
+bool
+DRAMInterface::Rank::canRefreshLazily() const
+{
+    if (!dram.lazyRefresh || dram.enableDRAMPowerdown)
+        return false;
+
+    // the refresh must be able to proceed straight away, with all banks
+    // closed and nothing in flight for this rank
+    if (refreshState != REF_IDLE || pwrState != PWR_IDLE ||
+        inLowPowerState || numBanksActive != 0 || outstandingEvents != 0)
+        return false;
+
+    if (activateEvent.scheduled() || prechargeEvent.scheduled() ||
+        powerEvent.scheduled() || wakeUpEvent.scheduled() ||
+        writeDoneEvent.scheduled())
+        return false;
+
+    // the refresh would otherwise wait for the request loop to drain
+    if (dram.ctrl->requestEventScheduled(dram.pseudoChannel) ||
+        dram.ctrl->drainState() != DrainState::Running)
+        return false;
+
+    // finally, no rank of the interface may have queued requests
+    for (auto r : dram.ranks) {
+        if (r->readEntries != 0 || r->writeEntries != 0)
+            return false;
+    }
+
+    return true;
+}
+
+void
+DRAMInterface::Rank::catchUpRefresh()
+{
+    if (!inLazyRefresh())
+        return;
+
+    // the refresh event loop would have started a refresh every
+    // tREFI - tRP, going through the precharge-all and refresh states
+    // without any delay as the rank is idle, see processRefreshEvent
+    const Tick period = dram.tREFI - dram.tRP;
+    const Tick now = curTick();
+
+    // refreshes that started strictly before now, anything due now is
+    // left to the event loop
+    const uint64_t started = now > lazyRefreshStart ?
+        divCeil(now - lazyRefreshStart, period) : 0;
+
+    Tick idle_since = pwrStateTick;
+    Tick ref_at = lazyRefreshStart;
+
+    for (uint64_t i = 0; i < started; ++i, ref_at += period) {
+        Tick ref_done_at = ref_at + dram.tRFC;
+
+        cmdList.push_back(Command(MemCommand::REF, 0, ref_at));
+        DPRINTF(DRAMPower, "%llu,REF,0,%d\n", divCeil(ref_at, dram.tCK) -
+                dram.timeStampOffset, rank);
+
+        for (auto &b : banks) {
+            b.actAllowedAt = ref_done_at;
+        }
+
+        stats.pwrStateTime[PWR_IDLE] += ref_at - idle_since;
+        refreshDueAt = ref_at + dram.tREFI;
+
+        if (ref_done_at >= now) {
+            // the last refresh is still running, resume the event loop
+            // where it would be
+            assert(i == started - 1);
+            pwrState = PWR_REF;
+            pwrStateTrans = PWR_REF;
+            pwrStateTick = ref_at;
+            refreshState = REF_RUN;
+            ++outstandingEvents;
+            lazyRefreshStart = MaxTick;
+
+            DPRINTF(DRAMState, "Rank %d resuming refresh started at %llu\n",
+                    rank, ref_at);
+
+            updatePowerStats();
+            schedule(refreshEvent, ref_done_at);
+            return;
+        }
+
+        stats.pwrStateTime[PWR_REF] += dram.tRFC;
+        idle_since = ref_done_at;
+    }
+
+    pwrStateTick = idle_since;
+    lazyRefreshStart = MaxTick;
+
+    DPRINTF(DRAMState, "Rank %d caught up with %llu refreshes, next refresh "
+            "at %llu\n", rank, started, ref_at);
+
+    if (started != 0)
+        updatePowerStats();
+
+    // hand control back to the refresh event loop
+    schedule(refreshEvent, ref_at);
+}
+
 void
 DRAMInterface::Rank::processRefreshEvent()
 {
+    // an idle rank does not need any event to refresh, the refreshes are
+    // accounted for when the rank is next used
+    if (canRefreshLazily()) {
+        DPRINTF(DRAMState, "Rank %d idle, refreshing lazily from %llu\n",
+                rank, curTick());
+        lazyRefreshStart = curTick();
+        return;
+    }
+
     // when first preparing the refresh, remember when it was due
     if ((refreshState == REF_IDLE) || (refreshState == REF_SREF_EXIT)) {
         // remember when the refresh is due
@@ -1811,6 +1936,9 @@ DRAMInterface::Rank::computeStats()
 {
     DPRINTF(DRAM,"Computing stats due to a dump callback\n");
 
+    // account for any refresh that was not performed by the event loop
+    catchUpRefresh();
+
     // Update the stats
     updatePowerStats();
 
@@ -1837,9 +1965,11 @@ DRAMInterface::Rank::forceSelfRefreshExit() const {
 }
 
 void
-DRAMInterface::DRAMStats::resetStats()
+DRAMInterface::DRAMStats::postResetStats()
 {
     dram.lastStatsResetTick = curTick();
+
+    statistics::Group::postResetStats();
 }
 
 DRAMInterface::DRAMStats::DRAMStats(DRAMInterface &_dram)
@@ -2014,9 +2144,18 @@ DRAMInterface::RankStats::regStats()
 }
 
 void
-DRAMInterface::RankStats::resetStats()
+DRAMInterface::RankStats::preResetStats()
+{
+    // refreshes performed before the reset must not count after it
+    rank.catchUpRefresh();
+
+    statistics::Group::preResetStats();
+}
+
+void
+DRAMInterface::RankStats::postResetStats()
 {
-    statistics::Group::resetStats();
+    statistics::Group::postResetStats();
 
     rank.resetStats();
 }
@@ -165,7 +165,8 @@ class DRAMInterface : public MemInterface
         RankStats(DRAMInterface &dram, Rank &rank);
 
         void regStats() override;
-        void resetStats() override;
+        void preResetStats() override;
+        void postResetStats() override;
         void preDumpStats() override;
 
         Rank &rank;
@@ -256,11 +257,27 @@ class DRAMInterface : public MemInterface
          */
         Tick refreshDueAt;
 
+        /**
+         * Tick at which the first refresh of an idle period was due when
+         * the rank stopped scheduling refresh events, or MaxTick if the
+         * refresh state machine is driven by events.
+         */
+        Tick lazyRefreshStart;
+
         /**
          * Function to update Power Stats
          */
         void updatePowerStats();
 
+        /**
+         * Check if the rank, and the interface it belongs to, are idle
+         * enough for the refreshes to be accounted for analytically
+         * rather than through the refresh event loop.
+         *
+         * @return true if the refresh due now can be performed lazily
+         */
+        bool canRefreshLazily() const;
+
         /**
          * Schedule a power state transition in the future, and
          * potentially override an already scheduled transition.
@@ -373,6 +390,23 @@ class DRAMInterface : public MemInterface
          */
         bool inRefIdleState() const { return refreshState == REF_IDLE; }
 
+        /**
+         * Check if the refreshes of this rank are currently accounted for
+         * lazily, in which case no refresh event is scheduled.
+         *
+         * @return true if the rank is refreshing lazily
+         */
+        bool inLazyRefresh() const { return lazyRefreshStart != MaxTick; }
+
+        /**
+         * Account for all the refreshes that happened since the rank
+         * started refreshing lazily, as if the refresh event loop had been
+         * running, and hand control back to the refresh event loop. This
+         * must be called before anything observes the refresh, power or
+         * bank state of the rank.
+         */
+        void catchUpRefresh();
+
         /**
          * Check if the current rank has all banks closed and is not
          * in a low power state
@@ -544,6 +578,9 @@ class DRAMInterface : public MemInterface
     /** Enable or disable DRAM powerdown states. */
     bool enableDRAMPowerdown;
 
+    /** Account for refreshes of idle ranks without scheduling events. */
+    bool lazyRefresh;
+
     /** The time when stats were last reset used to calculate average power */
     Tick lastStatsResetTick;
 
@@ -581,7 +618,7 @@ class DRAMInterface : public MemInterface
         DRAMStats(DRAMInterface &dram);
 
         void regStats() override;
-        void resetStats() override;
+        void postResetStats() override;
 
         DRAMInterface &dram;
 
@@ -97,8 +97,9 @@ DRAMsim3::startup()
 }
 
 void
-DRAMsim3::resetStats() {
+DRAMsim3::postResetStats() {
     wrapper.resetStats();
+    AbstractMemory::postResetStats();
 }
 
 void
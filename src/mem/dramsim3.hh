@@ -210,7 +210,7 @@ class DRAMsim3 : public AbstractMemory
     void init() override;
     void startup() override;
 
-    void resetStats() override;
+    void postResetStats() override;
 
   protected:
 
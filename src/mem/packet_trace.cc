@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/packet_trace.hh"
+
+#include <zlib.h>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+void
+putVarint(std::vector<uint8_t> &out, uint64_t value)
+{
+    while (value >= 0x80) {
+        out.push_back(uint8_t(value) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(uint8_t(value));
+}
+
+void
+putSigned(std::vector<uint8_t> &out, int64_t value)
+{
+    // Zigzag encode so small negative deltas stay small
+    putVarint(out, (uint64_t(value) << 1) ^ uint64_t(value >> 63));
+}
+
+void
+putString(std::vector<uint8_t> &out, const std::string &str)
+{
+    putVarint(out, str.size());
+    out.insert(out.end(), str.begin(), str.end());
+}
+
+void
+putWord(std::vector<uint8_t> &out, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+        out.push_back(uint8_t(value >> (8 * i)));
+}
+
+uint64_t
+getVarint(const std::vector<uint8_t> &in, size_t &pos)
+{
+    uint64_t value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        fatal_if(pos >= in.size(), "Truncated packet trace record\n");
+        const uint8_t byte = in[pos++];
+        value |= uint64_t(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return value;
+    }
+    fatal("Malformed integer in packet trace\n");
+}
+
+int64_t
+getSigned(const std::vector<uint8_t> &in, size_t &pos)
+{
+    const uint64_t value = getVarint(in, pos);
+    return int64_t(value >> 1) ^ -int64_t(value & 1);
+}
+
+std::string
+getString(const std::vector<uint8_t> &in, size_t &pos)
+{
+    const uint64_t len = getVarint(in, pos);
+    fatal_if(in.size() - pos < len, "Truncated packet trace string\n");
+    std::string str(in.begin() + pos, in.begin() + pos + len);
+    pos += len;
+    return str;
+}
+
+bool
+readWord(std::ifstream &file, uint32_t &value)
+{
+    uint8_t bytes[4];
+    if (!file.read(reinterpret_cast<char *>(bytes), sizeof(bytes)))
+        return false;
+    value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) |
+        (uint32_t(bytes[3]) << 24);
+    return true;
+}
+
+} // anonymous namespace
+
+bool
+PacketTraceFormat::isPacketTrace(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+    uint32_t magic;
+    return file && readWord(file, magic) && magic == Magic;
+}
+
+PacketTraceWriter::PacketTraceWriter(const std::string &filename,
+                                     const PacketTraceHeader &header,
+                                     unsigned block_records,
+                                     int compression_level,
+                                     unsigned max_pending)
+    : filename(filename),
+      file(filename, std::ios::out | std::ios::binary | std::ios::trunc),
+      blockRecords(block_records), compressionLevel(compression_level),
+      maxPending(max_pending), numRecords(0), done(false),
+      errorReported(false)
+{
+    fatal_if(!file, "Could not open packet trace %s for writing\n",
+             filename);
+    fatal_if(block_records == 0 || max_pending == 0,
+             "Packet trace blocks and queue must not be empty\n");
+
+    std::vector<uint8_t> body;
+    putVarint(body, header.tickFreq);
+    putString(body, header.objId);
+    putVarint(body, header.idStrings.size());
+    for (const auto &id_string : header.idStrings) {
+        putVarint(body, id_string.first);
+        putString(body, id_string.second);
+    }
+
+    std::vector<uint8_t> out;
+    putWord(out, PacketTraceFormat::Magic);
+    putWord(out, PacketTraceFormat::Version);
+    putWord(out, body.size());
+    out.insert(out.end(), body.begin(), body.end());
+    file.write(reinterpret_cast<const char *>(out.data()), out.size());
+
+    compressor = std::thread([this]() { compressLoop(); });
+}
+
+PacketTraceWriter::~PacketTraceWriter()
+{
+    // Once an error has been reported nothing more is written
+    if (current.records && !errorReported)
+        submit();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+    }
+    notEmpty.notify_one();
+    compressor.join();
+
+    if (!errorReported) {
+        file.close();
+        if (!file && error.empty())
+            error = csprintf("Failed to write packet trace %s\n", filename);
+        std::unique_lock<std::mutex> lock(mutex);
+        reportError(lock);
+    }
+}
+
+void
+PacketTraceWriter::write(const PacketTraceRecord &record)
+{
+    std::vector<uint8_t> &out = current.data;
+
+    uint8_t changed = 0;
+    if (record.cmd != last.cmd)
+        changed |= PacketTraceFormat::CmdChanged;
+    if (record.flags != last.flags)
+        changed |= PacketTraceFormat::FlagsChanged;
+    if (record.size != last.size)
+        changed |= PacketTraceFormat::SizeChanged;
+    if (record.pc != last.pc)
+        changed |= PacketTraceFormat::PcChanged;
+
+    out.push_back(changed);
+    putSigned(out, record.tick - last.tick);
+    putSigned(out, record.addr - last.addr);
+    putSigned(out, record.pktId - last.pktId);
+    if (changed & PacketTraceFormat::CmdChanged)
+        putVarint(out, record.cmd);
+    if (changed & PacketTraceFormat::FlagsChanged)
+        putVarint(out, record.flags);
+    if (changed & PacketTraceFormat::SizeChanged)
+        putVarint(out, record.size);
+    if (changed & PacketTraceFormat::PcChanged)
+        putSigned(out, record.pc - last.pc);
+
+    last = record;
+    ++numRecords;
+
+    if (++current.records == blockRecords)
+        submit();
+}
+
+void
+PacketTraceWriter::submit()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [this]() {
+            return pending.size() < maxPending || !error.empty();
+        });
+        reportError(lock);
+        pending.push_back(std::move(current));
+    }
+    notEmpty.notify_one();
+
+    current = Block();
+    current.data.reserve(blockRecords * 8);
+    last = PacketTraceRecord();
+}
+
+void
+PacketTraceWriter::compressLoop()
+{
+    std::vector<uint8_t> compressed;
+
+    while (true) {
+        Block block;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            notEmpty.wait(lock, [this]() { return done || !pending.empty(); });
+            if (pending.empty())
+                return;
+            block = std::move(pending.front());
+            pending.pop_front();
+        }
+        notFull.notify_one();
+
+        uLongf size = compressBound(block.data.size());
+        compressed.resize(size);
+        const int ret = compress2(compressed.data(), &size,
+                                  block.data.data(), block.data.size(),
+                                  compressionLevel);
+        if (ret != Z_OK) {
+            std::lock_guard<std::mutex> lock(mutex);
+            error = csprintf("Failed to compress a block of packet trace "
+                             "%s: zlib error %d\n", filename, ret);
+            notFull.notify_one();
+            return;
+        }
+
+        std::vector<uint8_t> frame;
+        putWord(frame, size);
+        putWord(frame, block.data.size());
+        putWord(frame, block.records);
+        file.write(reinterpret_cast<const char *>(frame.data()),
+                   frame.size());
+        file.write(reinterpret_cast<const char *>(compressed.data()), size);
+        if (!file) {
+            std::lock_guard<std::mutex> lock(mutex);
+            error = csprintf("Failed to write a block of packet trace %s\n",
+                             filename);
+            notFull.notify_one();
+            return;
+        }
+    }
+}
+
+void
+PacketTraceWriter::reportError(std::unique_lock<std::mutex> &lock)
+{
+    if (error.empty())
+        return;
+
+    // Raise the error only once, the destructor must not raise it again
+    const std::string msg = error;
+    errorReported = true;
+    lock.unlock();
+    fatal("%s", msg);
+}
+
+PacketTraceReader::PacketTraceReader(const std::string &filename)
+    : filename(filename),
+      file(filename, std::ios::in | std::ios::binary),
+      pos(0), remaining(0)
+{
+    fatal_if(!file, "Could not open packet trace %s\n", filename);
+
+    uint32_t magic, version, size;
+    fatal_if(!readWord(file, magic) || magic != PacketTraceFormat::Magic,
+             "%s is not a packet trace\n", filename);
+    fatal_if(!readWord(file, version) ||
+             version != PacketTraceFormat::Version,
+             "Unsupported packet trace version in %s\n", filename);
+    fatal_if(!readWord(file, size), "Truncated packet trace header\n");
+
+    std::vector<uint8_t> body(size);
+    fatal_if(!file.read(reinterpret_cast<char *>(body.data()), size),
+             "Truncated packet trace header\n");
+
+    size_t offset = 0;
+    hdr.tickFreq = getVarint(body, offset);
+    hdr.objId = getString(body, offset);
+    const uint64_t num_ids = getVarint(body, offset);
+    for (uint64_t i = 0; i < num_ids; ++i) {
+        const uint32_t key = getVarint(body, offset);
+        hdr.idStrings[key] = getString(body, offset);
+    }
+
+    firstBlock = file.tellg();
+}
+
+bool
+PacketTraceReader::nextBlock()
+{
+    uint32_t compressed_size, raw_size, records;
+    if (!readWord(file, compressed_size))
+        return false;
+    fatal_if(!readWord(file, raw_size) || !readWord(file, records),
+             "Truncated packet trace block in %s\n", filename);
+
+    compressed.resize(compressed_size);
+    fatal_if(!file.read(reinterpret_cast<char *>(compressed.data()),
+                        compressed_size),
+             "Truncated packet trace block in %s\n", filename);
+
+    block.resize(raw_size);
+    uLongf size = raw_size;
+    const int ret = uncompress(block.data(), &size, compressed.data(),
+                               compressed_size);
+    fatal_if(ret != Z_OK || size != raw_size,
+             "Corrupt packet trace block in %s\n", filename);
+
+    pos = 0;
+    remaining = records;
+    last = PacketTraceRecord();
+    return true;
+}
+
+bool
+PacketTraceReader::read(PacketTraceRecord &record)
+{
+    while (remaining == 0) {
+        if (!nextBlock())
+            return false;
+    }
+
+    fatal_if(pos >= block.size(), "Truncated packet trace block\n");
+    const uint8_t changed = block[pos++];
+
+    record.tick = last.tick + getSigned(block, pos);
+    record.addr = last.addr + getSigned(block, pos);
+    record.pktId = last.pktId + getSigned(block, pos);
+    record.cmd = changed & PacketTraceFormat::CmdChanged ?
+        getVarint(block, pos) : last.cmd;
+    record.flags = changed & PacketTraceFormat::FlagsChanged ?
+        getVarint(block, pos) : last.flags;
+    record.size = changed & PacketTraceFormat::SizeChanged ?
+        getVarint(block, pos) : last.size;
+    record.pc = changed & PacketTraceFormat::PcChanged ?
+        last.pc + getSigned(block, pos) : last.pc;
+
+    last = record;
+    --remaining;
+    return true;
+}
+
+void
+PacketTraceReader::reset()
+{
+    file.clear();
+    file.seekg(firstBlock);
+    remaining = 0;
+}
+
+} // namespace gem5
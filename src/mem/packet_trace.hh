@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * A compact, block compressed format for memory packet traces.
+ *
+ * The file starts with a header holding a magic number, the format
+ * version, the tick frequency, the name of the object which recorded
+ * the trace and the names of the requestors. It is followed by a
+ * sequence of blocks, each holding a batch of records. The records of
+ * a block are encoded as deltas against the previous record in the
+ * same block using variable length integers, and the block is then
+ * compressed with zlib. Every block starts from a zeroed record, so
+ * blocks can be decoded independently.
+ *
+ * The writer hands complete blocks to a background thread which
+ * compresses them and writes them out, so the cost seen by the
+ * simulation thread is encoding a handful of bytes per record. Errors
+ * on the background thread are handed back and reported by the
+ * simulation thread the next time it submits a block.
+ */
+
+#ifndef __MEM_PACKET_TRACE_HH__
+#define __MEM_PACKET_TRACE_HH__
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/** One packet in a trace */
+struct PacketTraceRecord
+{
+    Tick tick = 0;
+    uint32_t cmd = 0;
+    uint32_t flags = 0;
+    Addr addr = 0;
+    uint32_t size = 0;
+    /** Program counter, zero if unknown */
+    Addr pc = 0;
+    uint64_t pktId = 0;
+};
+
+/** Header of a trace */
+struct PacketTraceHeader
+{
+    std::string objId;
+    uint64_t tickFreq = 0;
+    /** Requestor names by requestor id */
+    std::map<uint32_t, std::string> idStrings;
+};
+
+/** Format constants shared by the reader and the writer */
+struct PacketTraceFormat
+{
+    /** The ASCII characters g5pt */
+    static constexpr uint32_t Magic = 0x74703567;
+    static constexpr uint32_t Version = 1;
+
+    /** Record fields which are only present if they changed */
+    enum Changed : uint8_t
+    {
+        CmdChanged = 1 << 0,
+        FlagsChanged = 1 << 1,
+        SizeChanged = 1 << 2,
+        PcChanged = 1 << 3,
+    };
+
+    /**
+     * Check whether a file starts with the magic number of this
+     * format.
+     */
+    static bool isPacketTrace(const std::string &filename);
+};
+
+/**
+ * Writes a block compressed packet trace. Records are batched into
+ * blocks which are compressed and written by a background thread.
+ */
+class PacketTraceWriter
+{
+  public:
+    /**
+     * @param filename File to create or truncate
+     * @param header Header written at the start of the file
+     * @param block_records Number of records per block
+     * @param compression_level zlib compression level, 0-9
+     * @param max_pending Number of full blocks which may wait for the
+     *        background thread before the writer blocks
+     */
+    PacketTraceWriter(const std::string &filename,
+                      const PacketTraceHeader &header,
+                      unsigned block_records = 65536,
+                      int compression_level = 1,
+                      unsigned max_pending = 4);
+
+    /**
+     * Flushes the last block and waits for everything to be written.
+     * It is a fatal error if the background thread failed.
+     */
+    ~PacketTraceWriter();
+
+    void write(const PacketTraceRecord &record);
+
+    /** Number of records written so far */
+    uint64_t records() const { return numRecords; }
+
+  private:
+    struct Block
+    {
+        std::vector<uint8_t> data;
+        uint32_t records = 0;
+    };
+
+    /** Queue the current block for compression and start a new one */
+    void submit();
+
+    /** Body of the background thread */
+    void compressLoop();
+
+    /**
+     * Report an error of the background thread on the calling thread.
+     * Must be called with the mutex held by lock.
+     */
+    void reportError(std::unique_lock<std::mutex> &lock);
+
+    const std::string filename;
+    std::ofstream file;
+
+    const unsigned blockRecords;
+    const int compressionLevel;
+    const unsigned maxPending;
+
+    /** Block being filled by the simulation thread */
+    Block current;
+
+    /** Previous record of the current block */
+    PacketTraceRecord last;
+
+    uint64_t numRecords;
+
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    std::deque<Block> pending;
+    bool done;
+
+    /** First error of the background thread, empty if none */
+    std::string error;
+
+    /** Whether the error has been reported on the simulation thread */
+    bool errorReported;
+
+    std::thread compressor;
+};
+
+/**
+ * Reads a block compressed packet trace one record at a time.
+ */
+class PacketTraceReader
+{
+  public:
+    /**
+     * Open a trace and read its header. It is a fatal error if the
+     * file is not a packet trace.
+     */
+    PacketTraceReader(const std::string &filename);
+
+    const PacketTraceHeader &header() const { return hdr; }
+
+    /**
+     * Read the next record.
+     *
+     * @return false at the end of the trace
+     */
+    bool read(PacketTraceRecord &record);
+
+    /** Rewind to the first record */
+    void reset();
+
+  private:
+    /** Read and decompress the next block */
+    bool nextBlock();
+
+    const std::string filename;
+    std::ifstream file;
+
+    PacketTraceHeader hdr;
+
+    /** Offset of the first block in the file */
+    std::streampos firstBlock;
+
+    /** Decompressed current block */
+    std::vector<uint8_t> block;
+    size_t pos;
+    uint32_t remaining;
+
+    /** Previous record of the current block */
+    PacketTraceRecord last;
+
+    /** Compressed data of the current block */
+    std::vector<uint8_t> compressed;
+};
+
+} // namespace gem5
+
+#endif // __MEM_PACKET_TRACE_HH__
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "base/gtest/logging.hh"
+#include "mem/packet_trace.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+std::string
+tempTraceName()
+{
+    return testing::TempDir() + "packet_trace.test." +
+        std::to_string(testing::UnitTest::GetInstance()->random_seed()) +
+        ".g5pt";
+}
+
+std::vector<PacketTraceRecord>
+randomRecords(size_t count)
+{
+    std::mt19937_64 rng(1);
+    std::vector<PacketTraceRecord> records;
+    PacketTraceRecord record;
+    for (size_t i = 0; i < count; ++i) {
+        record.tick += rng() % 1000;
+        record.cmd = rng() % 4 ? 1 : 4;
+        record.flags = rng() % 16 ? 0 : rng() % 256;
+        // Mostly sequential with the odd far jump backwards or forwards
+        record.addr = rng() % 8 ? record.addr + 64 : rng();
+        record.size = rng() % 8 ? 64 : 4;
+        record.pc = rng() % 2 ? 0 : 0x400000 + rng() % 4096;
+        record.pktId = i * 3 + rng() % 5;
+        records.push_back(record);
+    }
+    return records;
+}
+
+void
+expectEqual(const PacketTraceRecord &a, const PacketTraceRecord &b)
+{
+    EXPECT_EQ(a.tick, b.tick);
+    EXPECT_EQ(a.cmd, b.cmd);
+    EXPECT_EQ(a.flags, b.flags);
+    EXPECT_EQ(a.addr, b.addr);
+    EXPECT_EQ(a.size, b.size);
+    EXPECT_EQ(a.pc, b.pc);
+    EXPECT_EQ(a.pktId, b.pktId);
+}
+
+} // anonymous namespace
+
+TEST(PacketTraceTest, RoundTrip)
+{
+    const std::string name = tempTraceName();
+    const auto records = randomRecords(10000);
+
+    PacketTraceHeader header;
+    header.objId = "system.monitor";
+    header.tickFreq = 1000000000000ULL;
+    header.idStrings[0] = "writebacks";
+    header.idStrings[5] = "system.cpu.inst";
+
+    {
+        // Small blocks so the trace spans many of them
+        PacketTraceWriter writer(name, header, 333, 1, 2);
+        for (const auto &record : records)
+            writer.write(record);
+        EXPECT_EQ(records.size(), writer.records());
+    }
+
+    EXPECT_TRUE(PacketTraceFormat::isPacketTrace(name));
+
+    PacketTraceReader reader(name);
+    EXPECT_EQ(header.objId, reader.header().objId);
+    EXPECT_EQ(header.tickFreq, reader.header().tickFreq);
+    EXPECT_EQ(header.idStrings, reader.header().idStrings);
+
+    // Read the trace twice to check rewinding
+    for (int pass = 0; pass < 2; ++pass) {
+        PacketTraceRecord record;
+        for (const auto &expected : records) {
+            ASSERT_TRUE(reader.read(record));
+            expectEqual(expected, record);
+        }
+        EXPECT_FALSE(reader.read(record));
+        reader.reset();
+    }
+
+    std::remove(name.c_str());
+}
+
+TEST(PacketTraceTest, Empty)
+{
+    const std::string name = tempTraceName();
+
+    {
+        PacketTraceWriter writer(name, PacketTraceHeader());
+    }
+
+    PacketTraceReader reader(name);
+    PacketTraceRecord record;
+    EXPECT_FALSE(reader.read(record));
+
+    std::remove(name.c_str());
+}
+
+TEST(PacketTraceTest, NotATrace)
+{
+    const std::string name = tempTraceName();
+    {
+        std::ofstream file(name);
+        file << "gem5 but not a packet trace";
+    }
+
+    EXPECT_FALSE(PacketTraceFormat::isPacketTrace(name));
+
+    std::remove(name.c_str());
+}
+
+/*
+ * A failed write on the background thread is raised by the writer
+ * rather than killing the process from the background thread.
+ */
+TEST(PacketTraceTest, WriteError)
+{
+    if (!std::ifstream("/dev/full"))
+        GTEST_SKIP() << "No /dev/full to fail writes";
+
+    const std::vector<PacketTraceRecord> records = randomRecords(1 << 20);
+
+    gtestLogOutput.str("");
+    EXPECT_ANY_THROW({
+        PacketTraceWriter writer("/dev/full", PacketTraceHeader(), 1024,
+                                 0, 1);
+        for (const auto &record : records)
+            writer.write(record);
+    });
+    EXPECT_NE(gtestLogOutput.str().find(
+                  "Failed to write a block of packet trace /dev/full"),
+              std::string::npos);
+}
@@ -48,3 +48,12 @@ class BaseMemProbe(SimObject):
         Parent.any, "Probe manager(s) to instrument"
     )
     probe_name = Param.String("PktRequest", "Memory request probe to use")
+    # Packets are copied into a ring buffer and handled by a separate
+    # thread, which keeps expensive analyses off the simulation thread.
+    # The buffer is flushed before stats are dumped or reset and when
+    # draining.
+    ring_buffer_entries = Param.Unsigned(
+        0,
+        "Ring buffer size for handling packets off the simulation "
+        "thread (0 handles packets synchronously)",
+    )
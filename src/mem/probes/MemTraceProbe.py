@@ -38,14 +38,29 @@ from m5.proxy import *
 from m5.objects.BaseMemProbe import BaseMemProbe
 
 
+class MemTraceFormat(Enum):
+    vals = ["protobuf", "block"]
+
+
 class MemTraceProbe(BaseMemProbe):
     type = "MemTraceProbe"
     cxx_header = "mem/probes/mem_trace.hh"
     cxx_class = "gem5::MemTraceProbe"
 
-    # Boolean to compress the trace or not.
+    # protobuf writes one message per packet, optionally gzipped. block
+    # batches delta-encoded packets into blocks compressed off the
+    # simulation thread, and can be replayed by TraceGen.
+    trace_format = Param.MemTraceFormat("protobuf", "Trace file format")
+
+    # Boolean to compress the trace or not. Block traces are always
+    # compressed.
     trace_compress = Param.Bool(True, "Enable trace compression")
 
+    # Packets per block in the block format
+    trace_block_packets = Param.Unsigned(
+        65536, "Packets per compressed block in block traces"
+    )
+
     # For requests with a valid PC, include the PC in the trace
     with_pc = Param.Bool(False, "Include PC info in the trace")
 
@@ -58,6 +58,19 @@ class StackDistProbe(BaseMemProbe):
         False, "Verify behaviuor with reference implementation"
     )
 
+    # spatial sampling of the addresses (SHARDS)
+    sampling_rate = Param.Float(
+        1.0,
+        "Fraction of the cache lines whose stack distance is tracked. "
+        "Distances and counts are scaled to estimate those of the full "
+        "stream",
+    )
+    max_entries = Param.UInt64(
+        0,
+        "Maximum number of tracked cache lines, lowering the sampling rate "
+        "as needed to bound memory (0 = unbounded)",
+    )
+
     # linear histogram bins and enable/disable
     linear_hist_bins = Param.Unsigned("16", "Bins in linear histograms")
     disable_linear_hists = Param.Bool(False, "Disable linear histograms")
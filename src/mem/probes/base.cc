@@ -43,7 +43,7 @@ namespace gem5
 {
 
 BaseMemProbe::BaseMemProbe(const BaseMemProbeParams &p)
-    : SimObject(p)
+    : SimObject(p), samplePeriod(1)
 {
 }
 
@@ -53,11 +53,48 @@ BaseMemProbe::regProbeListeners()
     const BaseMemProbeParams &p =
         dynamic_cast<const BaseMemProbeParams &>(params());
 
+    if (p.ring_buffer_entries) {
+        ringBuffer.reset(new ProbeRingBuffer<probing::PacketInfo>(
+            p.ring_buffer_entries,
+            [this](const probing::PacketInfo &pkt_info) {
+                handleRequest(pkt_info);
+            }));
+    }
+
     listeners.resize(p.manager.size());
     for (int i = 0; i < p.manager.size(); i++) {
         ProbeManager *const mgr(p.manager[i]->getProbeManager());
         listeners[i].reset(new PacketListener(*this, mgr, p.probe_name));
+        listeners[i]->setSamplePeriod(samplePeriod);
     }
 }
 
+void
+BaseMemProbe::flush()
+{
+    if (ringBuffer)
+        ringBuffer->flush();
+}
+
+DrainState
+BaseMemProbe::drain()
+{
+    flush();
+    return DrainState::Drained;
+}
+
+void
+BaseMemProbe::preResetStats()
+{
+    flush();
+    SimObject::preResetStats();
+}
+
+void
+BaseMemProbe::preDumpStats()
+{
+    flush();
+    SimObject::preDumpStats();
+}
+
 } // namespace gem5
@@ -42,6 +42,7 @@
 #include <vector>
 
 #include "sim/probe/mem.hh"
+#include "sim/probe/ring_buffer.hh"
 #include "sim/sim_object.hh"
 
 namespace gem5
@@ -60,6 +61,11 @@ struct BaseMemProbeParams;
  * from multiple components using the same probe. For example, a stack
  * distance probe could be hooked up to multiple memories in a
  * multi-channel configuration.
+ *
+ * Derived classes can opt into sampling packets, and packets can
+ * optionally be handled by a separate thread fed through a ring buffer. curTick() then returns the tick the
+ * packet was seen at, but derived classes that use the ring buffer
+ * must not depend on any other simulator state in handleRequest().
  */
 class BaseMemProbe : public SimObject
 {
@@ -68,12 +74,29 @@ class BaseMemProbe : public SimObject
 
     void regProbeListeners() override;
 
+    DrainState drain() override;
+    void preResetStats() override;
+    void preDumpStats() override;
+
   protected:
     /**
      * Callback to analyse intercepted Packets.
      */
     virtual void handleRequest(const probing::PacketInfo &pkt_info) = 0;
 
+    /**
+     * Wait until all packets in the ring buffer, if any, have been
+     * handled.
+     */
+    void flush();
+
+    /**
+     * Only handle every Nth packet of each probe point. All packets are
+     * handled unless a derived class that only gathers statistics opts
+     * into sampling by setting this in its constructor.
+     */
+    uint64_t samplePeriod;
+
   private:
     class PacketListener : public ProbeListenerArgBase<probing::PacketInfo>
     {
@@ -84,7 +107,10 @@ class BaseMemProbe : public SimObject
               parent(_parent) {}
 
         void notify(const probing::PacketInfo &pkt_info) override {
-            parent.handleRequest(pkt_info);
+            if (parent.ringBuffer)
+                parent.ringBuffer->push(pkt_info);
+            else
+                parent.handleRequest(pkt_info);
         }
 
       protected:
@@ -92,6 +118,9 @@ class BaseMemProbe : public SimObject
     };
 
     std::vector<std::unique_ptr<PacketListener>> listeners;
+
+    /** Buffer feeding handleRequest() from a separate thread. */
+    std::unique_ptr<ProbeRingBuffer<probing::PacketInfo>> ringBuffer;
 };
 
 } // namespace gem5
@@ -38,6 +38,7 @@
 #include "mem/probes/mem_trace.hh"
 
 #include "base/callback.hh"
+#include "base/logging.hh"
 #include "base/output.hh"
 #include "params/MemTraceProbe.hh"
 #include "proto/packet.pb.h"
@@ -52,10 +53,19 @@ MemTraceProbe::MemTraceProbe(const MemTraceProbeParams &p)
     : BaseMemProbe(p),
       traceStream(nullptr),
       system(p.system),
-      withPC(p.with_pc)
+      withPC(p.with_pc),
+      format(p.trace_format),
+      blockPackets(p.trace_block_packets)
 {
-    std::string filename;
-    if (p.trace_file != "") {
+    fatal_if(p.ring_buffer_entries, "%s: Trace output errors are raised "
+             "where packets are handled, which has to be the simulation "
+             "thread, set ring_buffer_entries to 0.", name());
+
+    if (format == enums::block) {
+        // Block traces are always compressed, so don't append .gz
+        filename = simout.resolve(p.trace_file != "" ? p.trace_file :
+                                  name() + ".g5pt");
+    } else if (p.trace_file != "") {
         // If the trace file is not specified as an absolute path,
         // append the current simulation output directory
         filename = simout.resolve(p.trace_file);
@@ -74,7 +84,8 @@ MemTraceProbe::MemTraceProbe(const MemTraceProbeParams &p)
                                   (p.trace_compress ? ".gz" : ""));
     }
 
-    traceStream = new ProtoOutputStream(filename);
+    if (format == enums::protobuf)
+        traceStream = new ProtoOutputStream(filename);
 
     // Register a callback to compensate for the destructor not
     // being called. The callback forces the stream to flush and
@@ -85,6 +96,18 @@ MemTraceProbe::MemTraceProbe(const MemTraceProbeParams &p)
 void
 MemTraceProbe::startup()
 {
+    if (format == enums::block) {
+        PacketTraceHeader header;
+        header.objId = name();
+        header.tickFreq = sim_clock::Frequency;
+        for (int i = 0; i < system->maxRequestors(); i++)
+            header.idStrings[i] = system->getRequestorName(i);
+
+        blockWriter.reset(new PacketTraceWriter(filename, header,
+                                                blockPackets));
+        return;
+    }
+
     // Create a protobuf message for the header and write it to
     // the stream
     ProtoMessage::PacketHeader header_msg;
@@ -105,11 +128,29 @@ MemTraceProbe::closeStreams()
 {
     if (traceStream != NULL)
         delete traceStream;
+    traceStream = nullptr;
+
+    // Flushes the last block and waits for the compression thread
+    blockWriter.reset();
 }
 
 void
 MemTraceProbe::handleRequest(const probing::PacketInfo &pkt_info)
 {
+    if (blockWriter) {
+        PacketTraceRecord record;
+        record.tick = curTick();
+        record.cmd = pkt_info.cmd.toInt();
+        record.flags = pkt_info.flags;
+        record.addr = pkt_info.addr;
+        record.size = pkt_info.size;
+        if (withPC)
+            record.pc = pkt_info.pc;
+        record.pktId = pkt_info.id;
+        blockWriter->write(record);
+        return;
+    }
+
     ProtoMessage::Packet pkt_msg;
 
     pkt_msg.set_tick(curTick());
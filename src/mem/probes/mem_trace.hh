@@ -38,7 +38,12 @@
 #ifndef __MEM_PROBES_MEM_TRACE_HH__
 #define __MEM_PROBES_MEM_TRACE_HH__
 
+#include <memory>
+#include <string>
+
+#include "enums/MemTraceFormat.hh"
 #include "mem/packet.hh"
+#include "mem/packet_trace.hh"
 #include "mem/probes/base.hh"
 #include "proto/protoio.hh"
 
@@ -69,12 +74,23 @@ class MemTraceProbe : public BaseMemProbe
     /** Trace output stream */
     ProtoOutputStream *traceStream;
 
+    /** Block trace writer, created at startup as it needs the header */
+    std::unique_ptr<PacketTraceWriter> blockWriter;
+
     System *system;
 
   private:
 
     /** Include the Program Counter in the memory trace */
     const bool withPC;
+
+    const enums::MemTraceFormat format;
+
+    /** Packets per block in the block format */
+    const unsigned blockPackets;
+
+    /** Trace file name */
+    std::string filename;
 };
 
 } // namespace gem5
@@ -48,7 +48,8 @@ StackDistProbe::StackDistProbe(const StackDistProbeParams &p)
       lineSize(p.line_size),
       disableLinearHists(p.disable_linear_hists),
       disableLogHists(p.disable_log_hists),
-      calc(p.verify),
+      calc(p.verify, p.sampling_rate, p.max_entries),
+      weightCarry(0.0),
       stats(this)
 {
     fatal_if(p.system->cacheLineSize() > p.line_size,
@@ -106,19 +107,30 @@ StackDistProbe::handleRequest(const probing::PacketInfo &pkt_info)
     // Align the address to a cache line size
     const Addr aligned_addr(roundDown(pkt_info.addr, lineSize));
 
+    // With sampling, only a subset of the lines is tracked
+    if (!calc.isSampled(aligned_addr))
+        return;
+
     // Calculate the stack distance
     const uint64_t sd(calc.calcStackDistAndUpdate(aligned_addr).first);
+
+    // Each sampled access stands for 1/R accesses of the full stream.
+    // Carry the fraction over so the counts are unbiased estimates.
+    weightCarry += 1.0 / calc.samplingRate();
+    const int weight = int(weightCarry);
+    weightCarry -= weight;
+
     if (sd == StackDistCalc::Infinity) {
-        stats.infiniteSD++;
+        stats.infiniteSD += weight;
         return;
     }
 
     // Sample the stack distance of the address in linear bins
     if (!disableLinearHists) {
         if (pkt_info.cmd.isRead())
-            stats.readLinearHist.sample(sd);
+            stats.readLinearHist.sample(sd, weight);
         else
-            stats.writeLinearHist.sample(sd);
+            stats.writeLinearHist.sample(sd, weight);
     }
 
     if (!disableLogHists) {
@@ -126,9 +138,9 @@ StackDistProbe::handleRequest(const probing::PacketInfo &pkt_info)
 
         // Sample the stack distance of the address in log bins
         if (pkt_info.cmd.isRead())
-            stats.readLogHist.sample(sd_lg2);
+            stats.readLogHist.sample(sd_lg2, weight);
         else
-            stats.writeLogHist.sample(sd_lg2);
+            stats.writeLogHist.sample(sd_lg2, weight);
     }
 }
 
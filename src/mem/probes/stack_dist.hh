@@ -69,6 +69,9 @@ class StackDistProbe : public BaseMemProbe
   protected:
     StackDistCalc calc;
 
+    // Fraction of a sampled access not yet counted in the stats
+    double weightCarry;
+
     struct StackDistProbeStats : public statistics::Group
     {
         StackDistProbeStats(StackDistProbe* parent);
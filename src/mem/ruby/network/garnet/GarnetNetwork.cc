@@ -583,17 +583,10 @@ GarnetNetwork::collateStats()
 }
 
 void
-GarnetNetwork::resetStats()
+GarnetNetwork::postResetStats()
 {
-    for (int i = 0; i < m_routers.size(); i++) {
-        m_routers[i]->resetStats();
-    }
-    for (int i = 0; i < m_networklinks.size(); i++) {
-        m_networklinks[i]->resetStats();
-    }
-    for (int i = 0; i < m_creditlinks.size(); i++) {
-        m_creditlinks[i]->resetStats();
-    }
+    // The routers and links are reset as part of the object tree.
+    Network::postResetStats();
 }
 
 void
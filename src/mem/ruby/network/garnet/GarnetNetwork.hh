@@ -114,7 +114,7 @@ class GarnetNetwork : public Network
     // Stats
     void collateStats();
     void regStats();
-    void resetStats();
+    void postResetStats() override;
     void print(std::ostream& out) const;
 
     // increment counters
@@ -110,13 +110,15 @@ NetworkLink::wakeup()
 }
 
 void
-NetworkLink::resetStats()
+NetworkLink::postResetStats()
 {
     for (int i = 0; i < m_vc_load.size(); i++) {
         m_vc_load[i] = 0;
     }
 
     m_link_utilized = 0;
+
+    ClockedObject::postResetStats();
 }
 
 bool
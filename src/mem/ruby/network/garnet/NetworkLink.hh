@@ -83,7 +83,7 @@ class NetworkLink : public ClockedObject, public Consumer
 
     bool functionalRead(Packet *pkt, WriteMask &mask);
     uint32_t functionalWrite(Packet *);
-    void resetStats();
+    void postResetStats() override;
 
     std::vector<int> mVnets;
     uint32_t bitWidth;
@@ -235,7 +235,7 @@ Router::collateStats()
 }
 
 void
-Router::resetStats()
+Router::postResetStats()
 {
     for (int i = 0; i < m_input_unit.size(); i++) {
             m_input_unit[i]->resetStats();
@@ -243,6 +243,8 @@ Router::resetStats()
 
     crossbarSwitch.resetStats();
     switchAllocator.resetStats();
+
+    BasicRouter::postResetStats();
 }
 
 void
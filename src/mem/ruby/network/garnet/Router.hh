@@ -126,7 +126,7 @@ class Router : public BasicRouter, public Consumer
 
     void regStats();
     void collateStats();
-    void resetStats();
+    void postResetStats() override;
 
     // For Fault Model:
     bool get_fault_vector(int temperature, float fault_vector[]) {
@@ -170,9 +170,11 @@ Switch::regStats()
 }
 
 void
-Switch::resetStats()
+Switch::postResetStats()
 {
     perfectSwitch.clearStats();
+
+    BasicRouter::postResetStats();
 }
 
 void
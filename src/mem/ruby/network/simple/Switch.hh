@@ -96,7 +96,7 @@ class Switch : public BasicRouter
                     bool is_external,
                     PortDirection dst_inport = "");
 
-    void resetStats();
+    void postResetStats() override;
     void collateStats();
     void regStats();
     const statistics::Formula & getMsgCount(unsigned int type) const
@@ -116,13 +116,15 @@ AbstractController::init()
 }
 
 void
-AbstractController::resetStats()
+AbstractController::postResetStats()
 {
     stats.delayHistogram.reset();
     uint32_t size = Network::getNumberOfVirtualNetworks();
     for (uint32_t i = 0; i < size; i++) {
         stats.delayVCHistogram[i]->reset();
     }
+
+    ClockedObject::postResetStats();
 }
 
 void
@@ -333,7 +333,7 @@ GPUCoalescer::printRequestTable(std::stringstream& ss)
 }
 
 void
-GPUCoalescer::resetStats()
+GPUCoalescer::postResetStats()
 {
     m_latencyHist.reset();
     m_missLatencyHist.reset();
@@ -353,6 +353,8 @@ GPUCoalescer::resetStats()
         m_ForwardToFirstResponseDelayHist[i]->reset();
         m_FirstResponseToCompletionDelayHist[i]->reset();
     }
+
+    RubyPort::postResetStats();
 }
 
 void
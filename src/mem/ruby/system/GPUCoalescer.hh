@@ -245,7 +245,7 @@ class GPUCoalescer : public RubyPort
     void printRequestTable(std::stringstream& ss);
 
     void printProgress(std::ostream& out) const;
-    void resetStats() override;
+    void postResetStats() override;
     void collateStats();
 
     // each store request needs two callbacks:
@@ -479,13 +479,10 @@ RubySystem::processRubyEvent()
 }
 
 void
-RubySystem::resetStats()
+RubySystem::postResetStats()
 {
     m_start_cycle = curCycle();
-    for (auto& network : m_networks) {
-        network->resetStats();
-    }
-    ClockedObject::resetStats();
+    ClockedObject::postResetStats();
 }
 
 #ifndef PARTIAL_FUNC_READS
@@ -91,7 +91,7 @@ class RubySystem : public ClockedObject
         ClockedObject::regStats();
     }
     void collateStats() { m_profiler->collateStats(); }
-    void resetStats() override;
+    void postResetStats() override;
 
     void memWriteback() override;
     void serialize(CheckpointOut &cp) const override;
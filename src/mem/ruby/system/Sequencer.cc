@@ -271,7 +271,7 @@ Sequencer::functionalWrite(Packet *func_pkt)
     return num_written;
 }
 
-void Sequencer::resetStats()
+void Sequencer::postResetStats()
 {
     m_outstandReqHist.reset();
     m_latencyHist.reset();
@@ -298,6 +298,8 @@ void Sequencer::resetStats()
 
         m_IncompleteTimes[i] = 0;
     }
+
+    RubyPort::postResetStats();
 }
 
 // Insert the request in the request table. Return RequestStatus_Aliased
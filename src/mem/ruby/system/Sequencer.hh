@@ -99,7 +99,7 @@ class Sequencer : public RubyPort
 
     // Public Methods
     virtual void wakeup(); // Used only for deadlock detection
-    void resetStats() override;
+    void postResetStats() override;
     void collateStats();
 
     void writeCallback(Addr address,
@@ -0,0 +1,497 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/shm_bridge.hh"
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <thread>
+
+#include "base/cast.hh"
+#include "base/logging.hh"
+#include "base/pollevent.hh"
+#include "base/trace.hh"
+#include "debug/ShmBridge.hh"
+#include "mem/shared_memory_server.hh"
+#include "sim/core.hh"
+#include "sim/sim_exit.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+namespace memory
+{
+
+ShmLink::ShmLink(SimObject &owner, const std::string &channel,
+                 ShmChannel::Side side, std::size_t entries, Tick quantum,
+                 Tick latency, RecvCallback recv, RetryCallback retry)
+    : statistics::Group(&owner),
+      latency(latency), owner(owner),
+      channel(channel, side, entries, quantum), quantum(quantum),
+      recv(std::move(recv)), retry(std::move(retry)),
+      syncEvent([this]{ sync(); }, owner.name() + ".sync", false,
+                Event::Sim_Exit_Pri),
+      ADD_STAT(syncs, statistics::units::Count::get(),
+               "Number of synchronisations with the peer"),
+      ADD_STAT(waitSeconds, statistics::units::Second::get(),
+               "Host seconds spent waiting for the peer"),
+      ADD_STAT(recordsSent, statistics::units::Count::get(),
+               "Number of packets sent to the peer"),
+      ADD_STAT(recordsReceived, statistics::units::Count::get(),
+               "Number of packets received from the peer"),
+      ADD_STAT(ringFull, statistics::units::Count::get(),
+               "Number of packets refused because the ring was full")
+{
+    fatal_if(quantum == 0, "%s: The quantum must not be zero", owner.name());
+    fatal_if(latency < quantum,
+             "%s: The latency (%d) must be at least one quantum (%d)",
+             owner.name(), latency, quantum);
+
+    // The server creates the channel right away, so that the clients
+    // can attach to it as soon as they start up.
+    if (side == ShmChannel::Server)
+        this->channel.open();
+
+    registerExitCallback([this]() { this->channel.close(); });
+}
+
+void
+ShmLink::startup()
+{
+    if (!channel.isOpen()) {
+        inform("%s: waiting for shared memory channel %s", owner.name(),
+               channel.name());
+        while (!channel.open())
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    owner.schedule(syncEvent, curTick() - curTick() % quantum + quantum);
+}
+
+bool
+ShmLink::send(ShmChannel::Record &rec)
+{
+    rec.sendTick = curTick();
+    rec.deliverTick = curTick() + latency;
+    if (!channel.push(rec)) {
+        ++ringFull;
+        return false;
+    }
+    ++recordsSent;
+    return true;
+}
+
+bool
+ShmLink::waitForPeer(Tick tick)
+{
+    const auto start = std::chrono::steady_clock::now();
+    unsigned spins = 0;
+    while (channel.peerTick() < tick) {
+        if (channel.peerClosed())
+            return false;
+        // Keep serving the poll queue while blocked, since the peer may
+        // be waiting for us to answer on a socket, e.g. to map memory.
+        if (++spins % 1024 == 0) {
+            pollQueue.service();
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    const std::chrono::duration<double> waited =
+        std::chrono::steady_clock::now() - start;
+    waitSeconds += waited.count();
+    return true;
+}
+
+void
+ShmLink::sync()
+{
+    const Tick now = curTick();
+    ++syncs;
+
+    channel.publish(now);
+    const bool peer_alive = waitForPeer(now);
+
+    recordsReceived += channel.consume(now,
+        [this](const ShmChannel::Record &rec) {
+            DPRINTFS(ShmBridge, (&owner), "Received %s addr %#x size %d "
+                     "tag %d, due at %d\n", MemCmd(int(rec.cmd)).toString(),
+                     rec.addr, rec.size, rec.tag, rec.deliverTick);
+            recv(rec);
+        });
+
+    if (!peer_alive) {
+        exitSimLoop(owner.name() + ": shared memory peer exited");
+        return;
+    }
+
+    retry();
+    owner.schedule(syncEvent, now + quantum);
+}
+
+ShmBridgeClient::ShmBridgeClient(const Params &p)
+    : AbstractMemory(p),
+      respQueue(*this, port),
+      port(name() + ".port", *this),
+      shmServerPath(p.shm_server_path),
+      link(*this, p.channel, ShmChannel::Client, p.ring_entries, p.quantum,
+           p.latency,
+           [this](const ShmChannel::Record &rec) { recvResponse(rec); },
+           [this]() { retryRequest(); })
+{
+}
+
+ShmBridgeClient::~ShmBridgeClient()
+{
+    if (sharedMem)
+        munmap(sharedMem, range.size());
+}
+
+Port &
+ShmBridgeClient::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name != "port") {
+        return AbstractMemory::getPort(if_name, idx);
+    } else {
+        return port;
+    }
+}
+
+void
+ShmBridgeClient::init()
+{
+    AbstractMemory::init();
+
+    // Map the memory before any initial state is written to it.
+    mapMemory();
+
+    if (port.isConnected()) {
+        port.sendRangeChange();
+    }
+}
+
+void
+ShmBridgeClient::startup()
+{
+    AbstractMemory::startup();
+    link.startup();
+}
+
+void
+ShmBridgeClient::mapMemory()
+{
+    fatal_if(range.interleaved(), "%s: Cannot share interleaved range %s",
+             name(), range.to_string());
+
+    sockaddr_un addr = {};
+    addr.sun_family = AF_UNIX;
+    socklen_t addr_len;
+    fatal_if(shmServerPath.empty() ||
+             shmServerPath.size() >= sizeof(addr.sun_path),
+             "%s: Invalid socket path '%s'", name(), shmServerPath);
+    if (shmServerPath[0] == '@') {
+        // Abstract socket, as in SharedMemoryServer.
+        std::memcpy(&addr.sun_path[1], shmServerPath.data() + 1,
+                    shmServerPath.size() - 1);
+        addr_len = offsetof(sockaddr_un, sun_path) + shmServerPath.size();
+    } else {
+        std::memcpy(addr.sun_path, shmServerPath.data(),
+                    shmServerPath.size());
+        addr_len = sizeof(addr);
+    }
+
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    fatal_if(sock < 0, "%s: Cannot create socket: %s", name(),
+             strerror(errno));
+
+    // The server process may still be starting up.
+    inform("%s: connecting to %s", name(), shmServerPath);
+    while (connect(sock, reinterpret_cast<sockaddr *>(&addr),
+                   addr_len) != 0) {
+        fatal_if(errno != ENOENT && errno != ECONNREFUSED,
+                 "%s: Cannot connect to %s: %s", name(), shmServerPath,
+                 strerror(errno));
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // Same protocol as SharedMemoryServer::ClientSocketEvent.
+    const auto req_type = SharedMemoryServer::RequestType::kGetPhysRange;
+    struct
+    {
+        uint64_t start;
+        uint64_t end;
+    } request = {range.start(), range.end()};
+    fatal_if(send(sock, &req_type, sizeof(req_type), 0) !=
+             sizeof(req_type) ||
+             send(sock, &request, sizeof(request), 0) != sizeof(request),
+             "%s: Cannot send request to %s: %s", name(), shmServerPath,
+             strerror(errno));
+
+    struct
+    {
+        off_t offset;
+    } response;
+    iovec ios = {.iov_base = &response, .iov_len = sizeof(response)};
+    union
+    {
+        char buf[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr align;
+    } cmsgs;
+    msghdr msg = {};
+    msg.msg_iov = &ios;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cmsgs.buf;
+    msg.msg_controllen = sizeof(cmsgs.buf);
+
+    ssize_t retv;
+    do {
+        retv = recvmsg(sock, &msg, 0);
+    } while (retv < 0 && errno == EINTR);
+    close(sock);
+
+    cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    fatal_if(retv != sizeof(response) || !cmsg ||
+             cmsg->cmsg_type != SCM_RIGHTS,
+             "%s: %s did not share memory for %s", name(), shmServerPath,
+             range.to_string());
+    int shm_fd;
+    std::memcpy(&shm_fd, CMSG_DATA(cmsg), sizeof(shm_fd));
+
+    void *host = mmap(nullptr, range.size(), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, shm_fd, response.offset);
+    close(shm_fd);
+    fatal_if(host == MAP_FAILED, "%s: Cannot map %s: %s", name(),
+             range.to_string(), strerror(errno));
+
+    inform("%s: mapped %s from %s", name(), range.to_string(),
+           shmServerPath);
+    sharedMem = static_cast<uint8_t *>(host);
+    setBackingStore(sharedMem);
+}
+
+bool
+ShmBridgeClient::recvTimingReq(PacketPtr pkt)
+{
+    // Another cache is responding, so there is nothing to do but to
+    // delete the packet once the sender is done with it.
+    if (pkt->cacheResponding()) {
+        pendingDelete.reset(pkt);
+        return true;
+    }
+
+    fatal_if(pkt->isAtomicOp(), "%s: Atomic memory operations cannot "
+             "cross a shared memory bridge", name());
+    fatal_if(pkt->getSize() > ShmChannel::MaxData,
+             "%s: %d byte packet exceeds the %d byte record payload",
+             name(), pkt->getSize(), ShmChannel::MaxData);
+
+    // Keep the order of the refused requests.
+    if (retryReq)
+        return false;
+
+    ShmChannel::Record rec;
+    rec.tag = nextTag;
+    rec.addr = pkt->getAddr();
+    rec.flags = pkt->req->getFlags();
+    rec.cmd = pkt->cmd.toInt();
+    rec.size = pkt->getSize();
+    if (pkt->hasData())
+        pkt->writeData(rec.data);
+
+    if (!link.send(rec)) {
+        retryReq = true;
+        return false;
+    }
+
+    DPRINTF(ShmBridge, "Sent %s tag %d\n", pkt->print(), rec.tag);
+    if (pkt->needsResponse())
+        outstanding[nextTag++] = pkt;
+    else
+        pendingDelete.reset(pkt);
+    return true;
+}
+
+void
+ShmBridgeClient::recvResponse(const ShmChannel::Record &rec)
+{
+    auto it = outstanding.find(rec.tag);
+    panic_if(it == outstanding.end(), "%s: Response with unknown tag %d",
+             name(), rec.tag);
+    PacketPtr pkt = it->second;
+    outstanding.erase(it);
+
+    pkt->makeResponse();
+    if (pkt->hasData())
+        pkt->setData(rec.data);
+    pkt->headerDelay = pkt->payloadDelay = 0;
+    port.schedTimingResp(pkt, rec.deliverTick);
+}
+
+void
+ShmBridgeClient::retryRequest()
+{
+    if (retryReq && !link.full()) {
+        retryReq = false;
+        port.sendRetryReq();
+    }
+}
+
+ShmBridgeClient::MemoryPort::MemoryPort(const std::string &name,
+                                        ShmBridgeClient &bridge)
+    : QueuedResponsePort(name, bridge.respQueue), bridge(bridge)
+{
+}
+
+AddrRangeList
+ShmBridgeClient::MemoryPort::getAddrRanges() const
+{
+    AddrRangeList ranges;
+    ranges.push_back(bridge.getAddrRange());
+    return ranges;
+}
+
+bool
+ShmBridgeClient::MemoryPort::recvTimingReq(PacketPtr pkt)
+{
+    return bridge.recvTimingReq(pkt);
+}
+
+Tick
+ShmBridgeClient::MemoryPort::recvAtomic(PacketPtr pkt)
+{
+    bridge.access(pkt);
+    return bridge.link.latency;
+}
+
+void
+ShmBridgeClient::MemoryPort::recvFunctional(PacketPtr pkt)
+{
+    bridge.functionalAccess(pkt);
+}
+
+ShmBridgeServer::ShmBridgeServer(const Params &p)
+    : SimObject(p),
+      reqQueue(*this, memSidePort),
+      snoopRespQueue(*this, memSidePort),
+      memSidePort(name() + ".mem_side", *this),
+      link(*this, p.channel, ShmChannel::Server, p.ring_entries, p.quantum,
+           p.latency,
+           [this](const ShmChannel::Record &rec) { recvRequest(rec); },
+           [this]() { retryResponse(); }),
+      requestorId(p.system->getRequestorId(this))
+{
+}
+
+Port &
+ShmBridgeServer::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "mem_side")
+        return memSidePort;
+    return SimObject::getPort(if_name, idx);
+}
+
+void
+ShmBridgeServer::startup()
+{
+    link.startup();
+}
+
+void
+ShmBridgeServer::recvRequest(const ShmChannel::Record &rec)
+{
+    auto req = std::make_shared<Request>(rec.addr, rec.size,
+                                         Request::Flags(rec.flags),
+                                         requestorId);
+    PacketPtr pkt = new Packet(req, MemCmd(int(rec.cmd)));
+    pkt->allocate();
+    if (pkt->hasData())
+        pkt->setData(rec.data);
+    if (pkt->needsResponse())
+        pkt->pushSenderState(new TagState(rec.tag));
+    memSidePort.schedTimingReq(pkt, rec.deliverTick);
+}
+
+bool
+ShmBridgeServer::recvTimingResp(PacketPtr pkt)
+{
+    if (retryResp || link.full()) {
+        retryResp = true;
+        return false;
+    }
+
+    auto *state = safe_cast<TagState *>(pkt->popSenderState());
+    ShmChannel::Record rec;
+    rec.tag = state->tag;
+    rec.addr = pkt->getAddr();
+    rec.flags = pkt->req->getFlags();
+    rec.cmd = pkt->cmd.toInt();
+    rec.size = pkt->getSize();
+    if (pkt->hasData())
+        pkt->writeData(rec.data);
+
+    [[maybe_unused]] const bool sent = link.send(rec);
+    assert(sent);
+
+    delete state;
+    delete pkt;
+    return true;
+}
+
+void
+ShmBridgeServer::retryResponse()
+{
+    if (retryResp && !link.full()) {
+        retryResp = false;
+        memSidePort.sendRetryResp();
+    }
+}
+
+ShmBridgeServer::MemSidePort::MemSidePort(const std::string &name,
+                                          ShmBridgeServer &bridge)
+    : QueuedRequestPort(name, bridge.reqQueue, bridge.snoopRespQueue),
+      bridge(bridge)
+{
+}
+
+bool
+ShmBridgeServer::MemSidePort::recvTimingResp(PacketPtr pkt)
+{
+    return bridge.recvTimingResp(pkt);
+}
+
+} // namespace memory
+} // namespace gem5
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Bridges splitting a simulation across gem5 processes on the same host.
+ *
+ * The memory-side components run in one process, behind a
+ * ShmBridgeServer, and the CPU clusters run in other processes, each
+ * behind a ShmBridgeClient. Every client-server pair shares a
+ * ShmChannel carrying the timing requests and responses, and the two
+ * processes advance in lockstep quanta in the style of dist-gem5: at
+ * each quantum boundary a process publishes its tick, waits for the
+ * peer to reach the same tick, and then schedules the packets the peer
+ * sent during the previous quantum. As the link latency is at least
+ * one quantum, none of these packets is due before the boundary.
+ *
+ * Functional and atomic accesses do not cross the channel. Instead the
+ * client maps the memory of the server process, as exported by its
+ * SharedMemoryServer, and accesses it directly, bypassing any caches in
+ * the server process. Snoops do not cross the channel either, so caches
+ * on the two sides are not kept coherent. See ShmBridge.py.
+ */
+
+#ifndef __MEM_SHM_BRIDGE_HH__
+#define __MEM_SHM_BRIDGE_HH__
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "base/statistics.hh"
+#include "mem/abstract_mem.hh"
+#include "mem/packet.hh"
+#include "mem/qport.hh"
+#include "mem/shm_channel.hh"
+#include "params/ShmBridgeClient.hh"
+#include "params/ShmBridgeServer.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+namespace memory
+{
+
+/**
+ * One end of a shared memory link, synchronising the process it is in
+ * with the peer process at every quantum boundary.
+ */
+class ShmLink : public statistics::Group
+{
+  public:
+    /** Called at a quantum boundary for each record sent by the peer. */
+    using RecvCallback = std::function<void(const ShmChannel::Record &)>;
+    /** Called after each synchronisation, once the peer made room. */
+    using RetryCallback = std::function<void()>;
+
+    ShmLink(SimObject &owner, const std::string &channel,
+            ShmChannel::Side side, std::size_t entries, Tick quantum,
+            Tick latency, RecvCallback recv, RetryCallback retry);
+
+    /** Attach to the channel and schedule the first synchronisation. */
+    void startup();
+
+    /**
+     * Stamp a record with the send and delivery ticks and push it to
+     * the peer.
+     *
+     * @return false if the outgoing ring is full.
+     */
+    bool send(ShmChannel::Record &rec);
+
+    bool full() const { return channel.full(); }
+
+    /** Link latency, at least one quantum. */
+    const Tick latency;
+
+  private:
+    /** Synchronise with the peer at a quantum boundary. */
+    void sync();
+
+    /**
+     * Wait for the peer to reach a tick.
+     *
+     * @return false if the peer exited before reaching it.
+     */
+    bool waitForPeer(Tick tick);
+
+    SimObject &owner;
+    ShmChannel channel;
+    const Tick quantum;
+
+    RecvCallback recv;
+    RetryCallback retry;
+
+    EventFunctionWrapper syncEvent;
+
+    statistics::Scalar syncs;
+    statistics::Scalar waitSeconds;
+    statistics::Scalar recordsSent;
+    statistics::Scalar recordsReceived;
+    statistics::Scalar ringFull;
+};
+
+/**
+ * The CPU side of a shared memory bridge. It is the memory of the
+ * process it is in, backed by the memory of the server process.
+ */
+class ShmBridgeClient : public AbstractMemory
+{
+  public:
+    PARAMS(ShmBridgeClient);
+    ShmBridgeClient(const Params &p);
+    ~ShmBridgeClient();
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx = InvalidPortID) override;
+
+    void init() override;
+    void startup() override;
+
+  private:
+    class MemoryPort : public QueuedResponsePort
+    {
+      public:
+        MemoryPort(const std::string &name, ShmBridgeClient &bridge);
+
+      protected:
+        bool recvTimingReq(PacketPtr pkt) override;
+        Tick recvAtomic(PacketPtr pkt) override;
+        void recvFunctional(PacketPtr pkt) override;
+        AddrRangeList getAddrRanges() const override;
+
+      private:
+        ShmBridgeClient &bridge;
+    };
+
+    /**
+     * Map the memory of the server in place of the local backing
+     * store, by asking its SharedMemoryServer for our range.
+     */
+    void mapMemory();
+
+    bool recvTimingReq(PacketPtr pkt);
+    void recvResponse(const ShmChannel::Record &rec);
+    void retryRequest();
+
+    RespPacketQueue respQueue;
+    MemoryPort port;
+
+    const std::string shmServerPath;
+
+    ShmLink link;
+
+    uint8_t *sharedMem = nullptr;
+
+    /** Requests waiting for a response, by tag. */
+    std::unordered_map<uint64_t, PacketPtr> outstanding;
+    uint64_t nextTag = 0;
+
+    /** Whether a request was refused because the ring was full. */
+    bool retryReq = false;
+
+    /** Sunk packets are deleted once the sender is done with them. */
+    std::unique_ptr<Packet> pendingDelete;
+};
+
+/**
+ * The memory side of a shared memory bridge, issuing the requests of a
+ * client process to the memory system of the process it is in.
+ */
+class ShmBridgeServer : public SimObject
+{
+  public:
+    PARAMS(ShmBridgeServer);
+    ShmBridgeServer(const Params &p);
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx = InvalidPortID) override;
+
+    void startup() override;
+
+  private:
+    class MemSidePort : public QueuedRequestPort
+    {
+      public:
+        MemSidePort(const std::string &name, ShmBridgeServer &bridge);
+
+      protected:
+        bool recvTimingResp(PacketPtr pkt) override;
+        void recvRangeChange() override {}
+
+      private:
+        ShmBridgeServer &bridge;
+    };
+
+    /** Remembers the client tag of a request in flight. */
+    struct TagState : public Packet::SenderState
+    {
+        TagState(uint64_t tag) : tag(tag) {}
+        const uint64_t tag;
+    };
+
+    void recvRequest(const ShmChannel::Record &rec);
+    bool recvTimingResp(PacketPtr pkt);
+    void retryResponse();
+
+    ReqPacketQueue reqQueue;
+    SnoopRespPacketQueue snoopRespQueue;
+    MemSidePort memSidePort;
+
+    ShmLink link;
+
+    /**
+     * Requestor of all the requests from the client, as the requestor
+     * IDs of the client process mean nothing in this one.
+     */
+    const RequestorID requestorId;
+
+    /** Whether a response was refused because the ring was full. */
+    bool retryResp = false;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_SHM_BRIDGE_HH__
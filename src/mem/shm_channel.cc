@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/shm_channel.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+namespace memory
+{
+
+namespace
+{
+
+std::string
+shmObjectName(const std::string &name)
+{
+    fatal_if(name.empty(), "Empty shared memory channel name");
+    return name[0] == '/' ? name : "/" + name;
+}
+
+} // anonymous namespace
+
+ShmChannel::ShmChannel(const std::string &name, Side side,
+                       std::size_t entries, Tick quantum)
+    : shmName(shmObjectName(name)), side(side),
+      mask((uint64_t(1) << ceilLog2(entries ? entries : 1)) - 1),
+      quantum(quantum)
+{
+}
+
+ShmChannel::~ShmChannel()
+{
+    if (!mapping)
+        return;
+    close();
+    munmap(mapping, segmentBytes());
+    if (side == Server)
+        shm_unlink(shmName.c_str());
+}
+
+std::size_t
+ShmChannel::ringBytes() const
+{
+    return roundUp(sizeof(Ring) + capacity() * sizeof(Record), CacheLineSize);
+}
+
+std::size_t
+ShmChannel::segmentBytes() const
+{
+    return sizeof(Header) + 2 * ringBytes();
+}
+
+void
+ShmChannel::attach(void *base)
+{
+    mapping = base;
+    uint8_t *ptr = static_cast<uint8_t *>(base);
+    header = reinterpret_cast<Header *>(ptr);
+    ptr += sizeof(Header);
+    for (int i = 0; i < 2; ++i) {
+        rings[i] = reinterpret_cast<Ring *>(ptr);
+        records[i] = reinterpret_cast<Record *>(ptr + sizeof(Ring));
+        ptr += ringBytes();
+    }
+}
+
+bool
+ShmChannel::open()
+{
+    if (isOpen())
+        return true;
+
+    const std::size_t size = segmentBytes();
+
+    if (side == Server) {
+        // Remove any segment left behind by a previous run that did not
+        // shut down cleanly.
+        shm_unlink(shmName.c_str());
+        int fd = shm_open(shmName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        fatal_if(fd < 0, "Cannot create shared memory channel %s: %s",
+                 shmName, strerror(errno));
+        fatal_if(ftruncate(fd, size) != 0,
+                 "Cannot size shared memory channel %s: %s",
+                 shmName, strerror(errno));
+        void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                          MAP_SHARED, fd, 0);
+        ::close(fd);
+        fatal_if(base == MAP_FAILED, "Cannot map shared memory channel %s: %s",
+                 shmName, strerror(errno));
+
+        auto *hdr = new (base) Header();
+        hdr->version = Version;
+        hdr->recordSize = sizeof(Record);
+        hdr->entries = capacity();
+        hdr->quantum = quantum;
+        for (auto &state : hdr->sides) {
+            state.tick.store(0, std::memory_order_relaxed);
+            state.closed.store(0, std::memory_order_relaxed);
+        }
+        attach(base);
+        for (auto *ring : rings) {
+            new (ring) Ring();
+            ring->head.store(0, std::memory_order_relaxed);
+            ring->tail.store(0, std::memory_order_relaxed);
+        }
+        hdr->magic.store(Magic, std::memory_order_release);
+        return true;
+    }
+
+    int fd = shm_open(shmName.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        fatal_if(errno != ENOENT, "Cannot open shared memory channel %s: %s",
+                 shmName, strerror(errno));
+        return false;
+    }
+
+    // The server may not have sized the segment yet.
+    struct stat st;
+    if (fstat(fd, &st) != 0 || std::size_t(st.st_size) < sizeof(Header)) {
+        ::close(fd);
+        return false;
+    }
+
+    void *base = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+    ::close(fd);
+    fatal_if(base == MAP_FAILED, "Cannot map shared memory channel %s: %s",
+             shmName, strerror(errno));
+
+    auto *hdr = static_cast<Header *>(base);
+    if (hdr->magic.load(std::memory_order_acquire) != Magic) {
+        munmap(base, st.st_size);
+        return false;
+    }
+
+    fatal_if(hdr->version != Version || hdr->recordSize != sizeof(Record),
+             "Shared memory channel %s was created by an incompatible "
+             "gem5 binary", shmName);
+    fatal_if(hdr->entries != capacity() || hdr->quantum != quantum ||
+             std::size_t(st.st_size) != size,
+             "Shared memory channel %s is configured with %d entries and a "
+             "quantum of %d ticks, but this side expects %d and %d",
+             shmName, hdr->entries, hdr->quantum, capacity(), quantum);
+
+    attach(base);
+    return true;
+}
+
+bool
+ShmChannel::push(const Record &rec)
+{
+    Ring &ring = *rings[side];
+    const uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    if (tail - ring.head.load(std::memory_order_acquire) > mask)
+        return false;
+    records[side][tail & mask] = rec;
+    ring.tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool
+ShmChannel::full() const
+{
+    const Ring &ring = *rings[side];
+    return ring.tail.load(std::memory_order_relaxed) -
+        ring.head.load(std::memory_order_acquire) > mask;
+}
+
+void
+ShmChannel::publish(Tick tick)
+{
+    header->sides[side].tick.store(tick, std::memory_order_release);
+}
+
+Tick
+ShmChannel::peerTick() const
+{
+    return header->sides[peer()].tick.load(std::memory_order_acquire);
+}
+
+void
+ShmChannel::close()
+{
+    if (header)
+        header->sides[side].closed.store(1, std::memory_order_release);
+}
+
+bool
+ShmChannel::peerClosed() const
+{
+    return header->sides[peer()].closed.load(std::memory_order_acquire);
+}
+
+} // namespace memory
+} // namespace gem5
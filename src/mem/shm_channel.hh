@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_SHM_CHANNEL_HH__
+#define __MEM_SHM_CHANNEL_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+namespace memory
+{
+
+/**
+ * A bidirectional packet channel between two gem5 processes running on
+ * the same host, backed by a POSIX shared memory segment.
+ *
+ * The segment holds a small header and two single-producer,
+ * single-consumer rings of fixed-size records, one per direction. The
+ * server side creates the segment and the client side attaches to it
+ * once it exists. Besides the rings, each side publishes the tick it
+ * has reached, which the bridges use to run the two processes in
+ * lockstep quanta.
+ *
+ * Records are stamped with the tick at which they were sent, and a
+ * receiver only consumes records sent before a given tick. Which
+ * records get delivered at a quantum boundary therefore does not depend
+ * on how far ahead the peer process happens to be.
+ */
+class ShmChannel
+{
+  public:
+    enum Side
+    {
+        Server = 0,
+        Client = 1,
+    };
+
+    /** Largest packet payload that fits in a single record. */
+    static constexpr std::size_t MaxData = 256;
+
+    struct Record
+    {
+        /** Tick at which the sender pushed the record. */
+        Tick sendTick;
+        /** Tick at which the receiver should act on the record. */
+        Tick deliverTick;
+        /** Opaque identifier used to match responses to requests. */
+        uint64_t tag;
+        uint64_t addr;
+        uint64_t flags;
+        uint32_t cmd;
+        uint32_t size;
+        uint8_t data[MaxData];
+    };
+
+    /**
+     * @param name Name of the shared memory object, with or without the
+     *             leading '/'.
+     * @param side Which end of the channel this process is.
+     * @param entries Minimum number of records per ring; rounded up to
+     *                the next power of two.
+     * @param quantum Synchronisation quantum, checked against the peer.
+     */
+    ShmChannel(const std::string &name, Side side, std::size_t entries,
+               Tick quantum);
+    ~ShmChannel();
+
+    ShmChannel(const ShmChannel &) = delete;
+    ShmChannel &operator=(const ShmChannel &) = delete;
+
+    /**
+     * Map the shared segment. The server creates it, replacing any
+     * stale segment of the same name, and always succeeds. The client
+     * returns false if the server has not finished creating it yet.
+     */
+    bool open();
+
+    bool isOpen() const { return header != nullptr; }
+
+    const std::string &name() const { return shmName; }
+
+    /**
+     * Push a record to the outgoing ring.
+     *
+     * @return false if the ring is full.
+     */
+    bool push(const Record &rec);
+
+    /** Check whether the outgoing ring has room for another record. */
+    bool full() const;
+
+    /**
+     * Pop the incoming records sent strictly before a given tick, in
+     * order, and hand them to a callback.
+     *
+     * @return The number of records consumed.
+     */
+    template <typename F>
+    std::size_t
+    consume(Tick before, F &&func)
+    {
+        Ring &ring = *rings[peer()];
+        uint64_t head = ring.head.load(std::memory_order_relaxed);
+        const uint64_t tail = ring.tail.load(std::memory_order_acquire);
+        std::size_t count = 0;
+        for (; head != tail; ++head, ++count) {
+            const Record &rec = records[peer()][head & mask];
+            if (rec.sendTick >= before)
+                break;
+            func(rec);
+        }
+        ring.head.store(head, std::memory_order_release);
+        return count;
+    }
+
+    /** Publish the tick this side has reached. */
+    void publish(Tick tick);
+
+    /** The tick last published by the peer. */
+    Tick peerTick() const;
+
+    /** Mark this side as finished so that the peer stops waiting. */
+    void close();
+
+    bool peerClosed() const;
+
+    std::size_t capacity() const { return mask + 1; }
+
+  private:
+    static constexpr uint64_t Magic = 0x67656d3573686d31ULL;
+    static constexpr uint32_t Version = 1;
+    static constexpr std::size_t CacheLineSize = 64;
+
+    struct alignas(CacheLineSize) SideState
+    {
+        std::atomic<Tick> tick;
+        std::atomic<uint32_t> closed;
+    };
+
+    struct Header
+    {
+        /** Written last by the server once the segment is ready. */
+        std::atomic<uint64_t> magic;
+        uint32_t version;
+        uint32_t recordSize;
+        uint64_t entries;
+        Tick quantum;
+        SideState sides[2];
+    };
+
+    struct Ring
+    {
+        /** Index of the next record to pop, written by the consumer. */
+        alignas(CacheLineSize) std::atomic<uint64_t> head;
+        /** Index of the next slot to push to, written by the producer. */
+        alignas(CacheLineSize) std::atomic<uint64_t> tail;
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                  "Shared memory rings need address-free atomics");
+
+    Side peer() const { return side == Server ? Client : Server; }
+
+    std::size_t ringBytes() const;
+    std::size_t segmentBytes() const;
+
+    /** Set up the pointers into a freshly mapped segment. */
+    void attach(void *base);
+
+    const std::string shmName;
+    const Side side;
+    const uint64_t mask;
+    const Tick quantum;
+
+    void *mapping = nullptr;
+    Header *header = nullptr;
+    /** Rings and record arrays, indexed by the side that produces them. */
+    Ring *rings[2] = {};
+    Record *records[2] = {};
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_SHM_CHANNEL_HH__
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "mem/shm_channel.hh"
+
+using namespace gem5;
+using namespace gem5::memory;
+
+namespace
+{
+
+std::string
+channelName()
+{
+    return "gem5_shm_channel_test_" + std::to_string(getpid());
+}
+
+ShmChannel::Record
+makeRecord(Tick send_tick, uint64_t tag)
+{
+    ShmChannel::Record rec = {};
+    rec.sendTick = send_tick;
+    rec.deliverTick = send_tick + 1000;
+    rec.tag = tag;
+    return rec;
+}
+
+} // anonymous namespace
+
+/** A client cannot attach before the server has created the segment. */
+TEST(ShmChannelTest, ClientWaitsForServer)
+{
+    const std::string name = channelName();
+    ShmChannel client(name, ShmChannel::Client, 4, 1000);
+    EXPECT_FALSE(client.open());
+    EXPECT_FALSE(client.isOpen());
+
+    ShmChannel server(name, ShmChannel::Server, 4, 1000);
+    ASSERT_TRUE(server.open());
+    EXPECT_TRUE(client.open());
+}
+
+/** Records flow in both directions, in order. */
+TEST(ShmChannelTest, PushConsume)
+{
+    const std::string name = channelName();
+    ShmChannel server(name, ShmChannel::Server, 4, 1000);
+    ASSERT_TRUE(server.open());
+    ShmChannel client(name, ShmChannel::Client, 4, 1000);
+    ASSERT_TRUE(client.open());
+
+    for (uint64_t i = 0; i < 3; ++i)
+        ASSERT_TRUE(client.push(makeRecord(i, i)));
+    ASSERT_TRUE(server.push(makeRecord(0, 42)));
+
+    std::vector<uint64_t> tags;
+    auto collect = [&](const ShmChannel::Record &rec) {
+        tags.push_back(rec.tag);
+    };
+    EXPECT_EQ(server.consume(MaxTick, collect), 3);
+    EXPECT_EQ(tags, std::vector<uint64_t>({0, 1, 2}));
+
+    tags.clear();
+    EXPECT_EQ(client.consume(MaxTick, collect), 1);
+    EXPECT_EQ(tags, std::vector<uint64_t>({42}));
+}
+
+/** Only records sent before the requested tick are consumed. */
+TEST(ShmChannelTest, ConsumeBefore)
+{
+    const std::string name = channelName();
+    ShmChannel server(name, ShmChannel::Server, 8, 1000);
+    ASSERT_TRUE(server.open());
+    ShmChannel client(name, ShmChannel::Client, 8, 1000);
+    ASSERT_TRUE(client.open());
+
+    for (Tick t : {100, 999, 1000, 1500})
+        ASSERT_TRUE(client.push(makeRecord(t, t)));
+
+    std::vector<uint64_t> tags;
+    auto collect = [&](const ShmChannel::Record &rec) {
+        tags.push_back(rec.tag);
+    };
+    EXPECT_EQ(server.consume(1000, collect), 2);
+    EXPECT_EQ(tags, std::vector<uint64_t>({100, 999}));
+    EXPECT_EQ(server.consume(2000, collect), 2);
+    EXPECT_EQ(tags, std::vector<uint64_t>({100, 999, 1000, 1500}));
+}
+
+/** The ring refuses records once full and accepts them again once drained. */
+TEST(ShmChannelTest, Full)
+{
+    const std::string name = channelName();
+    ShmChannel server(name, ShmChannel::Server, 3, 1000);
+    ASSERT_TRUE(server.open());
+    ShmChannel client(name, ShmChannel::Client, 3, 1000);
+    ASSERT_TRUE(client.open());
+    ASSERT_EQ(client.capacity(), 4);
+
+    for (uint64_t i = 0; i < 4; ++i)
+        ASSERT_TRUE(client.push(makeRecord(i, i)));
+    EXPECT_TRUE(client.full());
+    EXPECT_FALSE(client.push(makeRecord(4, 4)));
+
+    EXPECT_EQ(server.consume(2, [](const ShmChannel::Record &) {}), 2);
+    EXPECT_FALSE(client.full());
+    EXPECT_TRUE(client.push(makeRecord(4, 4)));
+}
+
+/** Each side sees the tick and the closed flag published by the other. */
+TEST(ShmChannelTest, Synchronisation)
+{
+    const std::string name = channelName();
+    ShmChannel server(name, ShmChannel::Server, 4, 1000);
+    ASSERT_TRUE(server.open());
+    ShmChannel client(name, ShmChannel::Client, 4, 1000);
+    ASSERT_TRUE(client.open());
+
+    EXPECT_EQ(server.peerTick(), 0);
+    client.publish(3000);
+    server.publish(2000);
+    EXPECT_EQ(server.peerTick(), 3000);
+    EXPECT_EQ(client.peerTick(), 2000);
+
+    EXPECT_FALSE(server.peerClosed());
+    client.close();
+    EXPECT_TRUE(server.peerClosed());
+    EXPECT_FALSE(client.peerClosed());
+}
+
+/** Both sides must agree on the channel configuration. */
+TEST(ShmChannelTest, MismatchedQuantum)
+{
+    const std::string name = channelName();
+    ShmChannel server(name, ShmChannel::Server, 4, 1000);
+    ASSERT_TRUE(server.open());
+    ShmChannel client(name, ShmChannel::Client, 4, 2000);
+    ASSERT_ANY_THROW(client.open());
+}
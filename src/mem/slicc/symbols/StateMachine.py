@@ -350,7 +350,7 @@ class $c_ident : public AbstractController
 
     void print(std::ostream& out) const;
     void wakeup();
-    void resetStats();
+    void postResetStats() override;
     void regStats();
     void collateStats();
 
@@ -1105,7 +1105,7 @@ $c_ident::print(std::ostream& out) const
     out << "[$c_ident " << m_version << "]";
 }
 
-void $c_ident::resetStats()
+void $c_ident::postResetStats()
 {
     for (int state = 0; state < ${ident}_State_NUM; state++) {
         for (int event = 0; event < ${ident}_Event_NUM; event++) {
@@ -1117,7 +1117,7 @@ void $c_ident::resetStats()
         m_event_counters[event] = 0;
     }
 
-    AbstractController::resetStats();
+    AbstractController::postResetStats();
 }
 """
         )
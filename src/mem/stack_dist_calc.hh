@@ -38,8 +38,11 @@
 #ifndef __MEM_STACK_DIST_CALC_HH__
 #define __MEM_STACK_DIST_CALC_HH__
 
+#include <cstdint>
 #include <limits>
-#include <map>
+#include <set>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "base/types.hh"
@@ -49,75 +52,49 @@ namespace gem5
 
 /**
   * The stack distance calculator is a passive object that merely
-  * observes the addresses pass to it. It calculates stack distances
-  * of incoming addresses based on the partial sum hierarchy tree
-  * algorithm described by Alamasi et al.
-  * http://doi.acm.org/10.1145/773039.773043.
+  * observes the addresses pass to it. It calculates the stack
+  * distance (the number of distinct addresses touched since the last
+  * access to the same address) of each incoming address.
   *
-  * A tree structure is maintained and updated at each transaction
-  * (unique or non-unique). The tree is implemented as an STL vector
-  * with layers of the form <map> Each layer in this tree is an
-  * ordered map <uint64_t, Node*>. Nodes are structs which take form
-  * of leaf, intermediate and root nodes. For example, in a tree with 3
-  * layers, tree[0][5] gives a leaf node pointer for key=5 tree[1][1]
-  * gives an intermediate node pointer for key=1 tree[2][0] gives the
-  * root node in the tree.
+  * Every access is given a timestamp from a monotonically increasing
+  * counter. A hash map (addrMap) holds the timestamp of the most
+  * recent access to each address, and a Fenwick (binary indexed) tree
+  * over the timestamps holds a 1 for every timestamp which is still
+  * the most recent access of its address. The stack distance of an
+  * address is then the number of live timestamps after its own, which
+  * is a prefix-sum query, and moving an address to the top of the
+  * stack is two point updates. Both take O(log n) time in the number
+  * of timestamps.
   *
-  * At every transaction a hash-map (aiMap) is looked up to check if
-  * the address was already encountered before. Based on this lookup a
-  * transaction can be termed as unique or non-unique.
+  * Timestamps of addresses which have since been accessed again are
+  * dead weight in the tree. When the timestamps run out the tree is
+  * compacted: the live timestamps are renumbered densely, preserving
+  * their order, and the tree is rebuilt in linear time. The tree is
+  * grown when more than half of it is live after compaction, so the
+  * compaction cost is amortised over at least as many accesses.
   *
   * In addition to the normal stack distance calculation, a feature to
-  * mark an old node in the tree is added. This is useful if it is
+  * mark an old entry in the stack is added. This is useful if it is
   * required to see the reuse pattern. For example, BackInvalidates
-  * from a lower level (e.g. membus to L2), can be marked (isMarked
-  * flag of Node set to True). Then later if this same address is
-  * accessed (by L1), the value of the isMarked flag would be
-  * True. This would give some insight on how the BackInvalidates
-  * policy of the lower level affect the read/write accesses in an
-  * application.
+  * from a lower level (e.g. membus to L2), can be marked. Then later
+  * if this same address is accessed (by L1), the value of the mark
+  * flag would be True. This would give some insight on how the
+  * BackInvalidates policy of the lower level affect the read/write
+  * accesses in an application.
   *
   * There are two functions provided to interface with the calculator:
   * 1. pair<uint64_t, bool> calcStackDistAndUpdate(Addr r_address,
   *                                                bool addNewNode)
-  * At every unique transaction a new leaf node is added at tree[0](leaf layer)
-  * and linked to the layer above (if addNewNode is True). The sums of all
-  * the intermediate nodes is updated till the root. The stack-distance is
-  * returned as a Constant representing INFINITY.
-  *
-  * At every non-unique transaction the tree is traversed from the
-  * leaf at the returned index to the root, the old node is deleted
-  * from the tree, and the sums (to the right are collected) and
-  * decremented. The collected sum represets the stack distance of the
-  * found node. If this node was marked then a bool flag set to True
-  * is returned with the stack_distance. During this operation a node
-  * is discarded at the leaf layer always. Moreover during the
-  * traversal upwards using the updateSum() method, if an intermediate
-  * node is found with no children connected to it, then that is
-  * discarded too.
-  *
-  * The return value of this function is a pair representing the
-  * stack_distance and the value of the marked flag.
+  * If the address has been seen before its stack distance is
+  * returned together with its mark flag, and it is removed from the
+  * stack. If addNewNode is True the address is then pushed on top of
+  * the stack, unmarked. The stack-distance of an address which has not
+  * been seen before is returned as a Constant representing INFINITY.
   *
   * 2. pair<uint64_t , bool> calcStackDist(Addr r_address, bool mark)
   * This is a stripped down version of the above function which is used to
-  * just inspect the tree, and mark a leaf node (if mark flag is set). The
-  * functionality to add a new node is removed.
-  *
-  * At every unique transaction the stack-distance is returned as a constant
-  * representing INFINITY.
-  *
-  * At every non-unique transaction the tree is traversed from the
-  * leaf at the returned index to the root, and the sums (to the right)
-  * are collected. The collected sum represets the stack distance of
-  * the found node.
-  *
-  * This function does NOT Modify the stack. (No node is added or
-  * deleted).  It is just used to mark a node already created and get
-  * its stack distance.
-  *
-  * The return value of this function is a pair representing the stack
-  * distance and the value of the marked flag.
+  * just inspect the stack, and mark an entry (if mark flag is set). It
+  * does NOT modify the stack.
   *
   * The table below depicts the usage of the Algorithm using the functions:
   * pair<uint64_t Stack_dist, bool isMarked> calcStackDistAndUpdate
@@ -151,14 +128,16 @@ namespace gem5
   * Delete Old Entry |calcStackDistAndUpdate|Writebacks/Cleanevicts|
   * Dist.of Old entry|calcStackDist         |Cleanevicts/Invalidate|
   *
-  * Node Balancing: The tree structure is maintained by an
-  * updateTree() operation called when an intermediate node is
-  * required. The update operation is roughly categorized as a root
-  * update or intermediate layer update. When number of leaf nodes
-  * grow over a power of 2 then a new layer is added at the top of the
-  * tree and a new root node is initialized. The old node at the lower
-  * layer is connected to this.  In an intermediate node update
-  * operation a new intermediate node is added to the required layer.
+  * Sampling: The calculator can optionally track only a spatially
+  * hashed subset of the addresses, as in SHARDS (Waldspurger et al.,
+  * FAST'15). An address is tracked if the hash of the address is below
+  * a threshold, giving a sampling rate R. Callers should ignore
+  * addresses for which isSampled() is false. Stack distances of
+  * sampled addresses are scaled by 1/R to estimate the distance in the
+  * full address stream. If a maximum number of entries is set, the
+  * threshold is lowered whenever it is exceeded, evicting the tracked
+  * addresses with the largest hashes, which bounds the memory used
+  * regardless of the footprint of the workload.
   *
   * Debugging: Debugging can be enabled by setting the verifyStack flag
   * true. Debugging is implemented using a dummy stack that behaves in
@@ -167,120 +146,64 @@ namespace gem5
   * Infinity. If a non unique address is encountered then the previous
   * entry in the STL vector is removed, all the entities above it are
   * pushed down, and the address is pushed at the top of the stack).
+  * Verification is only supported without sampling.
   *
   * A printStack(int numOfEntitiesToPrint) is provided to print top n entities
-  * in both (tree and STL based dummy stack).
+  * in both (Fenwick tree and STL based dummy stack).
   */
 class StackDistCalc
 {
 
   private:
 
-    struct Node;
+    /** The state of an address in the stack */
+    struct Entry
+    {
+        // Timestamp of the most recent access to the address
+        uint64_t slot;
 
-    typedef std::map<uint64_t, Node*> IndexNodeMap;
-    typedef std::map<Addr, uint64_t> AddressIndexMap;
-    typedef std::vector<IndexNodeMap> TreeType;
+        /**
+         * Flag to indicate if this address is marked. Used in case
+         * where stack distance of a touched address is required.
+         */
+        bool isMarked;
+    };
 
-    /**
-     * Gets sum from the node upwards recursively till the root.  This
-     * function is called first by getSumsLeavesToRoot, and then
-     * recursively calls itself.
-     *
-     * @param node pointer to the node which is updated
-     * @param from_left variable which says that the request arrived
-     *        from the left
-     * @param sum_from_below Sum of left and right children below
-     * @param level level in the tree the calling node is located
-     * @param stack_dist stack distance of the node below
-     * @return The stack distance of the current address.
-     *
-     */
-    uint64_t getSum(Node* node, bool from_left, uint64_t sum_from_below,
-                    uint64_t stack_dist, uint64_t level) const;
+    typedef std::unordered_map<Addr, Entry> AddressEntryMap;
 
-    /**
-     * Gets the sum from the leaf node specified. This function
-     * is called by calcStackDist.
-     *
-     * @param node pointer to the node which is updated
-     * @return The stack distance of the current address.
-     *
-     */
-    uint64_t getSumsLeavesToRoot(Node* node) const;
+    /** Add delta to the count of the given timestamp */
+    void fenwickAdd(uint64_t slot, int64_t delta);
 
-    /**
-     * Updates the nodes upwards recursively till the root.
-     * This function is first called by updateSumsLeavesToRoot,
-     * and then it recursively calls itself.
-     *
-     * @param node pointer to the node which is updated
-     * @param from_left variable which says that the request arrived
-     * from the left
-     * @param sum_from_below Sum of left and right children below
-     * @param level level in the tree the calling node is located
-     * @param stack_dist stack distance of the node below
-     * @param discard_node whether the calling node was discarded or not
-     * @return The stack distance of the current address.
-     *
-     */
-    uint64_t updateSum(Node* node,
-                       bool from_left, uint64_t sum_from_below, uint64_t level,
-                       uint64_t stack_dist, bool discard_node);
+    /** Number of live timestamps at or before the given timestamp */
+    uint64_t fenwickPrefix(uint64_t slot) const;
 
-    /**
-     * Updates the leaf nodes and nodes above. This function is
-     * called by the calcStackDistAndUpdate.
-     *
-     * @param node pointer to the node which is updated
-     * @param is_new_leaf is true if this is a newly added node
-     * @return The stack distance of the current address.
-     *
-     */
-    uint64_t updateSumsLeavesToRoot(Node* node, bool is_new_leaf);
+    /** Stack distance of the entry with the given timestamp */
+    uint64_t distanceOf(uint64_t slot) const;
 
     /**
-     * updateTree is a tree balancing operation, which maintains the
-     * binary tree structure.
-     * This method is called whenever index%2 == 0 (i.e. every
-     * alternate cycle) The two main operation are :
-     * OP1. Moving the root node one layer up if index counter
-     *       crosses power of 2
-     * OP2. Addition of intermediate nodes as and when required
-     *      and linking them to their parents in the layer above.
+     * Renumber the live timestamps densely, growing the tree if it
+     * would otherwise be more than half full, and rebuild the tree.
      */
-    void updateTree();
+    void compact();
+
+    /** Hash used to select the sampled addresses */
+    static uint32_t samplingHash(Addr r_address);
 
     /**
-     * This method is used for verification purposes
-     * It recursively traverses upwards from the given node till
-     * the root to check if the ultimate parent node (root-node) points
-     * to null.
-     *
-     * @param node pointer to the node whose sanity is being checked
-     * @param level the level at which this node is located in the tree
-     *
+     * Remove tracked addresses until at most maxEntries are left,
+     * lowering the sampling threshold accordingly.
      */
-    void sanityCheckTree(const Node* node, uint64_t level = 0) const;
+    void enforceMaxEntries();
 
     /**
      * Return the counter for address accesses (unique and
      * non-unique). This is further used to dump stats at
      * regular intervals.
      *
-     * @return The stack distance of the current address.
+     * @return The number of accesses which updated the stack.
      */
     uint64_t getIndex() const { return index; }
 
-    /**
-     * Query depth of the tree (tree[0] represents leaf layer while
-     * tree[treeDepth] represents the root layer, all layers in
-     * between contain intermediate nodes)
-     *
-     * @return Tree depth
-     */
-    uint64_t getTreeDepth() const { return tree.size() - 1; }
-
     /**
      * Print the last n items on the stack.
      * This method prints top n entries in the tree based implementation as
@@ -293,31 +216,50 @@ class StackDistCalc
      * This is an alternative implementation of the stack-distance
      * in a naive way. It uses simple STL vector to represent the stack.
      * It can be used in parallel for debugging purposes.
-     * It is 10x slower than the tree based implemenation.
      *
      * @param r_address The current address to process
      * @param update_stack Flag to indicate if stack should be updated
+     * @param add_new_node If updating, push the address on the stack
      * @return  Stack distance which is calculated by this alternative
      * implementation
      *
      */
     uint64_t verifyStackDist(const Addr r_address,
-                             bool update_stack = false);
+                             bool update_stack = false,
+                             bool add_new_node = true);
 
   public:
-    StackDistCalc(bool verify_stack = false);
-
-    ~StackDistCalc();
+    /**
+     * @param verify_stack Check every result against a naive stack.
+     * @param sampling_rate Fraction of the addresses to track, in (0, 1].
+     * @param max_entries Upper bound on the number of tracked
+     *        addresses, lowering the sampling rate as needed. Zero
+     *        means unbounded.
+     */
+    StackDistCalc(bool verify_stack = false, double sampling_rate = 1.0,
+                  uint64_t max_entries = 0);
 
     /**
      * A convenient way of refering to infinity.
      */
     static constexpr uint64_t Infinity = std::numeric_limits<uint64_t>::max();
 
+    /**
+     * Is the given address part of the sampled address stream? Always
+     * true without sampling.
+     */
+    bool
+    isSampled(const Addr r_address) const
+    {
+        return !sampling || samplingHash(r_address) < threshold;
+    }
+
+    /** The current sampling rate, which is 1 without sampling. */
+    double samplingRate() const;
 
     /**
      * Process the given address. If Mark is true then set the
-     * mark flag of the leaf node.
+     * mark flag of the address.
      * This function returns the stack distance of the incoming
      * address and the previous status of the mark flag.
      *
@@ -330,14 +272,14 @@ class StackDistCalc
 
     /**
      * Process the given address:
-     *  - Lookup the tree for the given address
-     *  - delete old node if found in tree
-     *  - add a new node (if addNewNode flag is set)
+     *  - Lookup the stack for the given address
+     *  - delete old entry if found in the stack
+     *  - add a new entry (if addNewNode flag is set)
      * This function returns the stack distance of the incoming
      * address and the status of the mark flag.
      *
      * @param r_address The current address to process
-     * @param addNewNode If true, a new node is added to the tree
+     * @param addNewNode If true, a new entry is added to the stack
      * @return The stack distance of the current address and the mark flag.
      */
     std::pair<uint64_t, bool> calcStackDistAndUpdate(const Addr r_address,
@@ -346,66 +288,35 @@ class StackDistCalc
   private:
 
     /**
-     * Node which takes form of Leaf, INode or Root
+     * Internal counter for address accesses (unique and non-unique)
+     * This counter increments everytime an address is added to the
+     * stack.
      */
-    struct Node
-    {
-        // Sum of the left children
-        uint64_t sumLeft;
-
-        // Sum of the right children
-        uint64_t sumRight;
-
-        // Flag to indicate that sumLeft has gone from non-zero value to 0
-        bool discardLeft;
-
-        // Flag to indicate that sumRight has gone from non-zero value to 0
-        bool discardRight;
+    uint64_t index;
 
-        // Index of the current element in the Map
-        uint64_t nodeIndex;
+    // Next timestamp to hand out
+    uint64_t nextSlot;
 
-        // Pointer to the parent
-        Node* parent;
+    // Number of addresses in the stack
+    uint64_t live;
 
-        // Flag to mark the node as the right/left child
-        bool isLeftNode;
+    // Fenwick tree of live timestamps, indexed from 1
+    std::vector<uint64_t> fenwick;
 
-        /**
-         * Flag to indicate if this address is marked. Used in case
-         * where stack distance of a touched address is required.
-         */
-        bool isMarked;
+    // Hash map which returns the stack entry of each address
+    AddressEntryMap addrMap;
 
-        /**
-         * The discard flags are false by default they become true if
-         * the node is reached again in a future lookup.
-         */
-        Node() : sumLeft(0), sumRight(0), discardLeft(false),
-                 discardRight(false), nodeIndex(0),
-                 parent(nullptr), isLeftNode(true), isMarked(false)
-        { }
-    };
-
-    /**
-     * Internal counter for address accesses (unique and non-unique)
-     * This counter increments everytime the calcStackDist() method is
-     * called. This counter is used as a key for the hash- map at the
-     * leaf layer. Practically at every call to the calculator this
-     * counter is incremented and a new leaf node is added in the tree
-     * at the leaf layer using this counter value as the key.
-     */
-    uint64_t index;
+    // Whether only a subset of the addresses is tracked
+    const bool sampling;
 
-    // Binary tree of partial sums
-    TreeType tree;
+    // Addresses whose hash is below this threshold are tracked
+    uint64_t threshold;
 
-    // Hash map which returns last seen index of each address
-    AddressIndexMap aiMap;
+    // Maximum number of tracked addresses, zero if unbounded
+    const uint64_t maxEntries;
 
-    // Keeps count of number of the next unique index for each
-    // level in the tree
-    std::vector<uint64_t> nextIndex;
+    // Tracked addresses ordered by hash, only kept if maxEntries is set
+    std::set<std::pair<uint32_t, Addr>> byHash;
 
     // Dummy Stack for verification
     std::vector<uint64_t> stack;
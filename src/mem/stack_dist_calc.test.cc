@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+
+#include "mem/stack_dist_calc.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+constexpr Addr LineSize = 64;
+
+/** Estimated distance of each access in a cyclic sweep over n lines */
+double
+meanCyclicDistance(StackDistCalc &calc, uint64_t n, int sweeps)
+{
+    double sum = 0;
+    uint64_t count = 0;
+    for (int sweep = 0; sweep < sweeps; ++sweep) {
+        for (uint64_t line = 0; line < n; ++line) {
+            const Addr addr = line * LineSize;
+            if (!calc.isSampled(addr))
+                continue;
+            const uint64_t sd = calc.calcStackDistAndUpdate(addr).first;
+            if (sweep > 0 && sd != StackDistCalc::Infinity) {
+                sum += sd;
+                ++count;
+            }
+        }
+    }
+    return count ? sum / count : 0;
+}
+
+} // anonymous namespace
+
+/*
+ * Check the Fenwick tree against the naive verification stack, which
+ * panics on the first mismatch, over enough accesses to compact and grow
+ * the tree several times.
+ */
+TEST(StackDistCalcTest, MatchesVerificationStack)
+{
+    StackDistCalc calc(true);
+    std::mt19937_64 rng(1);
+    std::uniform_int_distribution<Addr> hot(0, 63);
+    std::uniform_int_distribution<Addr> cold(0, 4095);
+    std::uniform_int_distribution<int> op(0, 99);
+
+    EXPECT_NO_THROW({
+        for (int i = 0; i < 200000; ++i) {
+            const int kind = op(rng);
+            const Addr addr = (kind < 50 ? hot(rng) : cold(rng)) * LineSize;
+            if (kind < 90)
+                calc.calcStackDistAndUpdate(addr);
+            else if (kind < 95)
+                calc.calcStackDistAndUpdate(addr, false);
+            else
+                calc.calcStackDist(addr, kind & 1);
+        }
+    });
+}
+
+TEST(StackDistCalcTest, Marks)
+{
+    StackDistCalc calc;
+
+    EXPECT_EQ(calc.calcStackDistAndUpdate(0x0).first,
+              StackDistCalc::Infinity);
+    calc.calcStackDistAndUpdate(0x40);
+    calc.calcStackDistAndUpdate(0x80);
+
+    // Inspecting does not move the address
+    EXPECT_EQ(calc.calcStackDist(0x0, true), std::make_pair(2UL, false));
+    EXPECT_EQ(calc.calcStackDist(0x0), std::make_pair(2UL, true));
+    EXPECT_EQ(calc.calcStackDist(0x0), std::make_pair(2UL, false));
+
+    // Removing an address shortens the distance of the older ones
+    calc.calcStackDist(0x0, true);
+    EXPECT_EQ(calc.calcStackDistAndUpdate(0x40, false),
+              std::make_pair(1UL, false));
+    EXPECT_EQ(calc.calcStackDistAndUpdate(0x0), std::make_pair(1UL, true));
+    EXPECT_EQ(calc.calcStackDist(0x40).first, StackDistCalc::Infinity);
+}
+
+TEST(StackDistCalcTest, RejectsSampledVerification)
+{
+    EXPECT_ANY_THROW(StackDistCalc(true, 0.5));
+    EXPECT_ANY_THROW(StackDistCalc(false, 0.0));
+    EXPECT_ANY_THROW(StackDistCalc(false, 1.5));
+}
+
+/** Sampled distances estimate those of the full stream */
+TEST(StackDistCalcTest, SampledDistance)
+{
+    const uint64_t n = 20000;
+    StackDistCalc calc(false, 0.1);
+    EXPECT_NEAR(calc.samplingRate(), 0.1, 1e-6);
+
+    uint64_t sampled = 0;
+    for (uint64_t line = 0; line < n; ++line)
+        sampled += calc.isSampled(line * LineSize);
+    EXPECT_NEAR(double(sampled) / n, 0.1, 0.01);
+
+    EXPECT_NEAR(meanCyclicDistance(calc, n, 3), n - 1, 0.1 * n);
+}
+
+/** Bounding the entries lowers the rate but keeps the estimate */
+TEST(StackDistCalcTest, MaxEntries)
+{
+    const uint64_t n = 20000;
+    StackDistCalc calc(false, 1.0, 500);
+
+    EXPECT_NEAR(meanCyclicDistance(calc, n, 3), n - 1, 0.15 * n);
+    EXPECT_LT(calc.samplingRate(), 500.0 / n * 1.2);
+    EXPECT_GT(calc.samplingRate(), 500.0 / n * 0.8);
+}
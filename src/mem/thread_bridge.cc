@@ -27,6 +27,7 @@
 
 #include "mem/thread_bridge.hh"
 
+#include "base/logging.hh"
 #include "base/trace.hh"
 #include "sim/eventq.hh"
 
@@ -34,13 +35,72 @@ namespace gem5
 {
 
 ThreadBridge::ThreadBridge(const ThreadBridgeParams &p)
-    : SimObject(p), in_port_("in_port", *this), out_port_("out_port", *this)
+    : SimObject(p), in_side_(getEventQueue(p.in_eventq_index)),
+      delay_(p.delay),
+      resp_queue_(in_side_, in_port_), req_queue_(*this, out_port_),
+      snoop_resp_queue_(*this, out_port_),
+      in_port_("in_port", *this), out_port_("out_port", *this),
+      req_channel_(p.channel_entries), resp_channel_(p.channel_entries)
 {
 }
 
+void
+ThreadBridge::startup()
+{
+    // A packet must not arrive on the other thread before the quantum
+    // in which it was sent has ended there.
+    fatal_if(numMainEventQueues > 1 && delay_ < simQuantum,
+             "%s: The delay (%d) must be at least the simulation quantum "
+             "(%d)", name(), delay_, simQuantum);
+
+    // Each side picks up the packets for it on its own thread, after
+    // the other threads have reached the quantum boundary.
+    in_side_.eventQueue()->addAsyncHandler([this]() { deliverResponses(); });
+    eventQueue()->addAsyncHandler([this]() { deliverRequests(); });
+}
+
+bool
+ThreadBridge::forward(SPSCQueue<InFlight> &channel, PacketQueue &queue,
+                      PacketPtr pkt)
+{
+    const Tick when = curTick() + delay_;
+    if (!inParallelMode) {
+        queue.schedSendTiming(pkt, when);
+        return true;
+    }
+
+    return channel.tryPush({pkt, when});
+}
+
+void
+ThreadBridge::deliverRequests()
+{
+    req_channel_.consume([this](const InFlight &in_flight) {
+        req_queue_.schedSendTiming(in_flight.pkt, in_flight.when);
+    });
+
+    if (resp_retry_ && resp_channel_.size() < resp_channel_.capacity()) {
+        resp_retry_ = false;
+        out_port_.sendRetryResp();
+    }
+}
+
+void
+ThreadBridge::deliverResponses()
+{
+    resp_channel_.consume([this](const InFlight &in_flight) {
+        resp_queue_.schedSendTiming(in_flight.pkt, in_flight.when);
+    });
+
+    if (req_retry_ && req_channel_.size() < req_channel_.capacity()) {
+        req_retry_ = false;
+        in_port_.sendRetryReq();
+    }
+}
+
 ThreadBridge::IncomingPort::IncomingPort(const std::string &name,
                                          ThreadBridge &device)
-    : ResponsePort(name), device_(device)
+    : QueuedResponsePort(name, device.resp_queue_), device_(device)
 {
 }
 
@@ -54,12 +114,17 @@ ThreadBridge::IncomingPort::getAddrRanges() const
 bool
 ThreadBridge::IncomingPort::recvTimingReq(PacketPtr pkt)
 {
-    panic("ThreadBridge only supports atomic/functional access.");
-}
-void
-ThreadBridge::IncomingPort::recvRespRetry()
-{
-    panic("ThreadBridge only supports atomic/functional access.");
+    panic_if(curEventQueue() != device_.in_side_.eventQueue(),
+             "%s: Request from event queue %s, check in_eventq_index.",
+             name(), curEventQueue()->name());
+
+    // Keep the order of the refused requests.
+    if (device_.req_retry_ ||
+        !device_.forward(device_.req_channel_, device_.req_queue_, pkt)) {
+        device_.req_retry_ = true;
+        return false;
+    }
+    return true;
 }
 
 // AtomicResponseProtocol
@@ -80,7 +145,8 @@ ThreadBridge::IncomingPort::recvFunctional(PacketPtr pkt)
 
 ThreadBridge::OutgoingPort::OutgoingPort(const std::string &name,
                                          ThreadBridge &device)
-    : RequestPort(name), device_(device)
+    : QueuedRequestPort(name, device.req_queue_, device.snoop_resp_queue_),
+      device_(device)
 {
 }
 
@@ -94,12 +160,12 @@ ThreadBridge::OutgoingPort::recvRangeChange()
 bool
 ThreadBridge::OutgoingPort::recvTimingResp(PacketPtr pkt)
 {
-    panic("ThreadBridge only supports atomic/functional access.");
-}
-void
-ThreadBridge::OutgoingPort::recvReqRetry()
-{
-    panic("ThreadBridge only supports atomic/functional access.");
+    if (device_.resp_retry_ ||
+        !device_.forward(device_.resp_channel_, device_.resp_queue_, pkt)) {
+        device_.resp_retry_ = true;
+        return false;
+    }
+    return true;
 }
 
 Port &
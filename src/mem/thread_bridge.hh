@@ -28,8 +28,11 @@
 #ifndef __MEM_THREAD_BRIDGE_HH__
 #define __MEM_THREAD_BRIDGE_HH__
 
-#include "mem/port.hh"
+#include "base/spsc_queue.hh"
+#include "mem/packet.hh"
+#include "mem/qport.hh"
 #include "params/ThreadBridge.hh"
+#include "sim/eventq.hh"
 #include "sim/sim_object.hh"
 
 namespace gem5
@@ -43,8 +46,10 @@ class ThreadBridge : public SimObject
     Port &getPort(const std::string &if_name,
                   PortID idx = InvalidPortID) override;
 
+    void startup() override;
+
   private:
-    class IncomingPort : public ResponsePort
+    class IncomingPort : public QueuedResponsePort
     {
       public:
         IncomingPort(const std::string &name, ThreadBridge &device);
@@ -52,7 +57,6 @@ class ThreadBridge : public SimObject
 
         // TimingResponseProtocol
         bool recvTimingReq(PacketPtr pkt) override;
-        void recvRespRetry() override;
 
         // AtomicResponseProtocol
         Tick recvAtomic(PacketPtr pkt) override;
@@ -64,7 +68,7 @@ class ThreadBridge : public SimObject
         ThreadBridge &device_;
     };
 
-    class OutgoingPort : public RequestPort
+    class OutgoingPort : public QueuedRequestPort
     {
       public:
         OutgoingPort(const std::string &name, ThreadBridge &device);
@@ -72,14 +76,54 @@ class ThreadBridge : public SimObject
 
         // TimingRequestProtocol
         bool recvTimingResp(PacketPtr pkt) override;
-        void recvReqRetry() override;
 
       private:
         ThreadBridge &device_;
     };
 
+    /** A packet in flight between the two threads. */
+    struct InFlight
+    {
+        PacketPtr pkt;
+        Tick when;
+    };
+
+    /**
+     * Hand a packet over to the other side, to be sent at a given tick.
+     * In parallel mode, the packet goes through a lock-free channel
+     * and the other side picks it up at the next quantum boundary.
+     *
+     * @return false if the channel is full.
+     */
+    bool forward(SPSCQueue<InFlight> &channel, PacketQueue &queue,
+                 PacketPtr pkt);
+
+    /** Pick up the requests from the initiator side. */
+    void deliverRequests();
+
+    /** Pick up the responses from the target side. */
+    void deliverResponses();
+
+    /** Event manager of the initiator side, for the responses. */
+    EventManager in_side_;
+
+    const Tick delay_;
+
+    RespPacketQueue resp_queue_;
+    ReqPacketQueue req_queue_;
+    SnoopRespPacketQueue snoop_resp_queue_;
+
     IncomingPort in_port_;
     OutgoingPort out_port_;
+
+    /** Requests from the initiator thread to the target thread. */
+    SPSCQueue<InFlight> req_channel_;
+    /** Responses from the target thread to the initiator thread. */
+    SPSCQueue<InFlight> resp_channel_;
+
+    /** Set when a packet was refused because its channel was full. */
+    bool req_retry_ = false;
+    bool resp_retry_ = false;
 };
 
 }  // namespace gem5
@@ -0,0 +1,397 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Periodic sampled simulation in the style of SMARTS.
+
+The simulated instruction stream is split into fixed-size sampling periods.
+Each period starts with functional warming on a fast core (normally an atomic
+core, which keeps caches and branch predictors warm), then switches to a
+detailed core for a short warm-up window to fill the pipeline, and finally
+measures a window on the detailed core. After each measurement the sample is
+added to a running estimate. Simulation stops early once the confidence
+interval of that estimate is tight enough.
+
+Example
+-------
+
+```
+processor = SimpleSwitchableProcessor(
+    starting_core_type=CPUTypes.ATOMIC,
+    switch_core_type=CPUTypes.O3,
+    isa=ISA.X86,
+    num_cores=1,
+)
+
+...
+
+sampler = SmartsSampler(
+    processor=processor,
+    sampling_period=1000000,
+    detailed_warmup_insts=2000,
+    measurement_insts=1000,
+)
+
+simulator = Simulator(
+    board=board,
+    on_exit_event={ExitEvent.MAX_INSTS: sampler.get_exit_event_generator()},
+)
+simulator.run()
+
+print(sampler.get_statistics())
+```
+"""
+
+import math
+from enum import Enum
+from statistics import NormalDist
+from typing import Callable, Generator, List, Optional, Tuple
+
+import m5
+import m5.stats
+from m5.util import inform, warn
+
+from ..components.processors.switchable_processor import SwitchableProcessor
+from ..components.processors.simple_switchable_processor import (
+    SimpleSwitchableProcessor,
+)
+
+
+class SamplingPhase(Enum):
+    """The phases of a sampling period, in the order they are executed."""
+
+    FUNCTIONAL_WARMING = "functional warming"
+    DETAILED_WARMUP = "detailed warm-up"
+    MEASUREMENT = "measurement"
+
+
+class SampleStatistics:
+    """
+    A running summary of per-sample measurements. The confidence interval
+    assumes the samples are independent and uses the normal approximation,
+    which is the usual assumption for systematic sampling with at least a
+    few tens of samples.
+    """
+
+    def __init__(self, confidence: float = 0.997) -> None:
+        """
+        :param confidence: The confidence level of the reported interval,
+        between 0 and 1 (exclusive). The default, 0.997, corresponds to the
+        +/-3 standard errors used by SMARTS.
+        """
+        if not 0.0 < confidence < 1.0:
+            raise ValueError(
+                f"Confidence must be between 0 and 1, not {confidence}."
+            )
+
+        self._confidence = confidence
+        self._z = NormalDist().inv_cdf((1.0 + confidence) / 2.0)
+        self._values = []
+
+    def add(self, value: float) -> None:
+        """Add the measurement of one sample."""
+        self._values.append(value)
+
+    def get_values(self) -> List[float]:
+        """Returns the measurement of every sample, in order."""
+        return self._values
+
+    def get_num_samples(self) -> int:
+        return len(self._values)
+
+    def get_confidence(self) -> float:
+        return self._confidence
+
+    def get_mean(self) -> float:
+        if not self._values:
+            raise Exception("Cannot take the mean of zero samples.")
+        return math.fsum(self._values) / len(self._values)
+
+    def get_stdev(self) -> float:
+        """Returns the sample standard deviation, or 0 for one sample."""
+        n = len(self._values)
+        if n < 2:
+            return 0.0
+        mean = self.get_mean()
+        return math.sqrt(
+            math.fsum((v - mean) ** 2 for v in self._values) / (n - 1)
+        )
+
+    def get_half_width(self) -> float:
+        """
+        Returns the half width of the confidence interval of the mean, or
+        infinity when there are too few samples to estimate it.
+        """
+        n = len(self._values)
+        if n < 2:
+            return math.inf
+        return self._z * self.get_stdev() / math.sqrt(n)
+
+    def get_confidence_interval(self) -> Tuple[float, float]:
+        mean = self.get_mean()
+        half_width = self.get_half_width()
+        return (mean - half_width, mean + half_width)
+
+    def get_relative_error(self) -> float:
+        """
+        Returns the half width of the confidence interval relative to the
+        mean, or infinity if it cannot be estimated.
+        """
+        if len(self._values) < 2:
+            return math.inf
+        mean = self.get_mean()
+        if mean == 0.0:
+            return math.inf
+        return self.get_half_width() / abs(mean)
+
+    def get_required_samples(self, target_error: float) -> Optional[int]:
+        """
+        Estimates the number of samples needed to reach a relative error of
+        `target_error`, based on the variation seen so far. Returns None if
+        the mean is zero, as the relative error is then undefined.
+        """
+        if len(self._values) < 2:
+            raise Exception(
+                "At least two samples are needed to estimate the number of "
+                "samples required."
+            )
+        mean = self.get_mean()
+        if mean == 0.0:
+            return None
+        cv = self.get_stdev() / abs(mean)
+        return max(
+            len(self._values), math.ceil((self._z * cv / target_error) ** 2)
+        )
+
+    def __str__(self) -> str:
+        if not self._values:
+            return "No samples"
+        low, high = self.get_confidence_interval()
+        return (
+            f"{self.get_num_samples()} samples, mean {self.get_mean():.6g}, "
+            f"{self._confidence * 100:g}% confidence interval "
+            f"[{low:.6g}, {high:.6g}] "
+            f"(+/-{self.get_relative_error() * 100:.3g}%)"
+        )
+
+
+def ticks_per_inst_metric(insts: int, ticks: int) -> float:
+    """
+    The default sample metric: simulated ticks per committed instruction in
+    the measurement window. This is the CPI scaled by the core clock period,
+    so the relative error of its estimate is the relative error of the CPI.
+    """
+    return ticks / insts
+
+
+class SmartsSampler:
+    """
+    Controls a SMARTS-style sampled simulation on a SwitchableProcessor.
+
+    The sampler drives the simulation through MAX_INSTS exit events, so its
+    generator must be passed to the Simulator for `ExitEvent.MAX_INSTS`.
+    The sampler must be constructed before the simulation is run as it sets
+    up the first functional warming window on the starting cores.
+
+    **Warning:** Instruction counts are tracked on the first core only, as
+    for SimPoints.
+    """
+
+    def __init__(
+        self,
+        processor: SwitchableProcessor,
+        sampling_period: int,
+        measurement_insts: int,
+        detailed_warmup_insts: int = 0,
+        warming_cores: Optional[str] = None,
+        detailed_cores: Optional[str] = None,
+        offset_insts: int = 0,
+        metric: Callable[[int, int], float] = ticks_per_inst_metric,
+        confidence: float = 0.997,
+        target_error: Optional[float] = 0.03,
+        min_samples: int = 30,
+        max_samples: Optional[int] = None,
+        dump_stats: bool = False,
+    ) -> None:
+        """
+        :param processor: The processor to sample. It must start on the
+        functional warming cores.
+        :param sampling_period: The number of instructions in each sampling
+        period, including the detailed warm-up and measurement windows.
+        :param measurement_insts: The number of instructions measured per
+        sample.
+        :param detailed_warmup_insts: The number of instructions executed on
+        the detailed cores before each measurement.
+        :param warming_cores: The SwitchableProcessor key of the functional
+        warming cores. If neither this nor `detailed_cores` is set the
+        processor must be a SimpleSwitchableProcessor and `switch()` is used.
+        :param detailed_cores: The SwitchableProcessor key of the detailed
+        cores.
+        :param offset_insts: Additional instructions executed with functional
+        warming before the first sampling period, to skip initialization.
+        :param metric: Computes the measured value of a sample from the
+        number of instructions and ticks in the measurement window. It is
+        called before the stats are dumped, so it may also read the stats.
+        :param confidence: The confidence level of the reported interval.
+        :param target_error: Stop once the relative half width of the
+        confidence interval is at most this value. If None, run until the
+        workload ends or `max_samples` is reached.
+        :param min_samples: The minimum number of samples to take before
+        stopping early.
+        :param max_samples: Stop after this many samples, if set.
+        :param dump_stats: Dump the stats at the end of every measurement
+        window, giving a stats block per sample.
+        """
+        if measurement_insts <= 0:
+            raise ValueError("The measurement window must be non-empty.")
+        if detailed_warmup_insts < 0 or offset_insts < 0:
+            raise ValueError("Instruction counts must not be negative.")
+        if sampling_period <= detailed_warmup_insts + measurement_insts:
+            raise ValueError(
+                "The sampling period must be larger than the detailed "
+                "warm-up and measurement windows combined."
+            )
+        if (warming_cores is None) != (detailed_cores is None):
+            raise ValueError(
+                "Either both or neither of `warming_cores` and "
+                "`detailed_cores` must be set."
+            )
+        if warming_cores is None and not isinstance(
+            processor, SimpleSwitchableProcessor
+        ):
+            raise ValueError(
+                "Core keys must be given unless the processor is a "
+                "SimpleSwitchableProcessor."
+            )
+        if processor.get_num_cores() > 1:
+            warn("SmartsSampler only counts instructions on the first core")
+
+        self._processor = processor
+        self._warming_cores = warming_cores
+        self._detailed_cores = detailed_cores
+        self._warming_insts = (
+            sampling_period - detailed_warmup_insts - measurement_insts
+        )
+        self._detailed_warmup_insts = detailed_warmup_insts
+        self._measurement_insts = measurement_insts
+        self._metric = metric
+        self._target_error = target_error
+        self._min_samples = max(min_samples, 2)
+        self._max_samples = max_samples
+        self._dump_stats = dump_stats
+
+        self._statistics = SampleStatistics(confidence=confidence)
+        self._sample_ticks = []
+        self._phase = SamplingPhase.FUNCTIONAL_WARMING
+        self._measurement_start = 0
+        self._converged = False
+
+        self._schedule(offset_insts + self._warming_insts, False)
+
+    def get_statistics(self) -> SampleStatistics:
+        return self._statistics
+
+    def get_sample_ticks(self) -> List[Tuple[int, int]]:
+        """
+        Returns the start tick and length in ticks of every measurement
+        window, in order.
+        """
+        return self._sample_ticks
+
+    def get_phase(self) -> SamplingPhase:
+        return self._phase
+
+    def is_converged(self) -> bool:
+        """True if sampling stopped because the target error was met."""
+        return self._converged
+
+    def get_exit_event_generator(self) -> Generator[bool, None, None]:
+        """
+        Returns the generator to be used for `ExitEvent.MAX_INSTS`. It yields
+        True, ending the Simulator run loop, once enough samples have been
+        taken.
+        """
+        while True:
+            yield self._step()
+
+    def _schedule(self, insts: int, initialized: bool = True) -> None:
+        self._processor.get_cores()[0]._set_inst_stop_any_thread(
+            insts, initialized
+        )
+
+    def _switch(self, cores: Optional[str]) -> None:
+        if cores is None:
+            self._processor.switch()
+        else:
+            self._processor.switch_to_processor(cores)
+
+    def _start_measurement(self) -> None:
+        self._phase = SamplingPhase.MEASUREMENT
+        m5.stats.reset()
+        self._measurement_start = m5.curTick()
+        self._schedule(self._measurement_insts)
+
+    def _end_measurement(self) -> None:
+        ticks = m5.curTick() - self._measurement_start
+        self._sample_ticks.append((self._measurement_start, ticks))
+        self._statistics.add(self._metric(self._measurement_insts, ticks))
+        if self._dump_stats:
+            m5.stats.dump()
+
+    def _finished(self) -> bool:
+        n = self._statistics.get_num_samples()
+        if (
+            self._target_error is not None
+            and n >= self._min_samples
+            and self._statistics.get_relative_error() <= self._target_error
+        ):
+            self._converged = True
+            return True
+        return self._max_samples is not None and n >= self._max_samples
+
+    def _step(self) -> bool:
+        if self._phase == SamplingPhase.FUNCTIONAL_WARMING:
+            self._switch(self._detailed_cores)
+            if self._detailed_warmup_insts:
+                self._phase = SamplingPhase.DETAILED_WARMUP
+                self._schedule(self._detailed_warmup_insts)
+            else:
+                self._start_measurement()
+            return False
+
+        if self._phase == SamplingPhase.DETAILED_WARMUP:
+            self._start_measurement()
+            return False
+
+        self._end_measurement()
+        if self._finished():
+            inform(f"Sampling finished: {self._statistics}")
+            return True
+
+        self._switch(self._warming_cores)
+        self._phase = SamplingPhase.FUNCTIONAL_WARMING
+        self._schedule(self._warming_insts)
+        return False
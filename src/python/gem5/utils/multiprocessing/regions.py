@@ -0,0 +1,425 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Run the regions of a sampled workload (SimPoints or LoopPoints) in parallel.
+
+Each region is restored from its own checkpoint and simulated in a separate
+gem5 process, with up to one process per host core. Every region writes its
+result to `<outdir>/<region name>/region_result.json`. The results are merged
+into a single weighted report, `<outdir>/regions_report.json`.
+
+Runs are resumable. A region whose result file already exists is not
+simulated again, so rerunning the same script after a crash (or after
+fixing the cause of a failing region) only simulates the missing regions.
+
+As with the rest of this package, the function simulating a region must be
+importable from a module other than the main script. It receives a `Region`
+and returns the region's stats as a flat mapping of stat names to numbers,
+e.g. by calling `simulate_region`.
+
+Example
+-------
+
+regions.py:
+
+```python
+from gem5.utils.multiprocessing.regions import simulate_region
+
+def run_region(region):
+    board = make_board()
+    board.set_se_simpoint_workload(
+        binary=obtain_resource("x86-print-this"),
+        arguments=["print this", 15000],
+        simpoint=make_simpoint(),
+        checkpoint=region.get_checkpoint(),
+    )
+    return simulate_region(Simulator(board=board), region)
+```
+
+run.py:
+
+```python
+from gem5.utils.multiprocessing.regions import (
+    RegionRunner,
+    regions_from_simpoint,
+)
+from regions import make_simpoint, run_region
+
+if __name__ == "__m5_main__":
+    runner = RegionRunner(
+        target=run_region,
+        regions=regions_from_simpoint(make_simpoint(), Path("cpts")),
+    )
+    report = runner.run()
+    print(report["stats"]["board.processor.cores.core.ipc"])
+```
+"""
+
+import json
+import os
+import time
+from multiprocessing.connection import wait
+from pathlib import Path
+from typing import Any, Callable, Dict, List, Optional, Union
+
+from .context import Process
+
+RESULT_FILE = "region_result.json"
+REPORT_FILE = "regions_report.json"
+
+
+class Region:
+    """One independently simulated region of a workload."""
+
+    def __init__(
+        self,
+        region_id: Union[int, str],
+        weight: float,
+        checkpoint: Optional[Path] = None,
+        warmup_insts: Optional[int] = None,
+        measurement_insts: Optional[int] = None,
+    ) -> None:
+        """
+        :param region_id: The region's identifier. It must be unique within
+        a run as it names the region's output directory.
+        :param weight: The region's weight in the merged report. Each merged
+        stat is the sum over regions of weight times the region's value.
+        :param checkpoint: The checkpoint to restore the region from.
+        :param warmup_insts: The number of instructions to warm up for
+        before measuring, if the region is instruction-count based.
+        :param measurement_insts: The number of instructions to measure, if
+        the region is instruction-count based.
+        """
+        self._region_id = region_id
+        self._weight = weight
+        self._checkpoint = checkpoint
+        self._warmup_insts = warmup_insts
+        self._measurement_insts = measurement_insts
+
+    def get_id(self) -> Union[int, str]:
+        return self._region_id
+
+    def get_name(self) -> str:
+        """Returns the name of the region's output directory."""
+        return f"region{self._region_id}"
+
+    def get_weight(self) -> float:
+        return self._weight
+
+    def get_checkpoint(self) -> Optional[Path]:
+        return self._checkpoint
+
+    def get_warmup_insts(self) -> Optional[int]:
+        return self._warmup_insts
+
+    def get_measurement_insts(self) -> Optional[int]:
+        return self._measurement_insts
+
+
+def regions_from_simpoint(simpoint, checkpoint_dir: Path) -> List[Region]:
+    """
+    Returns a region for every SimPoint of a `SimpointResource`, restoring
+    from the checkpoints written by `simpoints_save_checkpoint_generator`
+    into `checkpoint_dir`. The weights are the SimPoint weights, so the
+    merged stats are those of an average SimPoint interval.
+    """
+    interval = simpoint.get_simpoint_interval()
+    return [
+        Region(
+            region_id=index,
+            weight=weight,
+            checkpoint=checkpoint_dir / f"cpt.SimPoint{index}",
+            warmup_insts=warmup,
+            measurement_insts=interval,
+        )
+        for index, (weight, warmup) in enumerate(
+            zip(simpoint.get_weight_list(), simpoint.get_warmup_list())
+        )
+    ]
+
+
+def regions_from_looppoint(looppoint, checkpoint_dir: Path) -> List[Region]:
+    """
+    Returns a region for every region of a `Looppoint`, restoring from the
+    checkpoints written by `looppoint_save_checkpoint_generator` into
+    `checkpoint_dir`. The weights are the LoopPoint multipliers, so the
+    merged stats extrapolate to the whole program. LoopPoint regions are
+    delimited by PC counts rather than instruction counts, so the target
+    must call `Looppoint.set_target_region_id` with the region's id.
+    """
+    return [
+        Region(
+            region_id=region_id,
+            weight=region.get_multiplier(),
+            checkpoint=checkpoint_dir / f"cpt.Region{region_id}",
+        )
+        for region_id, region in looppoint.get_regions().items()
+    ]
+
+
+def flatten_stats(stats: Dict[str, Any], prefix: str = "") -> Dict[str, float]:
+    """
+    Flattens the JSON form of a SimStat (as returned by
+    `Simulator.get_stats()`) into a mapping of dotted stat names to numbers.
+    Non-numeric entries are dropped.
+    """
+    flat = {}
+    for key, value in stats.items():
+        name = f"{prefix}.{key}" if prefix else key
+        if isinstance(value, bool):
+            continue
+        if isinstance(value, (int, float)):
+            flat[name] = value
+        elif isinstance(value, dict):
+            if isinstance(value.get("value"), (int, float)) and not isinstance(
+                value.get("value"), bool
+            ):
+                flat[name] = value["value"]
+            else:
+                flat.update(flatten_stats(value, name))
+        elif isinstance(value, list):
+            for index, element in enumerate(value):
+                if isinstance(element, dict):
+                    flat.update(flatten_stats(element, f"{name}.{index}"))
+                elif isinstance(element, (int, float)) and not isinstance(
+                    element, bool
+                ):
+                    flat[f"{name}.{index}"] = element
+    return flat
+
+
+def merge_weighted_stats(results: List[Dict[str, Any]]) -> Dict[str, float]:
+    """
+    Merges region results (the contents of their result files) into the
+    weighted sum of each stat. Only stats reported by every region are
+    merged, as a stat missing from one region cannot be weighted
+    meaningfully.
+    """
+    if not results:
+        return {}
+
+    names = set(results[0]["stats"])
+    for result in results[1:]:
+        names &= set(result["stats"])
+
+    return {
+        name: sum(
+            result["weight"] * result["stats"][name] for result in results
+        )
+        for name in sorted(names)
+    }
+
+
+def simulate_region(simulator, region: Region) -> Dict[str, float]:
+    """
+    Runs an instruction-count based region with the given simulator: the
+    warm-up instructions, a stats reset and then the measured instructions.
+    Returns the flattened stats of the measurement. The simulator must use
+    the default (exiting) behavior for `ExitEvent.MAX_INSTS`.
+    """
+    import m5.stats
+
+    if region.get_measurement_insts() is None:
+        raise ValueError(
+            f"Region {region.get_id()} is not instruction-count based."
+        )
+
+    if region.get_warmup_insts():
+        simulator.schedule_max_insts(region.get_warmup_insts())
+        simulator.run()
+
+    m5.stats.reset()
+    simulator.schedule_max_insts(region.get_measurement_insts())
+    simulator.run()
+    m5.stats.dump()
+
+    return flatten_stats(simulator.get_stats())
+
+
+def _run_region(
+    target: Callable[[Region], Dict[str, float]], region: Region
+) -> None:
+    """The entry point of each region's process."""
+    from m5 import options
+
+    outdir = Path(options.outdir)
+    start = time.time()
+    stats = target(region)
+
+    result = {
+        "id": region.get_id(),
+        "weight": region.get_weight(),
+        "host_seconds": time.time() - start,
+        "stats": stats,
+    }
+
+    # Write the result atomically so a crash while writing it doesn't leave
+    # a region looking finished.
+    tmp = outdir / f"{RESULT_FILE}.tmp"
+    with open(tmp, "w") as f:
+        json.dump(result, f, indent=2)
+    os.replace(tmp, outdir / RESULT_FILE)
+
+
+class RegionRunner:
+    """
+    Simulates a set of regions in parallel gem5 processes and merges their
+    stats into one weighted report.
+    """
+
+    def __init__(
+        self,
+        target: Callable[[Region], Dict[str, float]],
+        regions: List[Region],
+        processes: Optional[int] = None,
+        max_retries: int = 0,
+    ) -> None:
+        """
+        :param target: Simulates one region and returns its stats. It must be
+        importable from a module other than the main script.
+        :param regions: The regions to simulate.
+        :param processes: The maximum number of regions simulated at once.
+        Defaults to the number of host cores available to this process.
+        :param max_retries: The number of times a failed region is rerun
+        before it is reported as failed.
+        """
+        names = [region.get_name() for region in regions]
+        if len(set(names)) != len(names):
+            raise ValueError("Region ids must be unique.")
+
+        if processes is None:
+            processes = len(os.sched_getaffinity(0))
+        if processes < 1:
+            raise ValueError("At least one process is needed.")
+
+        self._target = target
+        self._regions = regions
+        self._processes = processes
+        self._max_retries = max_retries
+
+    def _result_path(self, region: Region) -> Path:
+        from m5 import options
+
+        return Path(options.outdir) / region.get_name() / RESULT_FILE
+
+    def _load_result(self, region: Region) -> Optional[Dict[str, Any]]:
+        path = self._result_path(region)
+        if not path.exists():
+            return None
+        with open(path) as f:
+            return json.load(f)
+
+    def run(self) -> Dict[str, Any]:
+        """
+        Simulates every region without a result from a previous run, then
+        writes and returns the merged report. The report contains the merged
+        `stats`, the status of each region and the fraction of the total
+        weight covered by regions which finished.
+        """
+        from m5 import options
+        from m5.util import inform, warn
+
+        pending = [
+            region
+            for region in self._regions
+            if self._load_result(region) is None
+        ]
+        if len(pending) != len(self._regions):
+            inform(
+                f"Reusing results of "
+                f"{len(self._regions) - len(pending)} region(s)"
+            )
+
+        attempts = {region.get_name(): 0 for region in pending}
+        failed = set()
+        running = {}
+
+        while pending or running:
+            while pending and len(running) < self._processes:
+                region = pending.pop(0)
+                attempts[region.get_name()] += 1
+                process = Process(
+                    target=_run_region,
+                    args=(self._target, region),
+                    name=region.get_name(),
+                )
+                process.start()
+                running[process.sentinel] = (process, region)
+
+            for sentinel in wait(list(running)):
+                process, region = running.pop(sentinel)
+                process.join()
+                if (
+                    process.exitcode == 0
+                    and self._load_result(region) is not None
+                ):
+                    continue
+
+                name = region.get_name()
+                if attempts[name] <= self._max_retries:
+                    warn(
+                        f"Region {region.get_id()} failed with exit code "
+                        f"{process.exitcode}, retrying"
+                    )
+                    pending.append(region)
+                else:
+                    warn(
+                        f"Region {region.get_id()} failed with exit code "
+                        f"{process.exitcode}"
+                    )
+                    failed.add(name)
+
+        results = []
+        status = {}
+        for region in self._regions:
+            result = self._load_result(region)
+            if result is None:
+                status[str(region.get_id())] = "failed"
+            else:
+                status[str(region.get_id())] = "done"
+                results.append(result)
+
+        total_weight = sum(region.get_weight() for region in self._regions)
+        done_weight = sum(result["weight"] for result in results)
+
+        report = {
+            "regions": status,
+            "coverage": done_weight / total_weight if total_weight else 0.0,
+            "host_seconds": sum(result["host_seconds"] for result in results),
+            "stats": merge_weighted_stats(results),
+        }
+
+        with open(Path(options.outdir) / REPORT_FILE, "w") as f:
+            json.dump(report, f, indent=2)
+
+        if failed:
+            warn(
+                f"{len(failed)} region(s) failed. Rerun to retry them; "
+                "finished regions are not simulated again."
+            )
+
+        return report
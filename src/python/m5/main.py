@@ -214,6 +214,21 @@ def parse_options():
         callback=_stats_help,
         help="Display documentation for available stat visitors",
     )
+    option(
+        "--stats-threads",
+        metavar="N",
+        type="int",
+        default=0,
+        help="Number of host threads used to prepare, reset and dump "
+        "statistics (0 for the number of host cores) [Default: %default]",
+    )
+    option(
+        "--stats-memory-report",
+        metavar="FILE",
+        default="",
+        help="Write the host memory used by the statistics of each "
+        "SimObject to FILE once they are created, and after each dump",
+    )
 
     # Configuration Options
     group("Configuration Options")
@@ -517,6 +532,7 @@ def main():
 
     # set stats options
     stats.addStatVisitor(options.stats_file)
+    stats.setParallelThreads(options.stats_threads)
 
     # Disable listeners unless running interactively or explicitly
     # enabled
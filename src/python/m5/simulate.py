@@ -150,6 +150,11 @@ def instantiate(ckpt_dir=None):
     # We're done registering statistics.  Enable the stats package now.
     stats.enable()
 
+    if options.stats_memory_report:
+        stats.enableMemoryReport(
+            os.path.join(options.outdir, options.stats_memory_report)
+        )
+
     # Restore checkpoint (if any)
     if ckpt_dir:
         _drain_manager.preCheckpointRestore()
@@ -48,6 +48,7 @@ from m5.util import attrdict, fatal
 # Stat exports
 from _m5.stats import schedStatEvent as schedEvent
 from _m5.stats import periodicStatDump
+from _m5.stats import setParallelThreads
 
 outputList = []
 
@@ -349,7 +350,11 @@ def prepare():
         stat.prepare()
 
     # New stats
-    _visit_stats(lambda g, s: s.prepare())
+    root = Root.getInstance()
+    if root:
+        _m5.stats.prepareParallel(root.getCCObject())
+    else:
+        _visit_stats(lambda g, s: s.prepare())
 
 
 def _dump_to_visitor(visitor, roots=None):
@@ -362,17 +367,24 @@ def _dump_to_visitor(visitor, roots=None):
             dump_group(g)
             visitor.endGroup()
 
+    def dump_root(root, path):
+        # Outputs that support it render the subtrees of the root in
+        # parallel.
+        if _m5.stats.dumpParallel(visitor, root.getCCObject(), path):
+            return
+        for p in path:
+            visitor.beginGroup(p)
+        dump_group(root)
+        for p in reversed(path):
+            visitor.endGroup()
+
     if roots:
         # New stats from selected subroots.
         for root in roots:
-            for p in root.path_list():
-                visitor.beginGroup(p)
-            dump_group(root)
-            for p in reversed(root.path_list()):
-                visitor.endGroup()
+            dump_root(root, root.path_list())
     else:
         # New stats starting from root.
-        dump_group(Root.getInstance())
+        dump_root(Root.getInstance(), [])
 
         # Legacy stats
         for stat in stats_list:
@@ -425,14 +437,18 @@ def dump(roots=None):
                 _dump_to_visitor(output, roots=all_roots)
                 output.end()
 
+    if new_dump and memoryReportFile:
+        memoryReport(memoryReportFile)
+
 
 def reset():
     """Reset all statistics to the base state"""
 
-    # call reset stats on all SimObjects
+    # reset the stats of all SimObjects in parallel, then call reset stats
+    # on them
     root = Root.getInstance()
     if root:
-        root.resetStats()
+        _m5.stats.resetParallel(root.getCCObject())
 
     # call any other registered legacy stats reset callbacks
     for stat in stats_list:
@@ -441,6 +457,58 @@ def reset():
     _m5.stats.processResetQueue()
 
 
+memoryReportFile = None
+
+
+def enableMemoryReport(filename):
+    """Write the host memory used by the stats to a file now, and again
+    after each dump. The buckets of distributions are only allocated when
+    they are first sampled, so the memory used grows as the simulation
+    runs. The last dump is the one at exit."""
+
+    global memoryReportFile
+    memoryReportFile = filename
+    open(filename, "w").close()
+    memoryReport(filename)
+
+
+def memoryReport(filename):
+    """Append the host memory used by the stats of each SimObject to a
+    file. The total of an object includes the stats of its children.
+
+    The buckets of distributions are only allocated when they are first
+    sampled, so the memory reserved for them is reported separately."""
+
+    rows = []
+
+    def visit(path, group):
+        stats = group.getStats()
+        own = sum(stat.memoryUsage() for stat in stats)
+        total = own
+        index = len(rows)
+        rows.append(None)
+        for name, child in group.getStatGroups().items():
+            total += visit(f"{path}.{name}" if path else name, child)
+        rows[index] = (total, own, len(stats), path or "root")
+        return total
+
+    visit("", Root.getInstance().getCCObject())
+
+    with open(filename, "a") as f:
+        print(
+            f"---------- Stats memory at tick {m5.curTick()} ----------",
+            file=f,
+        )
+        print(f"{'total':>12} {'own':>12} {'stats':>8}  object", file=f)
+        for total, own, count, path in rows:
+            print(f"{total:12d} {own:12d} {count:8d}  {path}", file=f)
+        print(
+            f"\nMemory reserved for distribution buckets: "
+            f"{_m5.stats.reservedBucketMemory()} bytes\n",
+            file=f,
+        )
+
+
 flags = attrdict(
     {
         "none": 0x0000,
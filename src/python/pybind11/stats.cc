@@ -42,6 +42,7 @@
 #include "pybind11/stl.h"
 
 #include "base/statistics.hh"
+#include "base/stats/parallel.hh"
 #include "base/stats/text.hh"
 #include "config/have_hdf5.hh"
 
@@ -124,6 +125,12 @@ pybind_init_stats(py::module_ &m_native)
         .def("enable", &statistics::enable)
         .def("enabled", &statistics::enabled)
         .def("statsList", &statistics::statsList)
+        .def("setParallelThreads", &statistics::setParallelThreads)
+        .def("prepareParallel", &statistics::prepareParallel)
+        .def("resetParallel", &statistics::resetParallel)
+        .def("dumpParallel", &statistics::dumpParallel)
+        .def("reservedBucketMemory",
+             &statistics::LazyBuckets::reservedMemory)
         ;
 
     py::class_<statistics::Output>(m, "Output")
@@ -152,6 +159,7 @@ pybind_init_stats(py::module_ &m_native)
         .def("reset", &statistics::Info::reset)
         .def("zero", &statistics::Info::zero)
         .def("visit", &statistics::Info::visit)
+        .def("memoryUsage", &statistics::Info::memoryUsage)
         ;
 
     py::class_<statistics::ScalarInfo, statistics::Info,
@@ -199,7 +207,12 @@ pybind_init_stats(py::module_ &m_native)
                 return info.data.bucket_size;
             })
         .def_property_readonly("values",
-            [](const statistics::DistInfo &info) { return info.data.cvec; })
+            [](const statistics::DistInfo &info) {
+                // Unsampled buckets are not copied, as they are all zero
+                if (info.data.cvec.empty())
+                    return statistics::VCounter(info.data.buckets);
+                return info.data.cvec;
+            })
         .def_property_readonly("overflow",
             [](const statistics::DistInfo &info) {
                 return info.data.overflow;
@@ -0,0 +1,51 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.SimObject import SimObject
+
+
+class EventProfiler(SimObject):
+    """Self-profiler attributing host time to the SimObjects owning the
+    simulated events. Every sample_period-th event of each event queue is
+    timed. The estimated host time per object is reported in the stats, and
+    per event in a text report and a folded-stacks file for flame graph
+    tools, both written on exit. Add an instance anywhere in the hierarchy,
+    e.g., root.event_profiler = EventProfiler().
+    """
+
+    type = "EventProfiler"
+    cxx_header = "sim/event_profiler.hh"
+    cxx_class = "gem5::EventProfiler"
+
+    sample_period = Param.UInt64(64, "Time every Nth event of each queue")
+    report_file = Param.String(
+        "event_profile.txt", "Text report file, empty to disable"
+    )
+    folded_file = Param.String(
+        "event_profile.folded",
+        "Folded stacks file for flame graph tools, empty to disable",
+    )
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/event_profiler.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include "base/cprintf.hh"
+#include "base/output.hh"
+#include "sim/core.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+EventProfiler::EventProfiler(const Params &p)
+    : SimObject(p), samplePeriod(p.sample_period),
+      reportFile(p.report_file), foldedFile(p.folded_file), stats(*this)
+{
+    registerExitCallback([this]() { writeReports(); });
+}
+
+EventProfiler::~EventProfiler()
+{
+    for (uint32_t i = 0; i < profilers.size(); ++i)
+        getEventQueue(i)->setProfiler(nullptr);
+}
+
+void
+EventProfiler::startup()
+{
+    SimObject::startup();
+
+    // all event queues exist once the objects have been created
+    for (uint32_t i = 0; i < numMainEventQueues; ++i) {
+        profilers.emplace_back(new EventQueueProfiler(samplePeriod));
+        getEventQueue(i)->setProfiler(profilers.back().get());
+    }
+}
+
+std::size_t
+EventProfiler::owner(const std::string &event_name) const
+{
+    // strip components from the end of the name until it matches an
+    // object, e.g., system.cpu.icache.tickEvent -> system.cpu.icache
+    std::string::size_type end = event_name.size();
+    while (end != std::string::npos && end > 0) {
+        auto it = objectIndex.find(event_name.substr(0, end));
+        if (it != objectIndex.end())
+            return it->second;
+        end = event_name.rfind('.', end - 1);
+    }
+    return objectNames.size();
+}
+
+void
+EventProfiler::preDumpStats()
+{
+    SimObject::preDumpStats();
+
+    std::vector<double> seconds(objectNames.size() + 1, 0);
+    for (const auto &profiler : profilers) {
+        for (const auto &e : profiler->getEntries())
+            seconds[owner(e.first)] += e.second.intervalSeconds;
+    }
+
+    for (std::size_t i = 0; i < seconds.size(); ++i)
+        stats.hostSeconds[i] = seconds[i];
+}
+
+void
+EventProfiler::postResetStats()
+{
+    SimObject::postResetStats();
+
+    for (auto &profiler : profilers)
+        profiler->resetInterval();
+}
+
+void
+EventProfiler::writeReports() const
+{
+    // merge the profiles of all event queues
+    std::map<std::string, EventQueueProfiler::Entry> merged;
+    double total = 0;
+    for (const auto &profiler : profilers) {
+        for (const auto &e : profiler->getEntries()) {
+            auto &m = merged[e.first];
+            m.description = e.second.description;
+            m.samples += e.second.samples;
+            m.seconds += e.second.seconds;
+            total += e.second.seconds;
+        }
+    }
+
+    if (!reportFile.empty()) {
+        std::vector<const decltype(merged)::value_type *> sorted;
+        for (const auto &m : merged)
+            sorted.push_back(&m);
+        std::stable_sort(sorted.begin(), sorted.end(),
+                         [](const auto *a, const auto *b) {
+                             return a->second.seconds > b->second.seconds;
+                         });
+
+        OutputStream *os = simout.create(reportFile);
+        std::ostream &out = *os->stream();
+        ccprintf(out, "# Estimated host time of the simulated events, "
+                 "timing every %d events\n", samplePeriod);
+        ccprintf(out, "# %12s %7s %10s  %s\n", "seconds", "share",
+                 "samples", "event (description)");
+        for (const auto *m : sorted) {
+            ccprintf(out, "%14.6f %6.2f%% %10d  %s (%s)\n",
+                     m->second.seconds,
+                     total > 0 ? 100 * m->second.seconds / total : 0.0,
+                     m->second.samples, m->first, m->second.description);
+        }
+        ccprintf(out, "%14.6f %6.2f%% %10s  total\n", total, 100.0, "");
+        simout.close(os);
+    }
+
+    if (!foldedFile.empty()) {
+        // one line per event with the frames separated by semicolons,
+        // weighted by the estimated host time in microseconds
+        OutputStream *os = simout.create(foldedFile);
+        std::ostream &out = *os->stream();
+        for (const auto &m : merged) {
+            const long long us = std::llround(m.second.seconds * 1e6);
+            if (us == 0)
+                continue;
+            std::string stack = m.first;
+            std::replace(stack.begin(), stack.end(), '.', ';');
+            ccprintf(out, "%s;%s %d\n", stack, m.second.description, us);
+        }
+        simout.close(os);
+    }
+}
+
+EventProfiler::EventProfilerStats::EventProfilerStats(
+        EventProfiler &_profiler)
+    : statistics::Group(&_profiler), profiler(_profiler),
+      ADD_STAT(hostSeconds, statistics::units::Second::get(),
+               "Estimated host time spent in the events of each object")
+{
+}
+
+void
+EventProfiler::EventProfilerStats::regStats()
+{
+    statistics::Group::regStats();
+
+    // all objects have been created by the time stats are registered
+    auto &names = profiler.objectNames;
+    for (const auto *obj : SimObject::getSimObjectList()) {
+        profiler.objectIndex.emplace(obj->name(), names.size());
+        names.push_back(obj->name());
+    }
+
+    hostSeconds
+        .init(names.size() + 1)
+        .flags(statistics::total | statistics::nozero);
+    for (std::size_t i = 0; i < names.size(); ++i)
+        hostSeconds.subname(i, names[i]);
+    hostSeconds.subname(names.size(), "unattributed");
+}
+
+} // namespace gem5
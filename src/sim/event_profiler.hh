@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_EVENT_PROFILER_HH__
+#define __SIM_EVENT_PROFILER_HH__
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "params/EventProfiler.hh"
+#include "sim/eventq_profiler.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+/**
+ * A self-profiler attributing host time to the SimObjects owning the
+ * simulated events.
+ *
+ * The profiler installs an EventQueueProfiler on each of the main
+ * event queues, which times a sample of the serviced events. The
+ * estimated host time is reported per SimObject in the stats, and per
+ * event and event description in a text report and a file of folded
+ * stacks that can be rendered by flame graph tools. The reports are
+ * written when the simulator exits and cover the whole simulation.
+ */
+class EventProfiler : public SimObject
+{
+  public:
+    PARAMS(EventProfiler);
+    EventProfiler(const Params &p);
+    ~EventProfiler();
+
+    void startup() override;
+    void preDumpStats() override;
+    void postResetStats() override;
+
+  private:
+    /**
+     * Determine the SimObject owning an event, which is the object
+     * with the longest name that is a prefix of the event name.
+     *
+     * @param event_name Name of the event
+     * @return Index of the owner in objectNames, or objectNames.size()
+     *         if there is no owner
+     */
+    std::size_t owner(const std::string &event_name) const;
+
+    /** Write the text report and the folded stacks. */
+    void writeReports() const;
+
+    const uint64_t samplePeriod;
+    const std::string reportFile;
+    const std::string foldedFile;
+
+    /** One profiler per main event queue. */
+    std::vector<std::unique_ptr<EventQueueProfiler>> profilers;
+
+    /** Names of all SimObjects and their index in the stats. */
+    std::vector<std::string> objectNames;
+    std::unordered_map<std::string, std::size_t> objectIndex;
+
+    struct EventProfilerStats : public statistics::Group
+    {
+        EventProfilerStats(EventProfiler &profiler);
+
+        void regStats() override;
+
+        EventProfiler &profiler;
+
+        /** Estimated host seconds spent in the events of each object */
+        statistics::Vector hostSeconds;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif // __SIM_EVENT_PROFILER_HH__
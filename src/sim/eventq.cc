@@ -41,6 +41,7 @@
 #include "base/trace.hh"
 #include "cpu/smt.hh"
 #include "debug/Checkpoint.hh"
+#include "sim/eventq_profiler.hh"
 
 namespace gem5
 {
@@ -246,7 +247,10 @@ EventQueue::serviceOne()
         setCurTick(event->when());
         if (debug::Event)
             event->trace("executed");
-        event->process();
+        if (profiler && profiler->sample())
+            profiler->process(event);
+        else
+            event->process();
         if (event->isExitEvent()) {
             assert(!event->flags.isSet(Event::Managed) ||
                    !event->flags.isSet(Event::IsMainQueue)); // would be silly
@@ -442,7 +446,7 @@ Event::dump() const
 }
 
 EventQueue::EventQueue(const std::string &n)
-    : objName(n), head(NULL), _curTick(0)
+    : objName(n), head(NULL), _curTick(0), profiler(nullptr)
 {
 }
 
@@ -466,6 +470,9 @@ EventQueue::handleAsyncInsertions()
     }
 
     async_queue_mutex.unlock();
+
+    for (auto &handler : asyncHandlers)
+        handler();
 }
 
 } // namespace gem5
@@ -43,6 +43,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/debug.hh"
 #include "base/flags.hh"
@@ -59,6 +60,7 @@ namespace gem5
 {
 
 class EventQueue;       // forward declaration
+class EventQueueProfiler;
 class BaseGlobalEvent;
 
 //! Simulation Quantum for multiple eventq simulation.
@@ -627,6 +629,9 @@ class EventQueue
     //! List of events added by other threads to this event queue.
     std::list<Event*> async_queue;
 
+    //! Functions run whenever the async queue is merged.
+    std::vector<std::function<void()>> asyncHandlers;
+
     /**
      * Lock protecting event handling.
      *
@@ -649,6 +654,9 @@ class EventQueue
      */
     UncontendedMutex service_mutex;
 
+    //! Optional profiler timing the events serviced by this queue.
+    EventQueueProfiler *profiler;
+
     //! Insert / remove event from the queue. Should only be called
     //! by thread operating this queue.
     void insert(Event *event);
@@ -748,6 +756,25 @@ class EventQueue
     void name(const std::string &st) { objName = st; }
     /** @}*/ //end of api_eventq group
 
+    /**
+     * Install a profiler that is handed the events to time, or remove
+     * it by passing nullptr.
+     */
+    void setProfiler(EventQueueProfiler *p) { profiler = p; }
+
+    /**
+     * Register a function to run on the thread servicing this queue
+     * whenever the async queue is merged, i.e. at every quantum
+     * boundary in parallel mode. This lets other threads hand work to
+     * this queue through their own lock-free channels rather than the
+     * async queue. Must be called before the simulation starts.
+     */
+    void
+    addAsyncHandler(std::function<void()> handler)
+    {
+        asyncHandlers.push_back(std::move(handler));
+    }
+
     /**
      * Schedule the given event on this queue. Safe to call from any thread.
      *
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_EVENTQ_PROFILER_HH__
+#define __SIM_EVENTQ_PROFILER_HH__
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+/**
+ * Host time profile of the events serviced by one event queue.
+ *
+ * On average only every samplePeriod-th event is timed, and the time
+ * is scaled by the period, which keeps the cost of the clock reads and
+ * of the book keeping small. The distance between samples is drawn
+ * uniformly from [1, 2 * samplePeriod - 1] so that the sampling does
+ * not alias with the periodic patterns of events that are common in
+ * simulation. Events are keyed by their name, which for
+ * events owned by a SimObject starts with the name of the object.
+ * Events that don't override name() are given a unique name per
+ * instance, so they are keyed by their description instead.
+ *
+ * The profile is only accessed by the thread servicing the queue
+ * while simulating, and by the main thread otherwise.
+ */
+class EventQueueProfiler
+{
+  public:
+    struct Entry
+    {
+        std::string description;
+        /** Sampled events since the start of the simulation. */
+        uint64_t samples = 0;
+        /** Estimated host seconds since the start of the simulation. */
+        double seconds = 0;
+        /** Estimated host seconds since the last stats reset. */
+        double intervalSeconds = 0;
+    };
+
+    typedef std::unordered_map<std::string, Entry> EntryMap;
+
+    explicit EventQueueProfiler(uint64_t sample_period)
+        : samplePeriod(sample_period ? sample_period : 1),
+          rngState(0x9e3779b97f4a7c15ULL), countdown(nextDistance())
+    {}
+
+    /** Count an event and determine if it should be timed. */
+    bool
+    sample()
+    {
+        if (--countdown)
+            return false;
+        countdown = nextDistance();
+        return true;
+    }
+
+    /** Process an event and attribute its host time. */
+    void
+    process(Event *event)
+    {
+        // find the entry before processing the event, as the event
+        // may be modified or even deleted by doing so
+        std::string name = event->name();
+        if (name.compare(0, 6, "Event_") == 0)
+            name = std::string("[unnamed] ") + event->description();
+
+        auto it = entries.find(name);
+        if (it == entries.end()) {
+            it = entries.emplace(std::move(name), Entry()).first;
+            it->second.description = event->description();
+        }
+        Entry &entry = it->second;
+
+        const auto start = std::chrono::steady_clock::now();
+        event->process();
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        const double seconds = elapsed.count() * samplePeriod;
+        entry.samples++;
+        entry.seconds += seconds;
+        entry.intervalSeconds += seconds;
+    }
+
+    const EntryMap &getEntries() const { return entries; }
+
+    /** Start a new stats interval. */
+    void
+    resetInterval()
+    {
+        for (auto &e : entries)
+            e.second.intervalSeconds = 0;
+    }
+
+  private:
+    /** Draw the number of events until the next sample. */
+    uint64_t
+    nextDistance()
+    {
+        // xorshift64, which is plenty for spreading the samples
+        rngState ^= rngState << 13;
+        rngState ^= rngState >> 7;
+        rngState ^= rngState << 17;
+        return 1 + rngState % (2 * samplePeriod - 1);
+    }
+
+    const uint64_t samplePeriod;
+    uint64_t rngState;
+    uint64_t countdown;
+    EntryMap entries;
+};
+
+} // namespace gem5
+
+#endif // __SIM_EVENTQ_PROFILER_HH__
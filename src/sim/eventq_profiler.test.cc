@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "sim/eventq.hh"
+#include "sim/eventq_profiler.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** An event owned by a named object */
+class OwnedEvent : public Event
+{
+  private:
+    const std::string objName;
+    const std::chrono::microseconds busy;
+
+  public:
+    int processed = 0;
+
+    OwnedEvent(const std::string &obj_name,
+               std::chrono::microseconds _busy =
+                   std::chrono::microseconds(0))
+        : objName(obj_name), busy(_busy)
+    {}
+
+    const std::string name() const override { return objName + ".event"; }
+    const char *description() const override { return "owned"; }
+
+    void
+    process() override
+    {
+        ++processed;
+        if (busy.count())
+            std::this_thread::sleep_for(busy);
+    }
+};
+
+/** An event which doesn't override name() */
+class UnnamedEvent : public Event
+{
+  public:
+    const char *description() const override { return "unnamed"; }
+    void process() override {}
+};
+
+/** An event which deletes itself when processed */
+class TransientEvent : public Event
+{
+  public:
+    TransientEvent() : Event(Default_Pri, AutoDelete) {}
+    const std::string name() const override { return "transient"; }
+    void process() override {}
+};
+
+} // anonymous namespace
+
+/** On average every samplePeriod-th event is sampled */
+TEST(EventQueueProfilerTest, SamplingRate)
+{
+    for (uint64_t period : {1, 4, 100}) {
+        EventQueueProfiler profiler(period);
+        const uint64_t events = 1000000;
+        uint64_t samples = 0;
+        for (uint64_t i = 0; i < events; ++i)
+            samples += profiler.sample();
+        EXPECT_NEAR(double(samples), double(events) / period,
+                    0.02 * events / period) << "period " << period;
+    }
+}
+
+/** A period of zero times every event */
+TEST(EventQueueProfilerTest, ZeroPeriod)
+{
+    EventQueueProfiler profiler(0);
+    for (int i = 0; i < 100; ++i)
+        EXPECT_TRUE(profiler.sample());
+}
+
+/** The distance between samples varies, so it cannot alias */
+TEST(EventQueueProfilerTest, NotPeriodic)
+{
+    EventQueueProfiler profiler(8);
+    uint64_t min_distance = UINT64_MAX, max_distance = 0, distance = 0;
+    for (int i = 0; i < 100000; ++i) {
+        ++distance;
+        if (profiler.sample()) {
+            min_distance = std::min(min_distance, distance);
+            max_distance = std::max(max_distance, distance);
+            distance = 0;
+        }
+    }
+    EXPECT_EQ(min_distance, 1);
+    EXPECT_EQ(max_distance, 15);
+}
+
+/**
+ * Events are attributed to their owner, unnamed events to their
+ * description, and the time is scaled by the period.
+ */
+TEST(EventQueueProfilerTest, Attribution)
+{
+    EventQueueProfiler profiler(10);
+    OwnedEvent cpu("system.cpu", std::chrono::microseconds(1000));
+    OwnedEvent mem("system.mem");
+    UnnamedEvent unnamed;
+
+    profiler.process(&cpu);
+    profiler.process(&cpu);
+    profiler.process(&mem);
+    profiler.process(&unnamed);
+
+    EXPECT_EQ(cpu.processed, 2);
+    EXPECT_EQ(mem.processed, 1);
+
+    const auto &entries = profiler.getEntries();
+    ASSERT_EQ(entries.size(), 3);
+
+    const auto &cpu_entry = entries.at("system.cpu.event");
+    EXPECT_EQ(cpu_entry.description, "owned");
+    EXPECT_EQ(cpu_entry.samples, 2);
+    // Each sample stands for ten events of at least a millisecond
+    EXPECT_GE(cpu_entry.seconds, 2 * 10 * 0.001);
+    EXPECT_EQ(cpu_entry.intervalSeconds, cpu_entry.seconds);
+
+    EXPECT_EQ(entries.at("system.mem.event").samples, 1);
+    EXPECT_EQ(entries.at("[unnamed] unnamed").samples, 1);
+
+    profiler.resetInterval();
+    EXPECT_EQ(entries.at("system.cpu.event").intervalSeconds, 0);
+    EXPECT_GE(entries.at("system.cpu.event").seconds, 2 * 10 * 0.001);
+}
+
+/** The profiler sees the events serviced by its queue */
+TEST(EventQueueProfilerTest, ServicedEvents)
+{
+    EventQueue eventq("profiled");
+    curEventQueue(&eventq);
+    EventQueueProfiler profiler(1);
+    eventq.setProfiler(&profiler);
+
+    OwnedEvent a("a"), b("b");
+    for (Tick when = 10; when <= 100; when += 10) {
+        eventq.schedule(&a, when);
+        if (when % 20 == 0)
+            eventq.schedule(new TransientEvent(), when);
+        while (!eventq.empty())
+            eventq.serviceOne();
+    }
+    eventq.schedule(&b, 200);
+    eventq.serviceOne();
+
+    eventq.setProfiler(nullptr);
+    eventq.schedule(&b, 300);
+    eventq.serviceOne();
+
+    const auto &entries = profiler.getEntries();
+    EXPECT_EQ(entries.at("a.event").samples, 10);
+    EXPECT_EQ(entries.at("b.event").samples, 1);
+    EXPECT_EQ(entries.at("transient").samples, 5);
+    EXPECT_EQ(b.processed, 2);
+
+    curEventQueue(nullptr);
+}
@@ -57,10 +57,18 @@ ProbePoint::ProbePoint(ProbeManager *manager, const std::string& _name)
 ProbeListenerObject::ProbeListenerObject(
         const ProbeListenerObjectParams &params)
     : SimObject(params),
-      manager(params.manager->getProbeManager())
+      manager(params.manager->getProbeManager()),
+      samplePeriod(1)
 {
 }
 
+void
+ProbeListenerObject::registerListener(ProbeListener *listener)
+{
+    listener->setSamplePeriod(samplePeriod);
+    listeners.push_back(listener);
+}
+
 ProbeListenerObject::~ProbeListenerObject()
 {
     for (auto l = listeners.begin(); l != listeners.end(); ++l) {
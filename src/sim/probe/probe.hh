@@ -63,6 +63,7 @@
 #ifndef __SIM_PROBE_PROBE_HH__
 #define __SIM_PROBE_PROBE_HH__
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -109,6 +110,22 @@ class ProbeListenerObject : public SimObject
     ProbeManager *manager;
     std::vector<ProbeListener *> listeners;
 
+    /**
+     * Sampling period applied to the listeners registered from then on.
+     * Listeners are notified of every event unless a derived class opts
+     * into sampling by setting this, which is only suitable for objects
+     * that gather statistics, and not for those that need every event,
+     * e.g., traces or instruction counts.
+     */
+    uint64_t samplePeriod;
+
+    /**
+     * Take ownership of a listener and apply the sampling period to
+     * it. Listeners may be registered at any time, not only in
+     * regProbeListeners().
+     */
+    void registerListener(ProbeListener *listener);
+
   public:
     ProbeListenerObject(const ProbeListenerObjectParams &params);
     virtual ~ProbeListenerObject();
@@ -132,9 +149,44 @@ class ProbeListener
     ProbeListener(ProbeListener&& other) noexcept = delete;
     ProbeListener& operator=(ProbeListener&& other) noexcept = delete;
 
+    /**
+     * @brief Only notify the listener of every period-th event of the
+     *        ProbePoint, which reduces the overhead of listeners that
+     *        are only interested in statistical information.
+     * @param period the sampling period, 0 and 1 notify on every event.
+     */
+    void
+    setSamplePeriod(uint64_t period)
+    {
+        samplePeriod = period;
+        sampleCountdown = period;
+    }
+
+    uint64_t getSamplePeriod() const { return samplePeriod; }
+
+    /**
+     * @brief called by the ProbePoint for each event to determine if
+     *        the listener should be notified of it.
+     * @return true if the event is sampled.
+     */
+    bool
+    sample()
+    {
+        if (samplePeriod <= 1)
+            return true;
+        if (--sampleCountdown)
+            return false;
+        sampleCountdown = samplePeriod;
+        return true;
+    }
+
   protected:
     ProbeManager *const manager;
     const std::string name;
+
+  private:
+    uint64_t samplePeriod = 1;
+    uint64_t sampleCountdown = 1;
 };
 
 /**
@@ -312,7 +364,8 @@ class ProbePointArg : public ProbePoint
     notify(const Arg &arg)
     {
         for (auto l = listeners.begin(); l != listeners.end(); ++l) {
-            (*l)->notify(arg);
+            if ((*l)->sample())
+                (*l)->notify(arg);
         }
     }
 };
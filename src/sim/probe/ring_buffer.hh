@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *
+ * Ring-buffer sinks that move the processing of probe notifications
+ * off the simulation thread.
+ *
+ * A ProbeRingBuffer copies compact records into a lock-free
+ * single-producer/single-consumer queue, and a consumer thread passes
+ * them to a handler. The simulation thread thus only pays for the copy
+ * unless the queue is full, in which case it waits for the consumer so
+ * that no records are lost. Owners must call flush() before inspecting
+ * any state the handler updates, e.g., before dumping or resetting
+ * stats and when draining.
+ *
+ * Each record carries the tick it was pushed at, and while a record is
+ * handled curTick() on the consumer thread returns that tick, so
+ * handlers can timestamp records. Handlers may use DPRINTF, as the
+ * debug logger serialises its messages, but their messages are
+ * interleaved with those of the simulation thread in the order they
+ * are printed, not by tick. Handlers must not rely on any other
+ * thread-local simulator state, such as the current event queue.
+ */
+
+#ifndef __SIM_PROBE_RING_BUFFER_HH__
+#define __SIM_PROBE_RING_BUFFER_HH__
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "base/spsc_queue.hh"
+#include "base/types.hh"
+#include "sim/cur_tick.hh"
+#include "sim/probe/probe.hh"
+
+namespace gem5
+{
+
+template <typename Record>
+class ProbeRingBuffer
+{
+  public:
+    typedef std::function<void(const Record &)> Handler;
+
+    /**
+     * @param entries Number of records the buffer can hold
+     * @param _handler Function called on the consumer thread for each
+     *        record, in order
+     */
+    ProbeRingBuffer(std::size_t entries, Handler _handler)
+        : queue(entries), handler(std::move(_handler)), pushed(0),
+          consumed(0), _stalls(0), sleeping(false), stopping(false),
+          consumer([this]() { consumerLoop(); })
+    {
+    }
+
+    ~ProbeRingBuffer()
+    {
+        flush();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv.notify_one();
+        consumer.join();
+    }
+
+    ProbeRingBuffer(const ProbeRingBuffer &) = delete;
+    ProbeRingBuffer &operator=(const ProbeRingBuffer &) = delete;
+
+    /**
+     * Append a record, waiting for the consumer if the buffer is full.
+     * Must only be called from the simulation thread.
+     */
+    void
+    push(const Record &record)
+    {
+        const Entry entry{curTick(), record};
+        if (!queue.tryPush(entry)) {
+            ++_stalls;
+            do {
+                wakeConsumer();
+                std::this_thread::yield();
+            } while (!queue.tryPush(entry));
+        }
+        ++pushed;
+        if (sleeping.load(std::memory_order_acquire))
+            wakeConsumer();
+    }
+
+    /**
+     * Wait until the consumer has handled all records pushed so far.
+     * Must only be called from the simulation thread.
+     */
+    void
+    flush()
+    {
+        while (consumed.load(std::memory_order_acquire) != pushed) {
+            wakeConsumer();
+            std::this_thread::yield();
+        }
+    }
+
+    /** Number of records that found the buffer full. */
+    uint64_t stalls() const { return _stalls; }
+
+    std::size_t capacity() const { return queue.capacity(); }
+
+  private:
+    /** A record and the tick it was pushed at. */
+    struct Entry
+    {
+        Tick tick;
+        Record record;
+    };
+
+    void
+    wakeConsumer()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_one();
+    }
+
+    void
+    consumerLoop()
+    {
+        // curTick() on this thread is the tick of the record being
+        // handled
+        Tick tick = 0;
+        Gem5Internal::_curTickPtr = &tick;
+        auto handle = [this, &tick](const Entry &entry) {
+            tick = entry.tick;
+            handler(entry.record);
+        };
+
+        // spin for a while before going to sleep, since records
+        // typically arrive in bursts
+        const unsigned spin_limit = 64;
+        unsigned idle = 0;
+        while (true) {
+            const std::size_t n = queue.consume(handle);
+            if (n) {
+                consumed.fetch_add(n, std::memory_order_release);
+                idle = 0;
+                continue;
+            }
+
+            if (++idle < spin_limit) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            if (stopping)
+                return;
+            sleeping.store(true, std::memory_order_seq_cst);
+            // the producer may have pushed a record before it could
+            // see the sleeping flag, so recheck and only sleep for a
+            // bounded time
+            if (queue.empty())
+                cv.wait_for(lock, std::chrono::milliseconds(1));
+            sleeping.store(false, std::memory_order_relaxed);
+            idle = 0;
+        }
+    }
+
+    SPSCQueue<Entry> queue;
+    Handler handler;
+
+    /** Records pushed, only accessed by the simulation thread. */
+    uint64_t pushed;
+    /** Records handled by the consumer thread. */
+    std::atomic<uint64_t> consumed;
+    uint64_t _stalls;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::atomic<bool> sleeping;
+    bool stopping;
+
+    std::thread consumer;
+};
+
+/**
+ * A probe listener that converts each notification into a compact
+ * record and appends it to a ProbeRingBuffer. The record type has to
+ * be constructible from the probe argument.
+ */
+template <typename Arg, typename Record = Arg>
+class ProbeRingBufferListener : public ProbeListenerArgBase<Arg>
+{
+  private:
+    ProbeRingBuffer<Record> &buffer;
+
+  public:
+    ProbeRingBufferListener(ProbeManager *pm, const std::string &name,
+                            ProbeRingBuffer<Record> &_buffer)
+        : ProbeListenerArgBase<Arg>(pm, name), buffer(_buffer)
+    {}
+
+    void notify(const Arg &arg) override { buffer.push(Record(arg)); }
+};
+
+} // namespace gem5
+
+#endif // __SIM_PROBE_RING_BUFFER_HH__
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "mem/packet.hh"
+#include "mem/request.hh"
+#include "sim/cur_tick.hh"
+#include "sim/probe/mem.hh"
+#include "sim/probe/ring_buffer.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Point curTick() of the calling thread at a local tick */
+class TickFixture : public testing::Test
+{
+  protected:
+    Tick tick = 0;
+
+    void SetUp() override { Gem5Internal::_curTickPtr = &tick; }
+    void TearDown() override { Gem5Internal::_curTickPtr = nullptr; }
+};
+
+typedef TickFixture ProbeRingBufferTest;
+
+} // anonymous namespace
+
+/** Records are handled in order, and flush() waits for all of them */
+TEST_F(ProbeRingBufferTest, InOrder)
+{
+    std::vector<uint64_t> handled;
+    ProbeRingBuffer<uint64_t> buffer(64, [&handled](const uint64_t &val) {
+        handled.push_back(val);
+    });
+
+    for (uint64_t i = 0; i < 100000; ++i) {
+        buffer.push(i);
+        if (i == 5000) {
+            buffer.flush();
+            EXPECT_EQ(handled.size(), 5001);
+        }
+    }
+    buffer.flush();
+
+    ASSERT_EQ(handled.size(), 100000);
+    for (uint64_t i = 0; i < handled.size(); ++i)
+        ASSERT_EQ(handled[i], i);
+}
+
+/** Handlers see the tick the record was pushed at as curTick() */
+TEST_F(ProbeRingBufferTest, CurTick)
+{
+    std::vector<Tick> ticks;
+    ProbeRingBuffer<uint64_t> buffer(16, [&ticks](const uint64_t &) {
+        ticks.push_back(curTick());
+    });
+
+    for (tick = 0; tick < 10000; tick += 500)
+        buffer.push(tick);
+    buffer.flush();
+
+    ASSERT_EQ(ticks.size(), 20);
+    for (size_t i = 0; i < ticks.size(); ++i)
+        EXPECT_EQ(ticks[i], i * 500);
+}
+
+/** Records pushed after the consumer went to sleep are handled */
+TEST_F(ProbeRingBufferTest, AfterIdle)
+{
+    uint64_t sum = 0;
+    ProbeRingBuffer<uint64_t> buffer(4, [&sum](const uint64_t &val) {
+        sum += val;
+    });
+
+    buffer.push(1);
+    buffer.flush();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    buffer.push(2);
+    buffer.flush();
+    EXPECT_EQ(sum, 3);
+}
+
+/**
+ * The records of the memory probes, which cannot be default constructed,
+ * go through unchanged
+ */
+TEST_F(ProbeRingBufferTest, PacketInfo)
+{
+    std::vector<probing::PacketInfo> handled;
+    ProbeRingBuffer<probing::PacketInfo> buffer(4,
+        [&handled](const probing::PacketInfo &pkt_info) {
+            handled.push_back(pkt_info);
+        });
+
+    for (Addr i = 0; i < 10; ++i) {
+        auto req = std::make_shared<Request>(0x1000 + i * 64, 8, 0, i);
+        Packet pkt(req, i % 2 ? MemCmd::WriteReq : MemCmd::ReadReq);
+        buffer.push(probing::PacketInfo(&pkt));
+    }
+    buffer.flush();
+
+    ASSERT_EQ(handled.size(), 10);
+    for (Addr i = 0; i < handled.size(); ++i) {
+        EXPECT_EQ(handled[i].addr, 0x1000 + i * 64);
+        EXPECT_EQ(handled[i].size, 8);
+        EXPECT_EQ(handled[i].id, i);
+        EXPECT_EQ(handled[i].cmd,
+                  i % 2 ? MemCmd::WriteReq : MemCmd::ReadReq);
+    }
+}
@@ -104,12 +104,12 @@ Root::RootStats::RootStats()
 }
 
 void
-Root::RootStats::resetStats()
+Root::RootStats::postResetStats()
 {
     statTime.setTimer();
     startTick = curTick();
 
-    statistics::Group::resetStats();
+    statistics::Group::postResetStats();
 }
 
 /*
@@ -99,7 +99,7 @@ class Root : public SimObject
   public: // Global statistics
     struct RootStats : public statistics::Group
     {
-        void resetStats() override;
+        void postResetStats() override;
 
         statistics::Formula simSeconds;
         statistics::Value simTicks;
@@ -83,7 +83,8 @@ class SimObjectResolver;
  *     <li>SimObject::initState() if starting afresh.
  *     <li>SimObject::loadState() if restoring from a checkpoint.
  *     </ul>
- * <li>SimObject::resetStats()
+ * <li>SimObject::preResetStats() and SimObject::postResetStats(), around
+ *     resetting the stats
  * <li>SimObject::startup()
  * <li>Drainable::drainResume() if resuming from a checkpoint.
  * </ol>
@@ -338,6 +339,12 @@ class SimObject : public EventManager, public Serializable, public Drainable,
      */
     static SimObject *find(const char *name);
 
+    /**
+     * Get the list of all instantiated simulation objects, in order
+     * of construction.
+     */
+    static const SimObjectList &getSimObjectList() { return simObjectList; }
+
     /**
      * There is a single object name resolver, and it is only set when
      * simulation is restoring from checkpoints.
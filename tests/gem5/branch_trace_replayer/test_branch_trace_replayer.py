@@ -0,0 +1,136 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+"""
+Replays a small synthetic branch trace, with loops, calls, returns and an
+indirect branch, through configs/example/bpred_trace_eval.py.
+"""
+
+import re
+from collections import defaultdict
+
+from testlib import *
+
+# The synthetic trace runs 500 iterations of an outer loop, each with a
+# call, an inner loop of 8 iterations, a branch taken every third time, an
+# indirect branch alternating between two targets and a return
+TRACE_BRANCHES = 6500
+TRACE_COND_BRANCHES = 5000
+# Even a bimodal predictor without history mispredicts at most the inner
+# loop exits, the third-time branches and the indirect targets
+MAX_MISPREDICTS = 2000
+
+
+class CheckMispredicts(verifier.Verifier):
+    """
+    Checks the mispredictions of each replayer in the stats file. Every
+    replayer must have replayed the whole trace with a plausible number of
+    mispredictions, and the replayers of the same predictor type must have
+    the same number of mispredictions, as each predictor draws from its own
+    random number generator.
+    """
+
+    def test(self, params):
+        tempdir = params.fixtures[constants.tempdir_fixture_name].path
+
+        bp_types = {}
+        with open(joinpath(tempdir, constants.gem5_simulation_stdout)) as f:
+            for line in f:
+                match = re.match(r"(replayer\d+): (\w+)$", line.strip())
+                if match:
+                    bp_types[match.group(1)] = match.group(2)
+
+        stats = defaultdict(dict)
+        with open(joinpath(tempdir, "stats.txt")) as f:
+            for line in f:
+                match = re.match(r"(replayer\d*)\.(\w+)\s+(\S+)", line)
+                if match:
+                    stats[match.group(1)][match.group(2)] = float(
+                        match.group(3)
+                    )
+        # A single replayer is not numbered
+        if "replayer" in stats:
+            stats["replayer0"] = stats.pop("replayer")
+
+        if set(stats) != set(bp_types):
+            test_util.fail(
+                f"Found stats of {sorted(stats)}, expected {sorted(bp_types)}"
+            )
+
+        mispredicts = {}
+        for name, replayer in stats.items():
+            if (
+                replayer["branches"] != TRACE_BRANCHES
+                or replayer["condBranches"] != TRACE_COND_BRANCHES
+            ):
+                test_util.fail(f"{name} did not replay the whole trace")
+            if not 0 < replayer["mispredicts"] <= MAX_MISPREDICTS:
+                test_util.fail(
+                    f"{name} ({bp_types[name]}) has "
+                    f"{replayer['mispredicts']:.0f} mispredictions"
+                )
+
+            counts = (replayer["mispredicts"], replayer["condMispredicts"])
+            expected = mispredicts.setdefault(bp_types[name], counts)
+            if counts != expected:
+                test_util.fail(
+                    f"{name} ({bp_types[name]}) has {counts[0]:.0f} "
+                    f"mispredictions instead of {expected[0]:.0f}"
+                )
+
+
+random_bp_types = ["LTAGE", "MultiperspectivePerceptron8KB"] * 2
+
+replay_params = [
+    ("serial", ["--bp-types", "TournamentBP", "LTAGE", "TAGE_SC_L_8KB"]),
+    (
+        "parallel",
+        ["--bp-types", "LocalBP", "TournamentBP", "BiModeBP", "--parallel"],
+    ),
+    # Predictors that use random numbers, twice each, serially and in
+    # parallel: both instances of a predictor must give the same results
+    ("random", ["--bp-types"] + random_bp_types),
+    ("random-parallel", ["--bp-types"] + random_bp_types + ["--parallel"]),
+    ("indirect", ["--indirect-bp-type", "SimpleIndirectPredictor"]),
+]
+
+for name, args in replay_params:
+    gem5_verify_config(
+        name="branch_trace_replayer-" + name,
+        verifiers=(
+            verifier.MatchRegex(
+                re.compile(r"because all branch traces replayed")
+            ),
+            CheckMispredicts(),
+        ),
+        config=joinpath(
+            config.base_dir, "configs", "example", "bpred_trace_eval.py"
+        ),
+        config_args=["--trace", joinpath(getcwd(), "branches.trc.gz")] + args,
+        valid_isas=(constants.all_compiled_tag,),
+        length=constants.quick_tag,
+    )
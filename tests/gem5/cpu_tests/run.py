@@ -117,69 +117,134 @@ parser = argparse.ArgumentParser()
 parser.add_argument("binary", type=str)
 parser.add_argument("--cpu")
 parser.add_argument("--mem", choices=valid_mem.keys(), default="SimpleMemory")
+parser.add_argument(
+    "--poison-insts",
+    action="store_true",
+    help="Check that the O3 CPU does not touch freed instructions",
+)
+parser.add_argument(
+    "--check-skip-idle",
+    action="store_true",
+    help="Check that the O3 and Minor CPU stats are the same when "
+    "skipping idle cycles or pipeline stages",
+)
+
+# Stats which only count the work skipping idle cycles or stages saved
+skip_idle_stats = (
+    ".skippedCycles",
+    ".idleFetch1Skips",
+    ".idleFetch2Skips",
+    ".idleDecodeSkips",
+)
 
 args = parser.parse_args()
 
-system = System()
 
-system.workload = SEWorkload.init_compatible(args.binary)
-
-system.clk_domain = SrcClockDomain()
-system.clk_domain.clock = "1GHz"
-system.clk_domain.voltage_domain = VoltageDomain()
-
-if args.cpu not in (
-    "X86AtomicSimpleCPU",
-    "ArmAtomicSimpleCPU",
-    "RiscvAtomicSimpleCPU",
-):
-    system.mem_mode = "timing"
-
-system.mem_ranges = [AddrRange("512MB")]
-
-system.cpu = valid_cpu[args.cpu]()
-
-if args.cpu in (
-    "X86AtomicSimpleCPU",
-    "ArmAtomicSimpleCPU",
-    "RiscvAtomicSimpleCPU",
-):
-    system.membus = SystemXBar()
-    system.cpu.icache_port = system.membus.cpu_side_ports
-    system.cpu.dcache_port = system.membus.cpu_side_ports
+def build_system(skip_idle=False):
+    system = System()
+
+    system.workload = SEWorkload.init_compatible(args.binary)
+
+    system.clk_domain = SrcClockDomain()
+    system.clk_domain.clock = "1GHz"
+    system.clk_domain.voltage_domain = VoltageDomain()
+
+    if args.cpu not in (
+        "X86AtomicSimpleCPU",
+        "ArmAtomicSimpleCPU",
+        "RiscvAtomicSimpleCPU",
+    ):
+        system.mem_mode = "timing"
+
+    system.mem_ranges = [AddrRange("512MB")]
+
+    system.cpu = valid_cpu[args.cpu]()
+    if args.poison_insts:
+        system.cpu.poisonRecycledInsts = True
+    if skip_idle and "O3" in args.cpu:
+        system.cpu.skipIdleCycles = True
+    if skip_idle and "Minor" in args.cpu:
+        system.cpu.skipIdleStages = True
+
+    if args.cpu in (
+        "X86AtomicSimpleCPU",
+        "ArmAtomicSimpleCPU",
+        "RiscvAtomicSimpleCPU",
+    ):
+        system.membus = SystemXBar()
+        system.cpu.icache_port = system.membus.cpu_side_ports
+        system.cpu.dcache_port = system.membus.cpu_side_ports
+    else:
+        system.cpu.l1d = L1DCache()
+        system.cpu.l1i = L1ICache()
+        system.l1_to_l2 = L2XBar()
+        system.l2cache = L2Cache()
+        system.membus = SystemXBar()
+        system.cpu.l1d.connectCPU(system.cpu)
+        system.cpu.l1d.connectBus(system.l1_to_l2)
+        system.cpu.l1i.connectCPU(system.cpu)
+        system.cpu.l1i.connectBus(system.l1_to_l2)
+        system.l2cache.connectCPUSideBus(system.l1_to_l2)
+        system.l2cache.connectMemSideBus(system.membus)
+
+    system.cpu.createInterruptController()
+    if args.cpu in (
+        "X86AtomicSimpleCPU",
+        "X86TimingSimpleCPU",
+        "X86DerivO3CPU",
+    ):
+        system.cpu.interrupts[0].pio = system.membus.mem_side_ports
+        system.cpu.interrupts[0].int_master = system.membus.cpu_side_ports
+        system.cpu.interrupts[0].int_slave = system.membus.mem_side_ports
+
+    system.mem_ctrl = valid_mem[args.mem]()
+    system.mem_ctrl.range = system.mem_ranges[0]
+    system.mem_ctrl.port = system.membus.mem_side_ports
+    system.system_port = system.membus.cpu_side_ports
+
+    process = Process()
+    process.cmd = [args.binary]
+    system.cpu.workload = process
+    system.cpu.createThreads()
+
+    return system
+
+
+if not args.check_skip_idle:
+    root = Root(full_system=False, system=build_system())
 else:
-    system.cpu.l1d = L1DCache()
-    system.cpu.l1i = L1ICache()
-    system.l1_to_l2 = L2XBar()
-    system.l2cache = L2Cache()
-    system.membus = SystemXBar()
-    system.cpu.l1d.connectCPU(system.cpu)
-    system.cpu.l1d.connectBus(system.l1_to_l2)
-    system.cpu.l1i.connectCPU(system.cpu)
-    system.cpu.l1i.connectBus(system.l1_to_l2)
-    system.l2cache.connectCPUSideBus(system.l1_to_l2)
-    system.l2cache.connectMemSideBus(system.membus)
-
-system.cpu.createInterruptController()
-if args.cpu in ("X86AtomicSimpleCPU", "X86TimingSimpleCPU", "X86DerivO3CPU"):
-    system.cpu.interrupts[0].pio = system.membus.mem_side_ports
-    system.cpu.interrupts[0].int_master = system.membus.cpu_side_ports
-    system.cpu.interrupts[0].int_slave = system.membus.mem_side_ports
-
-system.mem_ctrl = valid_mem[args.mem]()
-system.mem_ctrl.range = system.mem_ranges[0]
-system.mem_ctrl.port = system.membus.mem_side_ports
-system.system_port = system.membus.cpu_side_ports
-
-process = Process()
-process.cmd = [args.binary]
-system.cpu.workload = process
-system.cpu.createThreads()
-
-root = Root(full_system=False, system=system)
+    # Run the same workload on two identical systems, one of them skipping
+    # idle work, and compare their stats afterwards
+    root = Root(
+        full_system=False,
+        system=[build_system(), build_system(skip_idle=True)],
+    )
 m5.instantiate()
 
 exit_event = m5.simulate()
 
 if exit_event.getCause() != "exiting with last active thread context":
     exit(1)
+
+if args.check_skip_idle:
+    m5.stats.dump()
+
+    stats = {}
+    with open(os.path.join(m5.options.outdir, "stats.txt")) as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) > 1 and fields[0].startswith("system"):
+                stats[fields[0]] = fields[1]
+
+    mismatches = [
+        name
+        for name, value in stats.items()
+        if name.startswith("system0.")
+        and not name.endswith(skip_idle_stats)
+        and stats.get("system1." + name[len("system0.") :]) != value
+    ]
+    for name in mismatches:
+        print(f"{name} differs when skipping idle work")
+    if mismatches:
+        exit(1)
+    print("Skipping idle work does not change the stats")
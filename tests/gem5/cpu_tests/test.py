@@ -41,6 +41,8 @@ Test file containing simple workloads to run on CPU models.
 Each test takes ~10 seconds to run.
 """
 
+import re
+
 from testlib import *
 
 workloads = ("Bubblesort", "FloatMM")
@@ -95,3 +97,37 @@ for isa in valid_isas:
                 valid_isas=(constants.all_compiled_tag,),
                 fixtures=[workload_binary],
             )
+
+            # Poison the recycled O3 instructions, which panics if one is
+            # written to after being freed
+            if "O3" in cpu:
+                gem5_verify_config(
+                    name=f"cpu_test_{cpu}_{workload}_poison",
+                    verifiers=verifiers,
+                    config=joinpath(getcwd(), "run.py"),
+                    config_args=[f"--cpu={cpu}", "--poison-insts", binary],
+                    valid_isas=(constants.all_compiled_tag,),
+                    fixtures=[workload_binary],
+                )
+
+            # Skipping idle O3 cycles or Minor stages must not change any
+            # stat
+            if "O3" in cpu or "Minor" in cpu:
+                gem5_verify_config(
+                    name=f"cpu_test_{cpu}_{workload}_skip_idle",
+                    verifiers=(
+                        verifier.MatchRegex(
+                            re.compile(
+                                "Skipping idle work does not change the stats"
+                            )
+                        ),
+                    ),
+                    config=joinpath(getcwd(), "run.py"),
+                    config_args=[
+                        f"--cpu={cpu}",
+                        "--check-skip-idle",
+                        binary,
+                    ],
+                    valid_isas=(constants.all_compiled_tag,),
+                    fixtures=[workload_binary],
+                )
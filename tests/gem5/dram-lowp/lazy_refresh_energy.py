@@ -0,0 +1,132 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Run the same traffic, with long idle periods, to two DRAM controllers,
+one refreshing its idle ranks through the refresh event loop and one
+accounting for them lazily, and check that DRAMPower reports the same
+energy and that the refresh stats match.
+"""
+
+import argparse
+import sys
+
+import m5
+from m5.objects import *
+
+parser = argparse.ArgumentParser()
+parser.add_argument(
+    "--idle",
+    type=int,
+    default=100000000,
+    help="Length of each idle period in ticks, spanning many tREFI",
+)
+parser.add_argument(
+    "--tolerance",
+    type=float,
+    default=1e-9,
+    help="Relative tolerance when comparing energies",
+)
+args = parser.parse_args()
+
+mem_size = 256 * 1024 * 1024
+
+system = System()
+system.clk_domain = SrcClockDomain(
+    clock="2GHz", voltage_domain=VoltageDomain()
+)
+system.mem_ranges = [AddrRange(0, size=2 * mem_size)]
+system.mmap_using_noreserve = True
+
+# the crossbar has separate layers for each controller, so the two
+# streams of requests do not interfere with each other
+system.membus = IOXBar()
+system.tgens = [PyTrafficGen() for _ in range(2)]
+system.mem_ctrls = [MemCtrl() for _ in range(2)]
+for i, (tgen, ctrl) in enumerate(zip(system.tgens, system.mem_ctrls)):
+    # the two ranges only differ in bits above the row bits, so both
+    # controllers see the same banks, rows and columns
+    ctrl.dram = DDR4_2400_16x4(
+        range=AddrRange(i * mem_size, size=mem_size),
+        ranks_per_channel=2,
+        null=True,
+        lazy_refresh=(i == 1),
+    )
+    tgen.port = system.membus.cpu_side_ports
+    ctrl.port = system.membus.mem_side_ports
+
+system.system_port = system.membus.cpu_side_ports
+
+root = Root(full_system=False, system=system)
+root.system.mem_mode = "timing"
+
+m5.instantiate()
+
+
+def traffic(tgen, base):
+    for duration, read_percent in ((2000000, 100), (2000000, 50)):
+        yield tgen.createLinear(
+            duration,
+            base,
+            base + mem_size - 1,
+            64,
+            1000,
+            1000,
+            read_percent,
+            0,
+        )
+        yield tgen.createIdle(args.idle)
+    yield tgen.createExit(0)
+
+
+for i, tgen in enumerate(system.tgens):
+    tgen.start(traffic(tgen, i * mem_size))
+
+m5.simulate()
+
+# dumping the stats brings the lazily refreshed ranks up to date
+m5.stats.dump()
+
+stat_names = [
+    "totalEnergy",
+    "refreshEnergy",
+    "actBackEnergy",
+    "preBackEnergy",
+]
+failed = False
+for rank in range(2):
+    for name in stat_names:
+        values = [
+            ctrl.dram.getCCObject().resolveStat(f"rank{rank}.{name}").value
+            for ctrl in system.mem_ctrls
+        ]
+        if abs(values[0] - values[1]) > args.tolerance * abs(values[0]):
+            print(f"rank{rank}.{name} differs: {values[0]} != {values[1]}")
+            failed = True
+
+if failed:
+    sys.exit(1)
+print("Lazy refresh energy matches")
@@ -24,6 +24,8 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+import re
+
 from testlib import *
 
 verifiers = (verifier.MatchStdoutNoPerf(joinpath(getcwd(), "ref", "simout")),)
@@ -47,3 +49,15 @@ gem5_verify_config(
     valid_isas=(constants.all_compiled_tag,),
     valid_hosts=constants.supported_hosts,
 )
+
+gem5_verify_config(
+    name="test-lazy_refresh-energy",
+    fixtures=(),
+    verifiers=(
+        verifier.MatchRegex(re.compile(r"Lazy refresh energy matches")),
+    ),
+    config=joinpath(getcwd(), "lazy_refresh_energy.py"),
+    config_args=[],
+    valid_isas=(constants.all_compiled_tag,),
+    valid_hosts=constants.supported_hosts,
+)
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Collects the records of the host performance benchmarks, written by the
+`RecordHostPerf` verifier, into a single JSON file, and optionally compares
+them against a baseline collected earlier on the same host.
+
+```
+./collect_host_perf.py ../../testing-results --output host_perf.json \
+    --baseline host_perf_baseline.json --threshold 10
+```
+
+A benchmark regressed if its host time grew by more than the threshold, in
+percent, over the baseline, in which case the script exits with status 1.
+"""
+
+import argparse
+import json
+import os
+import sys
+
+parser = argparse.ArgumentParser(
+    description="Collect and compare host performance benchmark results."
+)
+parser.add_argument(
+    "results",
+    type=str,
+    nargs="?",
+    default="testing-results",
+    help="The testing results directory to search.",
+)
+parser.add_argument(
+    "--output", type=str, help="File to write the collected records to."
+)
+parser.add_argument(
+    "--baseline", type=str, help="Collected records to compare against."
+)
+parser.add_argument(
+    "--threshold",
+    type=float,
+    default=10.0,
+    help="Host time increase, in percent, reported as a regression.",
+)
+parser.add_argument(
+    "--record-name",
+    type=str,
+    default="host_perf.json",
+    help="File name of the per-run records.",
+)
+
+args = parser.parse_args()
+
+records = {}
+for root, _, files in os.walk(args.results):
+    if args.record_name not in files:
+        continue
+    with open(os.path.join(root, args.record_name)) as f:
+        record = json.load(f)
+    if record["benchmark"] in records:
+        print(
+            f"Warning: duplicate record for {record['benchmark']} in {root}",
+            file=sys.stderr,
+        )
+    records[record["benchmark"]] = record
+
+if not records:
+    print(f"No records found in {args.results}", file=sys.stderr)
+    sys.exit(1)
+
+print(
+    f"{'benchmark':30} {'host s':>10} {'rate (k/s)':>12} {'of':10} "
+    f"{'change':>8}"
+)
+
+baseline = {}
+if args.baseline:
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+
+regressions = []
+for name in sorted(records):
+    seconds = records[name]["stats"]["hostSeconds"]
+    change = ""
+    if name in baseline:
+        base_seconds = baseline[name]["stats"]["hostSeconds"]
+        delta = 100.0 * (seconds - base_seconds) / base_seconds
+        change = f"{delta:+.1f}%"
+        if delta > args.threshold:
+            regressions.append(name)
+    rate = records[name]["rate"] / 1e3
+    print(
+        f"{name:30} {seconds:10.2f} {rate:12.1f} "
+        f"{records[name]['rate_stat']:10} {change:>8}"
+    )
+
+if args.output:
+    with open(args.output, "w") as f:
+        json.dump(records, f, indent=4, sort_keys=True)
+
+if regressions:
+    print(
+        f"Host time regressed by more than {args.threshold}% for: "
+        + ", ".join(regressions)
+    )
+    sys.exit(1)
@@ -0,0 +1,138 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Runs a static binary in SE mode on a single core SimpleBoard for the host
+performance benchmarks. The CPU model, cache hierarchy and memory system are
+selected from the command line. The host performance numbers are taken from
+the stats of the run, see `RecordHostPerf` in tests/gem5/verifier.py.
+"""
+
+import argparse
+
+from gem5.components.boards.simple_board import SimpleBoard
+from gem5.components.memory import SingleChannelDDR4_2400
+from gem5.components.memory.simple import SingleChannelSimpleMemory
+from gem5.components.processors.cpu_types import (
+    get_cpu_types_str_set,
+    get_cpu_type_from_str,
+)
+from gem5.components.processors.simple_processor import SimpleProcessor
+from gem5.isas import get_isa_from_str, get_isas_str_set
+from gem5.resources.resource import BinaryResource
+from gem5.simulate.simulator import Simulator
+
+parser = argparse.ArgumentParser(
+    description="Run a binary for the host performance benchmarks."
+)
+
+parser.add_argument("binary", type=str, help="Path to the static binary.")
+parser.add_argument(
+    "--isa", type=str, choices=get_isas_str_set(), required=True
+)
+parser.add_argument(
+    "--cpu", type=str, choices=get_cpu_types_str_set(), required=True
+)
+parser.add_argument(
+    "--cache",
+    type=str,
+    choices=["none", "classic", "mesi_two_level", "chi"],
+    default="none",
+    help="The cache hierarchy. The Ruby ones need a matching build.",
+)
+parser.add_argument(
+    "--memory", type=str, choices=["simple", "ddr4"], default="simple"
+)
+
+args = parser.parse_args()
+
+
+def get_cache_hierarchy(name: str):
+    if name == "none":
+        from gem5.components.cachehierarchies.classic.no_cache import NoCache
+
+        return NoCache()
+    elif name == "classic":
+        from gem5.components.cachehierarchies.classic.private_l1_private_l2_cache_hierarchy import (
+            PrivateL1PrivateL2CacheHierarchy,
+        )
+
+        return PrivateL1PrivateL2CacheHierarchy(
+            l1d_size="32kB", l1i_size="32kB", l2_size="512kB"
+        )
+    elif name == "mesi_two_level":
+        from gem5.components.cachehierarchies.ruby.mesi_two_level_cache_hierarchy import (
+            MESITwoLevelCacheHierarchy,
+        )
+
+        return MESITwoLevelCacheHierarchy(
+            l1i_size="32kB",
+            l1i_assoc="8",
+            l1d_size="32kB",
+            l1d_assoc="8",
+            l2_size="512kB",
+            l2_assoc="16",
+            num_l2_banks=1,
+        )
+    elif name == "chi":
+        from gem5.components.cachehierarchies.chi.private_l1_cache_hierarchy import (
+            PrivateL1CacheHierarchy,
+        )
+
+        return PrivateL1CacheHierarchy(size="32kB", assoc=8)
+    raise ValueError(f"Unknown cache hierarchy '{name}'.")
+
+
+if args.memory == "simple":
+    memory = SingleChannelSimpleMemory(
+        latency="30ns", latency_var="0s", bandwidth="32GiB/s", size="512MiB"
+    )
+else:
+    memory = SingleChannelDDR4_2400(size="512MiB")
+
+processor = SimpleProcessor(
+    cpu_type=get_cpu_type_from_str(args.cpu),
+    isa=get_isa_from_str(args.isa),
+    num_cores=1,
+)
+
+board = SimpleBoard(
+    clk_freq="3GHz",
+    processor=processor,
+    memory=memory,
+    cache_hierarchy=get_cache_hierarchy(args.cache),
+)
+
+board.set_se_binary_workload(BinaryResource(local_path=args.binary))
+
+simulator = Simulator(board=board)
+simulator.run()
+
+print(
+    "Exiting @ tick {} because {}.".format(
+        simulator.get_current_tick(), simulator.get_last_exit_event_cause()
+    )
+)
@@ -0,0 +1,109 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+Dumps the stats of a large system many times for the host performance
+benchmarks, to measure the cost of the stats framework. The system is made
+of many memory testers, each with its own L1 cache, behind a shared L2 cache
+and memory. The number of host threads used to dump the stats is set with
+gem5's --stats-threads option.
+"""
+
+import argparse
+
+import m5
+from m5.objects import *
+
+parser = argparse.ArgumentParser(
+    description="Dump the stats of a large system many times."
+)
+parser.add_argument(
+    "--testers",
+    type=int,
+    default=64,
+    help="The number of memory testers, at most the cache line size.",
+)
+parser.add_argument(
+    "--dumps", type=int, default=100, help="The number of stats dumps."
+)
+parser.add_argument(
+    "--interval",
+    type=str,
+    default="10us",
+    help="The simulated time between two dumps.",
+)
+
+args = parser.parse_args()
+
+system = System(
+    cpu=[MemTest(progress_interval=0) for i in range(args.testers)],
+    physmem=SimpleMemory(),
+    membus=SystemXBar(),
+)
+system.voltage_domain = VoltageDomain()
+system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=system.voltage_domain
+)
+
+system.toL2Bus = L2XBar()
+system.l2c = Cache(
+    size="1MB",
+    assoc=16,
+    tag_latency=10,
+    data_latency=10,
+    response_latency=10,
+    mshrs=64,
+    tgts_per_mshr=16,
+)
+system.l2c.cpu_side = system.toL2Bus.mem_side_ports
+system.l2c.mem_side = system.membus.cpu_side_ports
+
+for cpu in system.cpu:
+    cpu.l1c = Cache(
+        size="32kB",
+        assoc=4,
+        tag_latency=2,
+        data_latency=2,
+        response_latency=2,
+        mshrs=4,
+        tgts_per_mshr=20,
+    )
+    cpu.l1c.cpu_side = cpu.port
+    cpu.l1c.mem_side = system.toL2Bus.cpu_side_ports
+
+system.system_port = system.membus.cpu_side_ports
+system.physmem.port = system.membus.mem_side_ports
+
+root = Root(full_system=False, system=system)
+root.system.mem_mode = "timing"
+
+m5.instantiate()
+
+interval = m5.ticks.fromSeconds(m5.util.convert.toLatency(args.interval))
+for i in range(args.dumps):
+    exit_event = m5.simulate(interval)
+    if exit_event.getCause() != "simulate() limit reached":
+        m5.util.fatal(f"Unexpected exit: {exit_event.getCause()}")
+    m5.stats.dump()
@@ -0,0 +1,203 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Host performance benchmarks, measuring the speed of the simulator itself
+rather than of the simulated system. Each benchmark is a short, fixed
+simulation covering one part of gem5: the CPU models running a small static
+binary, the classic and Ruby cache hierarchies, the DRAM controller driven by
+traffic generators, the Garnet network, and the stats dumps.
+
+The simulation results are not checked. Instead, each run records its host
+time and simulation rate in `host_perf.json` in its testing results folder.
+The rate is in simulated instructions per host second for the CPU runs, and
+in simulated ticks per host second for the traffic generator, Garnet and stats
+runs, which have no CPUs. Run them with, e.g.,
+
+```
+./main.py run gem5/host_perf --length=long
+```
+
+and collect the records with `host_perf/collect_host_perf.py`. Note that the
+numbers are only comparable between runs on the same, otherwise idle, host.
+"""
+
+from testlib import *
+
+base_url = config.resource_url + "/test-progs/cpu-tests/bin/"
+base_path = joinpath(config.bin_path, "cpu_tests")
+workload = "Bubblesort"
+
+
+def benchmark_binary(isa: str):
+    path = joinpath(base_path, isa)
+    program = DownloadedProgram(f"{base_url}{isa}/{workload}", path, workload)
+    return program, joinpath(program.path, workload)
+
+
+def host_perf_se(
+    name: str,
+    isa: str,
+    cpu: str,
+    cache: str,
+    memory: str,
+    build_isa: str,
+    protocol: str = None,
+):
+    program, binary = benchmark_binary(isa)
+    parameters = {
+        "workload": workload,
+        "isa": isa,
+        "cpu": cpu,
+        "cache": cache,
+        "memory": memory,
+    }
+    gem5_verify_config(
+        name=f"host_perf_{name}",
+        verifiers=(verifier.RecordHostPerf(name, parameters),),
+        config=joinpath(getcwd(), "configs", "host_perf_se.py"),
+        config_args=[
+            f"--isa={isa}",
+            f"--cpu={cpu}",
+            f"--cache={cache}",
+            f"--memory={memory}",
+            binary,
+        ],
+        valid_isas=(build_isa,),
+        fixtures=[program],
+        protocol=protocol,
+        length=constants.long_tag,
+    )
+
+
+# The CPU models, with the memory system kept as simple as possible.
+host_perf_se(
+    "atomic", "riscv", "atomic", "none", "simple", constants.all_compiled_tag
+)
+for cpu in ("timing", "minor", "o3"):
+    host_perf_se(
+        cpu, "riscv", cpu, "classic", "simple", constants.all_compiled_tag
+    )
+
+# The cache hierarchies and the DRAM controller behind a timing CPU. The
+# default ALL build uses the MESI_Two_Level protocol, while CHI needs the
+# ARM build.
+host_perf_se(
+    "classic_ddr4",
+    "riscv",
+    "timing",
+    "classic",
+    "ddr4",
+    constants.all_compiled_tag,
+)
+host_perf_se(
+    "mesi_two_level_ddr4",
+    "riscv",
+    "timing",
+    "mesi_two_level",
+    "ddr4",
+    constants.all_compiled_tag,
+)
+host_perf_se("chi_ddr4", "arm", "timing", "chi", "ddr4", constants.arm_tag)
+
+# The DRAM controller on its own, driven by traffic generators.
+for generator in ("LinearGenerator", "RandomGenerator"):
+    name = f"dram_{generator}"
+    gem5_verify_config(
+        name=f"host_perf_{name}",
+        verifiers=(
+            verifier.RecordHostPerf(
+                name,
+                {
+                    "generator": generator,
+                    "cache": "NoCache",
+                    "memory": "SingleChannelDDR4_2400",
+                },
+                rate_stat="simTicks",
+            ),
+        ),
+        config=joinpath(
+            config.base_dir,
+            "tests",
+            "gem5",
+            "traffic_gen",
+            "simple_traffic_run.py",
+        ),
+        config_args=[
+            generator,
+            "1",
+            "NoCache",
+            "gem5.components.memory",
+            "SingleChannelDDR4_2400",
+            "512MiB",
+        ],
+        valid_isas=(constants.all_compiled_tag,),
+        length=constants.long_tag,
+    )
+
+# The Garnet network with synthetic traffic.
+gem5_verify_config(
+    name="host_perf_garnet_mesh",
+    verifiers=(
+        verifier.RecordHostPerf(
+            "garnet_mesh",
+            {"network": "garnet", "topology": "Mesh_XY", "routers": 16},
+            rate_stat="simTicks",
+        ),
+    ),
+    config=joinpath(
+        config.base_dir, "configs", "example", "garnet_synth_traffic.py"
+    ),
+    config_args=[
+        "--network=garnet",
+        "--topology=Mesh_XY",
+        "--num-cpus=16",
+        "--num-dirs=16",
+        "--mesh-rows=4",
+        "--sim-cycles=1000000",
+    ],
+    valid_isas=(constants.null_tag,),
+    length=constants.long_tag,
+)
+
+# Dumping the stats of a large system, sequentially and on all host cores.
+for threads in (1, 0):
+    name = f"stats_dump_threads{threads}"
+    gem5_verify_config(
+        name=f"host_perf_{name}",
+        verifiers=(
+            verifier.RecordHostPerf(
+                name,
+                {"testers": 64, "dumps": 100, "stats_threads": threads},
+                rate_stat="simTicks",
+            ),
+        ),
+        config=joinpath(getcwd(), "configs", "host_perf_stats.py"),
+        config_args=[],
+        gem5_args=[f"--stats-threads={threads}"],
+        valid_isas=(constants.null_tag,),
+        length=constants.long_tag,
+    )
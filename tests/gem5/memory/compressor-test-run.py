@@ -0,0 +1,77 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+"""
+Checks that the size-only compression path of the cache compressors gives
+the same sizes, latencies and stats as the full compression path. Each
+compressor is paired with an identically configured one: the tester
+compresses every line with the first and only sizes it with the second.
+"""
+
+import sys
+
+import m5
+from m5.objects import *
+from m5.stats.gem5stats import get_stats_group
+
+
+def compressors():
+    return [
+        BDI(),
+        Base64Delta8(),
+        Base32Delta16(),
+        Base16Delta8(),
+        CPack(),
+        FPC(),
+        FPCD(),
+        RepeatedQwordsCompressor(),
+        ZeroCompressor(),
+        PerfectCompressor(max_compression_ratio=2),
+    ]
+
+
+system = System(cache_line_size=64)
+system.voltage_domain = VoltageDomain()
+system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=system.voltage_domain
+)
+system.tester = CompressorTest(
+    compressors=compressors(), size_compressors=compressors()
+)
+
+root = Root(full_system=False, system=system)
+
+m5.instantiate()
+exit_event = m5.simulate()
+if exit_event.getCause() != "compressor test complete":
+    sys.exit(1)
+
+tester = system.tester
+for full, size_only in zip(tester.compressors, tester.size_compressors):
+    if get_stats_group(full).to_json() != get_stats_group(size_only).to_json():
+        print(f"{full.path()} and {size_only.path()} have different stats")
+        sys.exit(1)
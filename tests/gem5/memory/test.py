@@ -29,6 +29,8 @@ Test file for simple memory test
 TODO: Add stats checking
 """
 
+import re
+
 from testlib import *
 
 gem5_verify_config(
@@ -70,6 +72,46 @@ gem5_verify_config(
     length=constants.long_tag,
 )
 
+gem5_verify_config(
+    name="compressor_test",
+    verifiers=(),  # No need for verfiers this will return non-zero on fail
+    config=joinpath(getcwd(), "compressor-test-run.py"),
+    config_args=[],
+    valid_isas=(constants.null_tag,),
+    length=constants.quick_tag,
+)
+
+for name, args in (("serial", []), ("parallel", ["--parallel"])):
+    gem5_verify_config(
+        name="thread_bridge-" + name,
+        verifiers=(),  # No need for verfiers this will return non-zero on fail
+        config=joinpath(getcwd(), "thread-bridge-run.py"),
+        config_args=args,
+        valid_isas=(constants.null_tag,),
+        length=constants.quick_tag,
+    )
+
+trace_sweep_params = [
+    ("atomic", []),
+    ("timing", ["--hwp", "None", "StridePrefetcher"]),
+    ("parallel", ["--assocs", "2", "4", "--parallel"]),
+]
+
+for name, args in trace_sweep_params:
+    gem5_verify_config(
+        name="trace_cache_sweep-" + name,
+        verifiers=(
+            verifier.MatchRegex(re.compile(r"because all traces replayed")),
+        ),
+        config=joinpath(
+            config.base_dir, "configs", "example", "trace_cache_sweep.py"
+        ),
+        config_args=["--trace", joinpath(getcwd(), "tgen-simple-mem.trc")]
+        + args,
+        valid_isas=(constants.null_tag,),
+        length=constants.quick_tag,
+    )
+
 null_tests = [
     ("garnet_synth_traffic", None, ["--sim-cycles", "5000000"]),
     ("memcheck", None, ["--maxtick", "2000000000", "--prefetchers"]),
@@ -0,0 +1,75 @@
+# Copyright (c) 2006-2007 The Regents of The University of Michigan
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# A MemTest tester reaches a SimpleMemory through a ThreadBridge. The
+# tester checks the data of every load, so packets lost or corrupted on
+# their way through the bridge fail the run. With --parallel the memory
+# side is simulated on its own event queue, and the timing packets cross
+# the bridge through its channels at the quantum boundaries.
+
+import argparse
+
+import m5
+from m5.objects import *
+
+parser = argparse.ArgumentParser()
+parser.add_argument(
+    "--parallel",
+    action="store_true",
+    help="Simulate the memory side on its own event queue",
+)
+args = parser.parse_args()
+
+system = System(mem_ranges=[AddrRange("16MB")])
+system.voltage_domain = VoltageDomain()
+system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=system.voltage_domain
+)
+
+system.tester = MemTest(
+    max_loads=1e4, percent_functional=0, progress_interval=1e3
+)
+system.bridge = ThreadBridge(in_eventq_index=0, delay="1us")
+system.membus = IOXBar()
+system.physmem = SimpleMemory(range=system.mem_ranges[0])
+
+system.tester.port = system.bridge.in_port
+system.bridge.out_port = system.membus.cpu_side_ports
+system.physmem.port = system.membus.mem_side_ports
+system.system_port = system.membus.cpu_side_ports
+
+root = Root(full_system=False, system=system)
+root.system.mem_mode = "timing"
+
+if args.parallel:
+    for obj in (system.bridge, system.membus, system.physmem):
+        obj.eventq_index = 1
+    root.sim_quantum = m5.ticks.fromSeconds(m5.util.convert.toLatency("1us"))
+
+m5.instantiate()
+exit_event = m5.simulate()
+if exit_event.getCause() != "maximum number of loads reached":
+    exit(1)
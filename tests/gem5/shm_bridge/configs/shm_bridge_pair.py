@@ -0,0 +1,96 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+"""
+Runs configs/example/shm_bridge.py as a pair of gem5 processes. The memory
+process is started in the background from the same gem5 binary, with its
+output in the memory subdirectory of the output directory, and the CPU
+process runs in this one. Once both have exited, the stats of the memory
+process are checked for the requests that crossed the bridge.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+import m5
+
+from gem5.resources.resource import obtain_resource
+
+parser = argparse.ArgumentParser()
+parser.add_argument("resource", help="The SE binary to run")
+parser.add_argument(
+    "--resource-directory", default=None, help="Where to find the resource"
+)
+args = parser.parse_args()
+
+example = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)),
+    os.pardir,
+    os.pardir,
+    os.pardir,
+    os.pardir,
+    "configs",
+    "example",
+    "shm_bridge.py",
+)
+binary = obtain_resource(
+    args.resource, resource_directory=args.resource_directory
+)
+
+# Parallel test runs must not share channels or sockets
+name = f"gem5_shm_bridge_test_{os.getpid()}"
+common = ["--channel", name, "--socket", "@" + name]
+
+mem_outdir = os.path.join(m5.options.outdir, "memory")
+memory = subprocess.Popen(
+    [os.readlink("/proc/self/exe"), "-re", "-d", mem_outdir, example]
+    + ["memory"]
+    + common
+)
+
+# Run the CPU process as if the example was the config of this process
+sys.argv = [example, "cpu", "--cmd", binary.get_local_path()] + common
+with open(example) as f:
+    code = compile(f.read(), example, "exec")
+exec(code, {"__name__": "__m5_main__", "__file__": example})
+
+if memory.wait() != 0:
+    print(f"The memory process failed with status {memory.returncode}")
+    sys.exit(1)
+
+with open(os.path.join(mem_outdir, "stats.txt")) as f:
+    received = sum(
+        int(float(m.group(1)))
+        for m in re.finditer(r"\.recordsReceived\s+(\S+)", f.read())
+    )
+if not received:
+    print("No requests crossed the shared memory bridge")
+    sys.exit(1)
+print(f"{received} requests crossed the shared memory bridge")
@@ -330,6 +330,96 @@ class MatchJSONStats(Verifier):
         return self._compare_stats(trusted_file, test_file)
 
 
+class RecordHostPerf(Verifier):
+    """
+    Records the host performance of a gem5 run for the host performance
+    benchmarks. The simulator's own host stats are read from the last dump
+    in the stats file and written, together with the benchmark name and
+    parameters, to a JSON file in the output directory, from where it is
+    copied to the testing results. The records can be collected with
+    tests/gem5/host_perf/collect_host_perf.py.
+
+    The simulation rate is measured by a stat counting the work done by
+    the run, by default simInsts. Runs without CPUs, e.g. traffic
+    generators or synthetic network traffic, use simTicks instead.
+    """
+
+    _stats = (
+        "simInsts",
+        "simOps",
+        "simTicks",
+        "hostSeconds",
+        "hostInstRate",
+        "hostOpRate",
+        "hostTickRate",
+        "hostMemory",
+    )
+
+    def __init__(
+        self,
+        benchmark: str,
+        parameters: dict,
+        rate_stat: str = "simInsts",
+        stats_file: str = "stats.txt",
+        output_file: str = "host_perf.json",
+    ):
+        """
+        :param benchmark: The name of the benchmark.
+        :param parameters: The parameters of the benchmark, e.g., the CPU
+        model and memory system, recorded for filtering the results.
+        :param rate_stat: The stat counting the work done by the run, the
+        rate of which per host second is recorded.
+        """
+        super(RecordHostPerf, self).__init__()
+        self.benchmark = benchmark
+        self.parameters = parameters
+        self.rate_stat = rate_stat
+        self.stats_file = stats_file
+        self.output_file = output_file
+
+    def _parse_last_dump(self, stats_path):
+        values = {}
+        with open(stats_path, "r") as f:
+            for line in f:
+                if line.startswith("---------- Begin"):
+                    values = {}
+                    continue
+                fields = line.split()
+                if len(fields) >= 2 and (
+                    fields[0] in self._stats or fields[0] == self.rate_stat
+                ):
+                    try:
+                        values[fields[0]] = float(fields[1])
+                    except ValueError:
+                        pass
+        return values
+
+    def test(self, params):
+        tempdir = params.fixtures[constants.tempdir_fixture_name].path
+        stats_path = joinpath(tempdir, self.stats_file)
+        if not os.path.isfile(stats_path):
+            test_util.fail(f"Could not find stats file {stats_path}")
+
+        values = self._parse_last_dump(stats_path)
+        host_seconds = values.get("hostSeconds", 0.0)
+        if host_seconds <= 0:
+            test_util.fail(f"No host time found in {stats_path}")
+        work = values.get(self.rate_stat, 0.0)
+        if work <= 0:
+            test_util.fail(f"No {self.rate_stat} found in {stats_path}")
+
+        record = {
+            "benchmark": self.benchmark,
+            "parameters": self.parameters,
+            "stats": values,
+            "rate_stat": self.rate_stat,
+            "rate": work / host_seconds,
+            "host_seconds_per_unit": host_seconds / work,
+        }
+        with open(joinpath(tempdir, self.output_file), "w") as f:
+            json.dump(record, f, indent=4)
+
+
 _re_type = type(re.compile(""))
 
 
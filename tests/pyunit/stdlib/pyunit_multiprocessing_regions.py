@@ -0,0 +1,79 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import unittest
+from pathlib import Path
+
+from gem5.utils.multiprocessing.regions import (
+    Region,
+    flatten_stats,
+    merge_weighted_stats,
+)
+
+
+class RegionsTestSuite(unittest.TestCase):
+    """Tests the utils.multiprocessing.regions helpers."""
+
+    def test_region_name(self) -> None:
+        region = Region(region_id=3, weight=0.5, checkpoint=Path("cpt"))
+
+        self.assertEqual("region3", region.get_name())
+        self.assertEqual(0.5, region.get_weight())
+        self.assertIsNone(region.get_measurement_insts())
+
+    def test_flatten_stats(self) -> None:
+        stats = {
+            "simTicks": {"value": 100, "unit": "Tick", "type": "Scalar"},
+            "board": {
+                "cores": [
+                    {"ipc": {"value": 1.5}},
+                    {"ipc": {"value": 0.5}},
+                ],
+                "name": "board",
+                "vec": [1, 2],
+            },
+        }
+
+        self.assertEqual(
+            {
+                "simTicks": 100,
+                "board.cores.0.ipc": 1.5,
+                "board.cores.1.ipc": 0.5,
+                "board.vec.0": 1,
+                "board.vec.1": 2,
+            },
+            flatten_stats(stats),
+        )
+
+    def test_merge_weighted_stats(self) -> None:
+        results = [
+            {"weight": 0.25, "stats": {"a": 4.0, "b": 1.0}},
+            {"weight": 0.75, "stats": {"a": 8.0}},
+        ]
+
+        # "b" is missing from the second region so it isn't merged.
+        self.assertEqual({"a": 7.0}, merge_weighted_stats(results))
+        self.assertEqual({}, merge_weighted_stats([]))
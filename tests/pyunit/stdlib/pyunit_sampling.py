@@ -0,0 +1,269 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import math
+import unittest
+from unittest import mock
+
+from gem5.simulate.sampling import (
+    SampleStatistics,
+    SamplingPhase,
+    SmartsSampler,
+)
+
+
+class SampleStatisticsTestSuite(unittest.TestCase):
+    """Tests the simulate.sampling.SampleStatistics class."""
+
+    def test_empty(self) -> None:
+        stats = SampleStatistics()
+
+        self.assertEqual(0, stats.get_num_samples())
+        self.assertEqual(math.inf, stats.get_relative_error())
+        with self.assertRaises(Exception):
+            stats.get_mean()
+
+    def test_single_sample(self) -> None:
+        stats = SampleStatistics()
+        stats.add(2.0)
+
+        self.assertEqual(2.0, stats.get_mean())
+        self.assertEqual(0.0, stats.get_stdev())
+        self.assertEqual(math.inf, stats.get_half_width())
+
+    def test_confidence_interval(self) -> None:
+        stats = SampleStatistics(confidence=0.95)
+        for value in [1.0, 2.0, 3.0, 4.0, 5.0]:
+            stats.add(value)
+
+        self.assertAlmostEqual(3.0, stats.get_mean())
+        self.assertAlmostEqual(math.sqrt(2.5), stats.get_stdev())
+
+        half_width = 1.959963984540054 * math.sqrt(2.5) / math.sqrt(5)
+        low, high = stats.get_confidence_interval()
+        self.assertAlmostEqual(3.0 - half_width, low)
+        self.assertAlmostEqual(3.0 + half_width, high)
+        self.assertAlmostEqual(half_width / 3.0, stats.get_relative_error())
+
+    def test_required_samples(self) -> None:
+        stats = SampleStatistics(confidence=0.95)
+        for value in [1.0, 2.0, 3.0, 4.0, 5.0]:
+            stats.add(value)
+
+        # Halving the error needs four times the samples. The targets are
+        # padded slightly so rounding doesn't push the estimate up by one.
+        error = stats.get_relative_error() * 1.001
+        self.assertEqual(5, stats.get_required_samples(error))
+        self.assertEqual(20, stats.get_required_samples(error / 2))
+
+    def test_required_samples_zero_mean(self) -> None:
+        stats = SampleStatistics()
+        stats.add(-1.0)
+        stats.add(1.0)
+
+        self.assertIsNone(stats.get_required_samples(0.01))
+
+    def test_invalid_confidence(self) -> None:
+        with self.assertRaises(ValueError):
+            SampleStatistics(confidence=1.0)
+
+
+class FakeProcessor:
+    """
+    Stands in for a SwitchableProcessor with "warming" and "detailed" cores,
+    and records how the sampler drives it.
+    """
+
+    def __init__(self) -> None:
+        self.cores = "warming"
+        self.switches = []
+        # The instruction stops scheduled on the first core
+        self.stops = []
+        core = mock.Mock()
+        core._set_inst_stop_any_thread.side_effect = (
+            lambda insts, initialized: self.stops.append((insts, initialized))
+        )
+        self._cores = [core]
+
+    def get_num_cores(self) -> int:
+        return 1
+
+    def get_cores(self):
+        return self._cores
+
+    def switch_to_processor(self, cores: str) -> None:
+        self.cores = cores
+        self.switches.append(cores)
+
+    def switch(self) -> None:
+        self.switch_to_processor(
+            "detailed" if self.cores == "warming" else "warming"
+        )
+
+
+class FakeSimpleProcessor(FakeProcessor):
+    """Stands in for a SimpleSwitchableProcessor."""
+
+
+class SmartsSamplerTestSuite(unittest.TestCase):
+    """
+    Tests the simulate.sampling.SmartsSampler class against a stubbed
+    simulator, where the warming cores take 1 tick per instruction and the
+    detailed cores 3 ticks.
+    """
+
+    TICKS_PER_INST = {"warming": 1, "detailed": 3}
+
+    def setUp(self) -> None:
+        self.tick = 0
+        self.resets = 0
+        self.dumps = 0
+        self.processor = FakeProcessor()
+
+        def reset():
+            self.resets += 1
+
+        def dump():
+            self.dumps += 1
+
+        for target, new in (
+            ("m5.curTick", lambda: self.tick),
+            ("m5.stats.reset", reset),
+            ("m5.stats.dump", dump),
+            ("gem5.simulate.sampling.inform", lambda msg: None),
+        ):
+            patcher = mock.patch(target, new)
+            patcher.start()
+            self.addCleanup(patcher.stop)
+
+    def run_sampler(self, sampler: SmartsSampler):
+        """
+        Runs each window the sampler schedules to completion, then hands the
+        MAX_INSTS exit to the sampler, until it ends the simulation. Returns
+        the phase, cores and length of every window that was run.
+        """
+        windows = []
+        exits = sampler.get_exit_event_generator()
+        while len(windows) < 1000:
+            insts, _ = self.processor.stops[-1]
+            windows.append((sampler.get_phase(), self.processor.cores, insts))
+            self.tick += insts * self.TICKS_PER_INST[self.processor.cores]
+            if next(exits):
+                return windows
+        self.fail("The sampler did not end the simulation")
+
+    def make_sampler(self, **kwargs) -> SmartsSampler:
+        params = {
+            "processor": self.processor,
+            "sampling_period": 100,
+            "detailed_warmup_insts": 10,
+            "measurement_insts": 20,
+            "warming_cores": "warming",
+            "detailed_cores": "detailed",
+        }
+        params.update(kwargs)
+        return SmartsSampler(**params)
+
+    def test_phases(self) -> None:
+        sampler = self.make_sampler(
+            offset_insts=5, target_error=None, max_samples=2
+        )
+        windows = self.run_sampler(sampler)
+
+        period = [
+            (SamplingPhase.DETAILED_WARMUP, "detailed", 10),
+            (SamplingPhase.MEASUREMENT, "detailed", 20),
+        ]
+        self.assertEqual(
+            [(SamplingPhase.FUNCTIONAL_WARMING, "warming", 75)]
+            + period
+            + [(SamplingPhase.FUNCTIONAL_WARMING, "warming", 70)]
+            + period,
+            windows,
+        )
+        self.assertEqual(
+            ["detailed", "warming", "detailed"], self.processor.switches
+        )
+
+        # Only the first stop is scheduled before the simulation starts
+        self.assertEqual(
+            [False] + [True] * 5,
+            [initialized for _, initialized in self.processor.stops],
+        )
+
+        self.assertEqual([3.0, 3.0], sampler.get_statistics().get_values())
+        self.assertEqual([(105, 60), (265, 60)], sampler.get_sample_ticks())
+        self.assertEqual(2, self.resets)
+        self.assertEqual(0, self.dumps)
+        self.assertFalse(sampler.is_converged())
+
+    def test_no_detailed_warmup(self) -> None:
+        sampler = self.make_sampler(
+            detailed_warmup_insts=0, target_error=None, max_samples=2
+        )
+        windows = self.run_sampler(sampler)
+
+        period = [
+            (SamplingPhase.FUNCTIONAL_WARMING, "warming", 80),
+            (SamplingPhase.MEASUREMENT, "detailed", 20),
+        ]
+        self.assertEqual(period * 2, windows)
+
+    def test_converged(self) -> None:
+        # Every sample measures the same CPI, so the error is zero as soon
+        # as the minimum number of samples is reached
+        sampler = self.make_sampler(min_samples=3, dump_stats=True)
+        self.run_sampler(sampler)
+
+        self.assertTrue(sampler.is_converged())
+        self.assertEqual(3, sampler.get_statistics().get_num_samples())
+        self.assertEqual(3, self.dumps)
+
+    def test_simple_switchable_processor(self) -> None:
+        self.processor = FakeSimpleProcessor()
+        with mock.patch(
+            "gem5.simulate.sampling.SimpleSwitchableProcessor",
+            FakeSimpleProcessor,
+        ):
+            sampler = self.make_sampler(
+                warming_cores=None,
+                detailed_cores=None,
+                target_error=None,
+                max_samples=2,
+            )
+        self.run_sampler(sampler)
+
+        self.assertEqual(
+            ["detailed", "warming", "detailed"], self.processor.switches
+        )
+
+    def test_invalid_windows(self) -> None:
+        with self.assertRaises(ValueError):
+            self.make_sampler(sampling_period=30)
+        with self.assertRaises(ValueError):
+            self.make_sampler(measurement_insts=0)
+        with self.assertRaises(ValueError):
+            self.make_sampler(detailed_cores=None)
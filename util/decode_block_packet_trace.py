@@ -0,0 +1,165 @@
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script is used to dump block compressed packet traces, as
+# written by MemTraceProbe with trace_format="block", to the same ASCII
+# format as decode_packet_trace.py. See src/mem/packet_trace.hh for a
+# description of the format.
+
+import struct
+import sys
+import zlib
+
+MAGIC = 0x74703567
+VERSION = 1
+
+CMD_CHANGED = 1 << 0
+FLAGS_CHANGED = 1 << 1
+SIZE_CHANGED = 1 << 2
+PC_CHANGED = 1 << 3
+
+MASK64 = (1 << 64) - 1
+
+
+def get_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return value, pos
+        shift += 7
+
+
+def get_signed(data, pos):
+    value, pos = get_varint(data, pos)
+    return (value >> 1) ^ -(value & 1), pos
+
+
+def get_string(data, pos):
+    length, pos = get_varint(data, pos)
+    return data[pos : pos + length].decode(), pos + length
+
+
+def read_header(trace):
+    magic, version, size = struct.unpack("<III", trace.read(12))
+    if magic != MAGIC:
+        print("Unrecognized file")
+        exit(-1)
+    if version != VERSION:
+        print("Unsupported version", version)
+        exit(-1)
+
+    body = trace.read(size)
+    tick_freq, pos = get_varint(body, 0)
+    obj_id, pos = get_string(body, pos)
+    num_ids, pos = get_varint(body, pos)
+    id_strings = {}
+    for _ in range(num_ids):
+        key, pos = get_varint(body, pos)
+        id_strings[key], pos = get_string(body, pos)
+    return obj_id, tick_freq, id_strings
+
+
+def read_packets(trace):
+    """Yields (tick, cmd, flags, addr, size, pc, pkt_id) tuples."""
+    while True:
+        frame = trace.read(12)
+        if len(frame) < 12:
+            return
+        compressed_size, raw_size, records = struct.unpack("<III", frame)
+        block = zlib.decompress(trace.read(compressed_size))
+        assert len(block) == raw_size
+
+        pos = 0
+        tick = cmd = flags = addr = size = pc = pkt_id = 0
+        for _ in range(records):
+            changed = block[pos]
+            pos += 1
+            delta, pos = get_signed(block, pos)
+            tick = (tick + delta) & MASK64
+            delta, pos = get_signed(block, pos)
+            addr = (addr + delta) & MASK64
+            delta, pos = get_signed(block, pos)
+            pkt_id = (pkt_id + delta) & MASK64
+            if changed & CMD_CHANGED:
+                cmd, pos = get_varint(block, pos)
+            if changed & FLAGS_CHANGED:
+                flags, pos = get_varint(block, pos)
+            if changed & SIZE_CHANGED:
+                size, pos = get_varint(block, pos)
+            if changed & PC_CHANGED:
+                delta, pos = get_signed(block, pos)
+                pc = (pc + delta) & MASK64
+            yield tick, cmd, flags, addr, size, pc, pkt_id
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("Usage: ", sys.argv[0], " <block trace input> <ASCII output>")
+        exit(-1)
+
+    try:
+        trace = open(sys.argv[1], "rb")
+    except IOError:
+        print("Failed to open ", sys.argv[1], " for reading")
+        exit(-1)
+
+    try:
+        ascii_out = open(sys.argv[2], "w")
+    except IOError:
+        print("Failed to open ", sys.argv[2], " for writing")
+        exit(-1)
+
+    obj_id, tick_freq, id_strings = read_header(trace)
+    print("Object id:", obj_id)
+    print("Tick frequency:", tick_freq)
+    for key, value in sorted(id_strings.items()):
+        print("Master id %d: %s" % (key, value))
+
+    print("Parsing packets")
+
+    num_packets = 0
+    for tick, cmd, flags, addr, size, pc, pkt_id in read_packets(trace):
+        num_packets += 1
+        # ReadReq is 1 and WriteReq is 4 in src/mem/packet.hh Command enum
+        cmd = "r" if cmd == 1 else ("w" if cmd == 4 else "u")
+        ascii_out.write(f"{pkt_id},{cmd},{addr},{size},{flags},{tick}")
+        if pc:
+            ascii_out.write(f",{pc}\n")
+        else:
+            ascii_out.write("\n")
+
+    print("Parsed packets:", num_packets)
+
+    ascii_out.close()
+    trace.close()
+
+
+if __name__ == "__main__":
+    main()
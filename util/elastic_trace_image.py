@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script converts a protobuf elastic data dependency trace into the
+# pre-decoded image format read by the Trace CPU (see
+# src/cpu/trace/elastic_trace_image.hh). The image is memory-mapped by the
+# Trace CPU, which avoids decoding the protobuf trace in every simulation of
+# a design-space sweep, and lets all the simulations share the same pages.
+#
+# Usage: elastic_trace_image.py <protobuf input> <image output>
+
+import array
+import struct
+import sys
+
+import protolib
+
+# Import the packet proto definitions. If they are not found, attempt
+# to generate them automatically. This assumes that the script is
+# executed from the gem5 root.
+try:
+    import inst_dep_record_pb2
+except:
+    print("Did not find proto definition, attempting to generate")
+    from subprocess import call
+
+    error = call(
+        [
+            "protoc",
+            "--python_out=util",
+            "--proto_path=src/proto",
+            "src/proto/inst_dep_record.proto",
+        ]
+    )
+    if not error:
+        import inst_dep_record_pb2
+
+        print("Generated proto definitions for instruction dependency record")
+    else:
+        print("Failed to import proto definitions")
+        exit(-1)
+
+# These must match ElasticTraceImage::Header and ElasticTraceImage::Record
+IMAGE_MAGIC = b"gem5etri"
+IMAGE_VERSION = 1
+HEADER = struct.Struct("<8sIIQQQ")
+RECORD = struct.Struct("<QQQQQQQIIHHB3x")
+# The dependency counts of a record are 16-bit
+MAX_DEPS = 0xFFFF
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("Usage: ", sys.argv[0], " <protobuf input> <image output>")
+        exit(-1)
+
+    proto_in = protolib.openFileRd(sys.argv[1])
+
+    try:
+        image_out = open(sys.argv[2], "wb")
+    except IOError:
+        print("Failed to open ", sys.argv[2], " for writing")
+        exit(-1)
+
+    # Read the magic number in 4-byte Little Endian
+    magic_number = proto_in.read(4)
+
+    if magic_number != b"gem5":
+        print("Unrecognized file")
+        exit(-1)
+
+    header = inst_dep_record_pb2.InstDepRecordHeader()
+    protolib.decodeMessage(proto_in, header)
+
+    # Leave room for the header, which is written once the number of
+    # records and dependencies is known
+    image_out.write(bytes(HEADER.size))
+
+    num_records = 0
+    deps = array.array("Q")
+    packet = inst_dep_record_pb2.InstDepRecord()
+
+    while protolib.decodeMessage(proto_in, packet):
+        if max(len(packet.rob_dep), len(packet.reg_dep)) > MAX_DEPS:
+            print(
+                "Record",
+                packet.seq_num,
+                "has more than",
+                MAX_DEPS,
+                "dependencies",
+            )
+            exit(-1)
+
+        dep_idx = len(deps)
+        deps.extend(packet.rob_dep)
+        # Register dependencies that also are order dependencies are
+        # left out, as done by the Trace CPU when reading the trace
+        reg_deps = [d for d in packet.reg_dep if d not in packet.rob_dep]
+        deps.extend(reg_deps)
+
+        image_out.write(
+            RECORD.pack(
+                packet.seq_num,
+                packet.p_addr,
+                packet.v_addr,
+                packet.pc,
+                packet.comp_delay,
+                packet.flags,
+                dep_idx,
+                packet.size,
+                packet.weight,
+                len(packet.rob_dep),
+                len(reg_deps),
+                packet.type,
+            )
+        )
+        num_records += 1
+
+    if sys.byteorder != "little":
+        deps.byteswap()
+    deps.tofile(image_out)
+
+    image_out.seek(0)
+    image_out.write(
+        HEADER.pack(
+            IMAGE_MAGIC,
+            IMAGE_VERSION,
+            header.window_size,
+            header.tick_freq,
+            num_records,
+            len(deps),
+        )
+    )
+
+    print("Converted", num_records, "records with", len(deps), "dependencies")
+
+    proto_in.close()
+    image_out.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script extracts a branch trace, in the protobuf format read by the
+# BranchTraceReplayer (see src/proto/branch.proto), from an Exec trace.
+# The Exec trace must include the instruction flags and every microop, e.g.
+# as produced by:
+#   gem5.opt --debug-flags=ExecEnable,ExecFlags,ExecMicro \
+#       --debug-file=exec.txt.gz <config>
+# Within a detailed CPU, the BranchTrace probe listener of the O3 CPU
+# records the same trace directly, without going through a text trace.
+#
+# Whether a branch was taken is inferred from the PC of the instruction that
+# follows it. For ISAs with variable-length instructions, pass
+# --inst-size 0, in which case a branch is considered not taken when the
+# next instruction is within --max-inst-size bytes after it.
+#
+# Usage: extract_branch_trace.py [options] <Exec trace> <protobuf output>
+
+import argparse
+import gzip
+import re
+import sys
+
+import protolib
+
+# Import the branch proto definitions. If they are not found, attempt
+# to generate them automatically. This assumes that the script is
+# executed from the gem5 root.
+try:
+    import branch_pb2
+except:
+    print("Did not find proto definition, attempting to generate")
+    from subprocess import call
+
+    error = call(
+        [
+            "protoc",
+            "--python_out=util",
+            "--proto_path=src/proto",
+            "src/proto/branch.proto",
+        ]
+    )
+    if not error:
+        import branch_pb2
+
+        print("Generated proto definitions for branches")
+    else:
+        print("Failed to import proto definitions")
+        exit(-1)
+
+# <tick>: <cpu>: [A<asid> ][T<tid> : ]<pc>[ @<symbol>][.<upc>] : ... flags=(..)
+EXEC_LINE = re.compile(
+    r"^\s*\d+:\s+(?P<cpu>[^:\s]+):\s+(?:A\d+\s+)?(?:T(?P<tid>\d+)\s+:\s+)?"
+    r"(?P<pc>0x[0-9a-fA-F]+)(?:\s+@\S+)?(?:\.\s*(?P<upc>\d+))?\s+:"
+    r".*flags=\((?P<flags>[^)]*)\)"
+)
+
+
+class Stream:
+    """The branches of one thread of one CPU."""
+
+    def __init__(self):
+        self.branch = None
+        self.insts = 0
+        self.last_pc = None
+
+
+def branch_flags(flags):
+    value = 0
+    if "IsCondControl" in flags:
+        value |= branch_pb2.Branch.Conditional
+    if "IsIndirectControl" in flags:
+        value |= branch_pb2.Branch.Indirect
+    if "IsCall" in flags:
+        value |= branch_pb2.Branch.Call
+    if "IsReturn" in flags:
+        value |= branch_pb2.Branch.Return
+    return value
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Extract a branch trace from an Exec trace"
+    )
+    parser.add_argument("exec_trace", help="Exec trace, possibly gzipped")
+    parser.add_argument("output", help="Protobuf branch trace output")
+    parser.add_argument(
+        "--inst-size",
+        type=int,
+        default=4,
+        help="Size of the instructions, 0 for variable-length ISAs",
+    )
+    parser.add_argument(
+        "--max-inst-size",
+        type=int,
+        default=15,
+        help="Largest instruction size with --inst-size 0",
+    )
+    parser.add_argument(
+        "--cpu", default=None, help="Only extract the branches of this CPU"
+    )
+    args = parser.parse_args()
+
+    opener = gzip.open if args.exec_trace.endswith(".gz") else open
+    try:
+        exec_in = opener(args.exec_trace, "rt")
+    except IOError:
+        print("Failed to open ", args.exec_trace, " for reading")
+        exit(-1)
+
+    opener = gzip.open if args.output.endswith(".gz") else open
+    try:
+        proto_out = opener(args.output, "wb")
+    except IOError:
+        print("Failed to open ", args.output, " for writing")
+        exit(-1)
+
+    # Write the magic number in 4-byte Little Endian, similar to what
+    # is done in src/proto/protoio.cc
+    proto_out.write(b"gem5")
+
+    header = branch_pb2.BranchHeader()
+    header.obj_id = "Branches extracted from " + args.exec_trace
+    protolib.encodeMessage(proto_out, header)
+
+    streams = {}
+    num_branches = 0
+
+    def resolve(stream, next_pc):
+        pc, flags, insts = stream.branch
+        branch = branch_pb2.Branch()
+        branch.pc = pc
+        branch.flags = flags
+        branch.insts = insts
+        if args.inst_size:
+            taken = next_pc != pc + args.inst_size
+        else:
+            taken = not (pc < next_pc <= pc + args.max_inst_size)
+        branch.taken = taken
+        if taken:
+            branch.target = next_pc
+        else:
+            branch.target = 0
+            branch.size = next_pc - pc
+        protolib.encodeMessage(proto_out, branch)
+        stream.branch = None
+
+    for line in exec_in:
+        match = EXEC_LINE.match(line)
+        if not match or (args.cpu and match.group("cpu") != args.cpu):
+            continue
+
+        key = (match.group("cpu"), match.group("tid"))
+        stream = streams.setdefault(key, Stream())
+
+        pc = int(match.group("pc"), 16)
+        upc = match.group("upc")
+        if pc != stream.last_pc or upc is None or int(upc) == 0:
+            stream.insts += 1
+        stream.last_pc = pc
+
+        # the branch is resolved once control leaves its instruction
+        if stream.branch and pc != stream.branch[0]:
+            resolve(stream, pc)
+            num_branches += 1
+
+        flags = match.group("flags").split("|")
+        if "IsControl" in flags:
+            insts = stream.insts
+            if stream.branch:
+                # another control microop of the same instruction
+                insts += stream.branch[2]
+            stream.branch = (pc, branch_flags(flags), insts)
+            stream.insts = 0
+
+    exec_in.close()
+    proto_out.close()
+
+    print("Extracted", num_branches, "branches from", len(streams), "threads")
+
+
+if __name__ == "__main__":
+    main()